@@ -51,6 +51,7 @@
 //-----------------------------------------------------------------------------
 #include <stdint.h>
 #include <stdio.h>
+#include <string.h>
 
 //-----------------------------------------------------------------------------
 // Loads MSP launchpad board support macros and definitions
@@ -64,25 +65,56 @@
 //-----------------------------------------------------------------------------
 // Define symbolic constants used by program
 //-----------------------------------------------------------------------------
-#define PERIPHERAL_PWR_UP_DELAY                                            (24)
 #define ACTIVE_LOW                                                          (0)
 #define ACTIVE_HIGH                                                         (1)
 
+// An LED bank value is looked up one nibble (4 LEDs) at a time
+#define LED_BANK_NIBBLES                                                     (2)
+#define LED_BANK_NIBBLE_VALUES                                              (16)
+#define LED_BANK_NIBBLE_MASK                                              (0x0F)
+#define LED_BANK_NIBBLE_SHIFT                                                (4)
+#define LED_BANK_IDX_SHIFT                                                   (2)
+
+// A keypad key code has the column pattern in the low nibble and the row
+// pattern in the high nibble, the pressed column and row are the 0 bits
+#define KP_CODE_NIBBLE_MASK                                               (0x0F)
+#define KP_CODE_ROW_SHIFT                                                    (4)
+
+// Bus clock cycles for the rows to settle after a new column is driven
+#define KP_COL_SETTLE_CYCLES                                                (16)
+
+// Index of the SDA and SCL pins in iic_config_data
+#define I2C_SDA_IDX                                                          (0)
+#define I2C_SCL_IDX                                                          (1)
+
 
 //-----------------------------------------------------------------------------
 // Define global variable and structures here.
 // NOTE: when possible avoid using global variables
 //-----------------------------------------------------------------------------
 
-// Define a structure to hold led configuration data
+// Define a structure to hold a GPIO pin descriptor. The port registers and
+// the pin masks for the active and inactive levels are worked out at
+// compile time, so turning a pin on or off is a DOUTSET31_0 and a
+// DOUTCLR31_0 write (one of them writes 0 and does nothing) and reading it
+// is a compare, with no branches on the port or the polarity.
 typedef struct
 {
-  uint8_t  port_id;
-  uint32_t bit_mask;
-  uint16_t pin_cm;
-  uint8_t  polarity;
+  GPIO_Regs *port;            // GPIO port registers
+  uint32_t   bit_mask;        // pin mask
+  uint32_t   active;          // pin mask if the pin is high when active
+  uint32_t   inactive;        // pin mask if the pin is low when active
+  uint16_t   pin_cm;          // IOMUX PINCM index
+  uint8_t    port_id;         // GPIO_PORTA or GPIO_PORTB
 } gpio_struct;
 
+// Build a GPIO pin descriptor. The polarity is the pin level when active,
+// as read from DIN31_0 after any IOMUX inversion.
+#define GPIO_PIN(port_id, mask, iomux, polarity)                              \
+        {((port_id) == GPIO_PORTA) ? GPIOA : GPIOB, (mask),                   \
+         ((polarity) == ACTIVE_HIGH) ? (mask) : 0,                            \
+         ((polarity) == ACTIVE_HIGH) ? 0 : (mask), (iomux), (port_id)}
+
 // Define a structure to hold i2c configuration data
 typedef struct
 {
@@ -95,61 +127,65 @@ typedef struct
 
 // Define the configuration data for the LEDs on the LP-MSPM0G3507
 const gpio_struct lp_led_config_data[] = {
-        {LP_LED_RED_PORT, LP_LED_RED_MASK, LP_LED_RED_IOMUX, ACTIVE_LOW},
-        {LP_RGB_RED_PORT, LP_RGB_RED_MASK, LP_RGB_RED_IOMUX, ACTIVE_HIGH},
-        {LP_RGB_GRN_PORT, LP_RGB_GRN_MASK, LP_RGB_GRN_IOMUX, ACTIVE_HIGH},
-        {LP_RGB_BLU_PORT, LP_RGB_BLU_MASK, LP_RGB_BLU_IOMUX, ACTIVE_HIGH}
+  GPIO_PIN(LP_LED_RED_PORT, LP_LED_RED_MASK, LP_LED_RED_IOMUX, ACTIVE_LOW),
+  GPIO_PIN(LP_RGB_RED_PORT, LP_RGB_RED_MASK, LP_RGB_RED_IOMUX, ACTIVE_HIGH),
+  GPIO_PIN(LP_RGB_GRN_PORT, LP_RGB_GRN_MASK, LP_RGB_GRN_IOMUX, ACTIVE_HIGH),
+  GPIO_PIN(LP_RGB_BLU_PORT, LP_RGB_BLU_MASK, LP_RGB_BLU_IOMUX, ACTIVE_HIGH)
 };
 
 // Define the configuration data for the LEDs on the CSC202 Board
 const gpio_struct led_config_data[] = {
-        {LED0_PORT, LED0_MASK, LED0_IOMUX, ACTIVE_LOW},
-        {LED1_PORT, LED1_MASK, LED1_IOMUX, ACTIVE_LOW},
-        {LED2_PORT, LED2_MASK, LED2_IOMUX, ACTIVE_LOW},
-        {LED3_PORT, LED3_MASK, LED3_IOMUX, ACTIVE_LOW},
-        {LED4_PORT, LED4_MASK, LED4_IOMUX, ACTIVE_LOW},
-        {LED5_PORT, LED5_MASK, LED5_IOMUX, ACTIVE_LOW},
-        {LED6_PORT, LED6_MASK, LED6_IOMUX, ACTIVE_LOW},
-        {LED7_PORT, LED7_MASK, LED7_IOMUX, ACTIVE_LOW}
+  GPIO_PIN(LED0_PORT, LED0_MASK, LED0_IOMUX, ACTIVE_LOW),
+  GPIO_PIN(LED1_PORT, LED1_MASK, LED1_IOMUX, ACTIVE_LOW),
+  GPIO_PIN(LED2_PORT, LED2_MASK, LED2_IOMUX, ACTIVE_LOW),
+  GPIO_PIN(LED3_PORT, LED3_MASK, LED3_IOMUX, ACTIVE_LOW),
+  GPIO_PIN(LED4_PORT, LED4_MASK, LED4_IOMUX, ACTIVE_LOW),
+  GPIO_PIN(LED5_PORT, LED5_MASK, LED5_IOMUX, ACTIVE_LOW),
+  GPIO_PIN(LED6_PORT, LED6_MASK, LED6_IOMUX, ACTIVE_LOW),
+  GPIO_PIN(LED7_PORT, LED7_MASK, LED7_IOMUX, ACTIVE_LOW)
 };
 
 // Define the configuration data for the enables on the CSC202 Board
 const gpio_struct enable_controls[] = {
-        {ENABLE_DIG0_PORT, ENABLE_DIG0_MASK, ENABLE_DIG0_IOMUX, ACTIVE_HIGH},
-        {ENABLE_DIG1_PORT, ENABLE_DIG1_MASK, ENABLE_DIG1_IOMUX, ACTIVE_HIGH},
-        {ENABLE_DIG2_PORT, ENABLE_DIG2_MASK, ENABLE_DIG2_IOMUX, ACTIVE_HIGH},
-        {ENABLE_DIG3_PORT, ENABLE_DIG3_MASK, ENABLE_DIG3_IOMUX, ACTIVE_HIGH},
-        {ENABLE_LED_PORT,  ENABLE_LED_MASK,  ENABLE_LED_IOMUX, ACTIVE_HIGH}
+  GPIO_PIN(ENABLE_DIG0_PORT, ENABLE_DIG0_MASK, ENABLE_DIG0_IOMUX, ACTIVE_HIGH),
+  GPIO_PIN(ENABLE_DIG1_PORT, ENABLE_DIG1_MASK, ENABLE_DIG1_IOMUX, ACTIVE_HIGH),
+  GPIO_PIN(ENABLE_DIG2_PORT, ENABLE_DIG2_MASK, ENABLE_DIG2_IOMUX, ACTIVE_HIGH),
+  GPIO_PIN(ENABLE_DIG3_PORT, ENABLE_DIG3_MASK, ENABLE_DIG3_IOMUX, ACTIVE_HIGH),
+  GPIO_PIN(ENABLE_LED_PORT, ENABLE_LED_MASK, ENABLE_LED_IOMUX, ACTIVE_HIGH)
 };
 
-// Define the configuration data for the switches on the LaunchPad Board
+// Define the configuration data for the switches on the LaunchPad Board.
+// SW2 is active low, but lpsw_init() enables the IOMUX inversion, so it
+// reads active high.
 const gpio_struct lp_switch_config_data[] = {
-        {LP_SW1_PORT, LP_SW1_MASK, LP_SW1_IOMUX, ACTIVE_HIGH},
-        {LP_SW2_PORT, LP_SW2_MASK, LP_SW2_IOMUX, ACTIVE_LOW}
+  GPIO_PIN(LP_SW1_PORT, LP_SW1_MASK, LP_SW1_IOMUX, ACTIVE_HIGH),
+  GPIO_PIN(LP_SW2_PORT, LP_SW2_MASK, LP_SW2_IOMUX, ACTIVE_HIGH)
 };
 
-// Define the configuration data for the switches on the CSC202 Board
+// Define the configuration data for the switches on the CSC202 Board. The
+// switches are active low, but dipsw_init() enables the IOMUX inversion, so
+// they read active high.
 const gpio_struct dip_switch_config_data[] = {
-        {DIP_SW1_PORT, DIP_SW1_MASK, DIP_SW1_IOMUX, ACTIVE_LOW},
-        {DIP_SW2_PORT, DIP_SW2_MASK, DIP_SW2_IOMUX, ACTIVE_LOW},
-        {DIP_SW3_PORT, DIP_SW3_MASK, DIP_SW3_IOMUX, ACTIVE_LOW},
-        {DIP_SW4_PORT, DIP_SW4_MASK, DIP_SW4_IOMUX, ACTIVE_LOW}
+  GPIO_PIN(DIP_SW1_PORT, DIP_SW1_MASK, DIP_SW1_IOMUX, ACTIVE_HIGH),
+  GPIO_PIN(DIP_SW2_PORT, DIP_SW2_MASK, DIP_SW2_IOMUX, ACTIVE_HIGH),
+  GPIO_PIN(DIP_SW3_PORT, DIP_SW3_MASK, DIP_SW3_IOMUX, ACTIVE_HIGH),
+  GPIO_PIN(DIP_SW4_PORT, DIP_SW4_MASK, DIP_SW4_IOMUX, ACTIVE_HIGH)
 };
 
 // Define the configuration data for the 4x4 Keypad on the CSC202 Board
 const gpio_struct kp_col_config_data[] = {
-        {KP_COL0_PORT, KP_COL0_MASK, KP_COL0_IOMUX, ACTIVE_HIGH},
-        {KP_COL1_PORT, KP_COL1_MASK, KP_COL1_IOMUX, ACTIVE_HIGH},
-        {KP_COL2_PORT, KP_COL2_MASK, KP_COL2_IOMUX, ACTIVE_HIGH},
-        {KP_COL3_PORT, KP_COL3_MASK, KP_COL3_IOMUX, ACTIVE_HIGH}
+  GPIO_PIN(KP_COL0_PORT, KP_COL0_MASK, KP_COL0_IOMUX, ACTIVE_HIGH),
+  GPIO_PIN(KP_COL1_PORT, KP_COL1_MASK, KP_COL1_IOMUX, ACTIVE_HIGH),
+  GPIO_PIN(KP_COL2_PORT, KP_COL2_MASK, KP_COL2_IOMUX, ACTIVE_HIGH),
+  GPIO_PIN(KP_COL3_PORT, KP_COL3_MASK, KP_COL3_IOMUX, ACTIVE_HIGH)
 };
 
 // Define the configuration data for the 4x4 Keypad on the CSC202 Board
 const gpio_struct kp_row_config_data[] = {
-        {KP_ROW0_PORT, KP_ROW0_MASK, KP_ROW0_IOMUX, ACTIVE_HIGH},
-        {KP_ROW1_PORT, KP_ROW1_MASK, KP_ROW1_IOMUX, ACTIVE_HIGH},
-        {KP_ROW2_PORT, KP_ROW2_MASK, KP_ROW2_IOMUX, ACTIVE_HIGH},
-        {KP_ROW3_PORT, KP_ROW3_MASK, KP_ROW3_IOMUX, ACTIVE_HIGH}
+  GPIO_PIN(KP_ROW0_PORT, KP_ROW0_MASK, KP_ROW0_IOMUX, ACTIVE_HIGH),
+  GPIO_PIN(KP_ROW1_PORT, KP_ROW1_MASK, KP_ROW1_IOMUX, ACTIVE_HIGH),
+  GPIO_PIN(KP_ROW2_PORT, KP_ROW2_MASK, KP_ROW2_IOMUX, ACTIVE_HIGH),
+  GPIO_PIN(KP_ROW3_PORT, KP_ROW3_MASK, KP_ROW3_IOMUX, ACTIVE_HIGH)
 };
 
 // Define the configuration data for the IIC port on the CSC202 Board
@@ -190,11 +226,40 @@ uint8_t keycodes[] = { 0x7D,    // 0
                     };
 
 
+// GPIO port registers indexed by port_id
+static GPIO_Regs *const g_gpio_ports[MAX_NUM_GPIO_PORTS] = {GPIOA, GPIOB};
+
+// Pins to drive high on each port for every value of the low and high
+// nibble of the LED bar, and all the LED bar and digit enable pins of each
+// port. Built from led_config_data and enable_controls by leds_bank_build.
+static uint32_t g_led_bank_high[LED_BANK_NIBBLES][LED_BANK_NIBBLE_VALUES]
+                               [MAX_NUM_GPIO_PORTS];
+static uint32_t g_led_bank_pins[MAX_NUM_GPIO_PORTS];
+static uint32_t g_seg7_enable_pins[MAX_NUM_GPIO_PORTS];
+
+// Keypad column pins of each port, and the keycodes index of each bit of
+// the matrix read by keypad_read_matrix. Built by keypad_init.
+static uint32_t g_kp_col_pins[MAX_NUM_GPIO_PORTS];
+static uint8_t  g_kp_matrix_keys[MAX_NUM_KEYPAD_KEYS];
+
+// Health statistics for the I2C slave devices and bus recovery count
+static i2c_dev_stats_t g_i2c_dev_stats[I2C_MAX_DEV_STATS];
+static uint32_t        g_i2c_recovery_count = 0;
+
+
 //-----------------------------------------------------------------------------
 // Define function prototypes used by the program
 //-----------------------------------------------------------------------------
 static uint32_t I2C_mstr_send_internal(uint8_t slave, uint8_t data[], 
           uint8_t length, i2c_burst_type_t i2c_type);
+static uint32_t I2C_mstr_send_xfer(uint8_t slave, uint8_t data[], 
+          uint8_t length, i2c_burst_type_t i2c_type);
+static uint32_t I2C_mstr_read_xfer(uint8_t slave, uint8_t *buffer, 
+          uint8_t length, i2c_burst_type_t i2c_type);
+static void I2C_mstr_xfer_done(uint8_t slave, uint32_t status, 
+          uint32_t start_cycles);
+static void leds_bank_build(void);
+static uint8_t keypad_code_line(uint8_t pattern);
 
 
 
@@ -237,6 +302,26 @@ void launchpad_gpio_init(void)
 } /* launchpad_gpio_init */
 
 
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function returns the registers of a GPIO port, so the drivers
+//    that work on all the pins of a port at once share one port table.
+//
+// INPUT PARAMETERS:
+//    port_id - GPIO_PORTA or GPIO_PORTB
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    pointer to the port registers, NULL for an unknown port
+// -----------------------------------------------------------------------------
+GPIO_Regs *gpio_port_regs(uint8_t port_id)
+{
+  return ((port_id < MAX_NUM_GPIO_PORTS) ? g_gpio_ports[port_id] : NULL);
+} /* gpio_port_regs */
+
+
 //-----------------------------------------------------------------------------
 // DESCRIPTION:
 //    This function configures the pins connected to the LEDs on the
@@ -264,14 +349,8 @@ void lp_leds_init(void)
   {
     IOMUX->SECCFG.PINCM[lp_led_config_data[led_idx].pin_cm] = gpio_pincm;
 
-    if (lp_led_config_data[led_idx].port_id == GPIO_PORTA)
-    {
-      GPIOA->DOE31_0 |= lp_led_config_data[led_idx].bit_mask;
-    } /* if */
-    else
-    {
-      GPIOB->DOE31_0 |= lp_led_config_data[led_idx].bit_mask;
-    } /* else */
+    lp_led_config_data[led_idx].port->DOE31_0 |=
+      lp_led_config_data[led_idx].bit_mask;
   }  /* for */
 
   lp_leds_off(LP_RED_LED1_IDX);
@@ -311,14 +390,8 @@ void lp_leds_deinit(void)
   {
     IOMUX->SECCFG.PINCM[lp_led_config_data[led_idx].pin_cm] = gpio_pincm;
 
-    if (lp_led_config_data[led_idx].port_id == GPIO_PORTA)
-    {
-      GPIOA->DOE31_0 &= ~lp_led_config_data[led_idx].bit_mask;
-    } /* if */
-    else
-    {
-      GPIOB->DOE31_0 &= ~lp_led_config_data[led_idx].bit_mask;
-    } /* else */
+    lp_led_config_data[led_idx].port->DOE31_0 &=
+      ~lp_led_config_data[led_idx].bit_mask;
   }  /* for */
 
 } /* lp_leds_deinit */
@@ -326,11 +399,9 @@ void lp_leds_deinit(void)
 //-----------------------------------------------------------------------------
 // DESCRIPTION:
 //    This function turns on a specified LED on the MSPM0G3507 LaunchPad
-//    based on the given index. It checks the configuration data to determine
-//    the port and polarity of the LED. If the LED is configured as active
-//    high, it sets the corresponding bit in the data output register to turn
-//    on the LED. If the LED is configured as active low, it clears the
-//    corresponding bit in the data output register.
+//    based on the given index. The LED descriptor holds the port and the
+//    pin masks for each level, so the LED is turned on with one DOUTSET
+//    and one DOUTCLR write (one of them writes 0) and no branches.
 //
 // INPUT PARAMETERS:
 //    index - An 8-bit index of the LED to be turned on.
@@ -343,29 +414,10 @@ void lp_leds_deinit(void)
 // -----------------------------------------------------------------------------
 void lp_leds_on(uint8_t index)
 {
-
-  if (lp_led_config_data[index].port_id == GPIO_PORTA)
-  {
-    if (lp_led_config_data[index].polarity == ACTIVE_HIGH)
-    {
-      GPIOA->DOUT31_0 |= lp_led_config_data[index].bit_mask;
-    } /* if */
-    else
-    {
-      GPIOA->DOUT31_0 &= ~lp_led_config_data[index].bit_mask;
-    } /* else */
-  } /* if PORTA */
-  else
-  {
-    if (lp_led_config_data[index].polarity == ACTIVE_HIGH)
-    {
-      GPIOB->DOUT31_0 |= lp_led_config_data[index].bit_mask;
-    } /* if */
-    else
-    {
-      GPIOB->DOUT31_0 &= ~lp_led_config_data[index].bit_mask;
-    } /* else PORT B */
-  } /* else */
+  lp_led_config_data[index].port->DOUTSET31_0 =
+        lp_led_config_data[index].active;
+  lp_led_config_data[index].port->DOUTCLR31_0 =
+        lp_led_config_data[index].inactive;
 
 } /* lp_leds_on */
 
@@ -373,11 +425,9 @@ void lp_leds_on(uint8_t index)
 //-----------------------------------------------------------------------------
 // DESCRIPTION:
 //    This function turns off a specified LED on the MSPM0G3507 LaunchPad
-//    based on the given index. It checks the configuration data to determine
-//    the port and polarity of the LED. If the LED is configured as active
-//    high, it clears the corresponding bit in the data output register to turn
-//    off the LED. If the LED is configured as active low, it sets the
-//    corresponding bit in the data output register.
+//    based on the given index. The LED descriptor holds the port and the
+//    pin masks for each level, so the LED is turned off with one DOUTSET
+//    and one DOUTCLR write (one of them writes 0) and no branches.
 //
 // INPUT PARAMETERS:
 //    index - An 8-bit index of the LED to be turned off.
@@ -390,29 +440,10 @@ void lp_leds_on(uint8_t index)
 // -----------------------------------------------------------------------------
 void lp_leds_off(uint8_t index)
 {
-
-  if (lp_led_config_data[index].port_id == GPIO_PORTA)
-  {
-    if (lp_led_config_data[index].polarity == ACTIVE_HIGH)
-    {
-      GPIOA->DOUT31_0 &= ~lp_led_config_data[index].bit_mask;
-    } /* if */
-    else
-    {
-      GPIOA->DOUT31_0 |= lp_led_config_data[index].bit_mask;
-    } /* else */
-  } /* if PORTA */
-  else
-  {
-    if (lp_led_config_data[index].polarity == ACTIVE_HIGH)
-    {
-      GPIOB->DOUT31_0 &= ~lp_led_config_data[index].bit_mask;
-    } /* if */
-    else
-    {
-      GPIOB->DOUT31_0 |= lp_led_config_data[index].bit_mask;
-    } /* else PORT B */
-  } /* else */
+  lp_led_config_data[index].port->DOUTSET31_0 =
+        lp_led_config_data[index].inactive;
+  lp_led_config_data[index].port->DOUTCLR31_0 =
+        lp_led_config_data[index].active;
 
 } /* lp_leds_off */
 
@@ -453,14 +484,7 @@ void leds_init(void)
     IOMUX->SECCFG.PINCM[led_config_data[led_idx].pin_cm] = gpio_pincm;
 
     // Enable GPIO output port
-    if (led_config_data[led_idx].port_id == GPIO_PORTA)
-    {
-      GPIOA->DOE31_0 |= led_config_data[led_idx].bit_mask;
-    } /* if */
-    else
-    {
-      GPIOB->DOE31_0 |= led_config_data[led_idx].bit_mask;
-    } /* else */
+    led_config_data[led_idx].port->DOE31_0 |= led_config_data[led_idx].bit_mask;
   }  /* for */
 
   //Configure the enable signal to the LED Bar graph
@@ -468,6 +492,7 @@ void leds_init(void)
   GPIOA->DOE31_0 |= enable_controls[LED_BAR_ENABLE_IDX].bit_mask;
 
   // Ensure all the LEDs are off
+  leds_bank_build();
   leds_off();
 
 } /* leds_init */
@@ -503,14 +528,8 @@ void leds_deinit(void)
     IOMUX->SECCFG.PINCM[led_config_data[led_idx].pin_cm] = gpio_pincm;
 
     // Disable GPIO output port
-    if (led_config_data[led_idx].port_id == GPIO_PORTA)
-    {
-      GPIOA->DOE31_0 &= ~led_config_data[led_idx].bit_mask;
-    } /* if */
-    else
-    {
-      GPIOB->DOE31_0 &= ~led_config_data[led_idx].bit_mask;
-    } /* else */
+    led_config_data[led_idx].port->DOE31_0 &=
+      ~led_config_data[led_idx].bit_mask;
   }  /* for */
 
   // Clear the enable signal to the LED Bar graph
@@ -538,7 +557,7 @@ void leds_deinit(void)
 // -----------------------------------------------------------------------------
 void leds_enable(void)
 {
-  GPIOA->DOUT31_0 |= enable_controls[LED_BAR_ENABLE_IDX].bit_mask;
+  GPIOA->DOUTSET31_0 = enable_controls[LED_BAR_ENABLE_IDX].bit_mask;
 } /* leds_enable */
 
 //-----------------------------------------------------------------------------
@@ -559,17 +578,13 @@ void leds_enable(void)
 // -----------------------------------------------------------------------------
 void leds_disable(void)
 {
-  GPIOA->DOUT31_0 &= ~enable_controls[LED_BAR_ENABLE_IDX].bit_mask;
+  GPIOA->DOUTCLR31_0 = enable_controls[LED_BAR_ENABLE_IDX].bit_mask;
 } /* leds_disable */
 
 //-----------------------------------------------------------------------------
 // DESCRIPTION:
 //    This function turns off all the LEDs on the CSC202 Expansion Board.
-//    It iterates through the LED configuration data and determines the
-//    port and polarity of each LED. If the LED is configured as active
-//    high, it clears the corresponding bit in the data output register
-//    to turn off the LED. If the LED is configured as active low, it sets
-//    the corresponding bit in the data output register.
+//    It writes the LED bank with all bits clear, see leds_on().
 //
 // INPUT PARAMETERS:
 //    none
@@ -582,45 +597,25 @@ void leds_disable(void)
 // -----------------------------------------------------------------------------
 void leds_off(void)
 {
-
-  for (uint8_t led_idx = 0; led_idx < MAX_NUM_LEDS; led_idx++)
-  {
-    if (led_config_data[led_idx].port_id == GPIO_PORTA)
-    {
-      if (led_config_data[led_idx].polarity == ACTIVE_HIGH)
-      {
-        GPIOA->DOUT31_0 &= ~led_config_data[led_idx].bit_mask;
-      } /* if */
-      else
-      {
-        GPIOA->DOUT31_0 |= led_config_data[led_idx].bit_mask;
-      } /* else */
-    } /* if PORTA */
-    else
-    {
-      if (led_config_data[led_idx].polarity == ACTIVE_HIGH)
-      {
-        GPIOB->DOUT31_0 &= ~led_config_data[led_idx].bit_mask;
-      } /* if */
-      else
-      {
-        GPIOB->DOUT31_0 |= led_config_data[led_idx].bit_mask;
-      } /* else PORT B */
-    } /* else */
-  } /* for */
-
+  leds_on(0);
 } /* leds_off */
 
 //-----------------------------------------------------------------------------
 // DESCRIPTION:
 //    This function turns on LEDs on the CSC202 Expansion Board based on the
-//    given value. For each LED, it checks if the corresponding bit in the
-//    value is set. If the bit is set, it turns on the LED according to its
-//    port and polarity configuration. If the bit is not set, it ensures the
+//    given value. If a bit is set the LED is turned on, if it is clear the
 //    LED is turned off.
 //
+//    The pins to drive high on each port are looked up in the bank table,
+//    one entry for each nibble of the value, with the polarity of each LED
+//    already applied. Each port is then updated with one DOUTSET write and
+//    one DOUTCLR write. The time taken does not depend on the value, and
+//    since there is no read-modify-write of DOUT, pins changed by an
+//    interrupt in the middle of the update are not lost.
+//
 // INPUT PARAMETERS:
 //    value - A 32-bit value where each bit corresponds to an LED index.
+//            Only bits 0-7 are used.
 //
 // OUTPUT PARAMETERS:
 //    none
@@ -630,71 +625,80 @@ void leds_off(void)
 // -----------------------------------------------------------------------------
 void leds_on(uint32_t value)
 {
+  const uint32_t *low_pins  =
+        g_led_bank_high[0][value & LED_BANK_NIBBLE_MASK];
+  const uint32_t *high_pins =
+        g_led_bank_high[1][(value >> LED_BANK_NIBBLE_SHIFT) &
+                           LED_BANK_NIBBLE_MASK];
+  uint32_t set_pins;
+
+  for (uint8_t port = 0; port < MAX_NUM_GPIO_PORTS; port++)
+  {
+    set_pins = low_pins[port] | high_pins[port];
+    g_gpio_ports[port]->DOUTSET31_0 = set_pins;
+    g_gpio_ports[port]->DOUTCLR31_0 = g_led_bank_pins[port] & ~set_pins;
+  } /* for */
+
+} /* leds_on */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function builds the LED bank tables used by leds_on() and
+//    seg7_off() from led_config_data and enable_controls. For each nibble
+//    of a bank value and each of its 16 values it stores the LED pins to
+//    drive high on each port: an active high LED that is on, or an active
+//    low LED that is off.
+//
+// INPUT PARAMETERS:
+//    none
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    none
+// -----------------------------------------------------------------------------
+static void leds_bank_build(void)
+{
+  uint8_t  port;
+  uint8_t  nibble;
+  uint8_t  bit;
+
+  memset(g_led_bank_high, 0, sizeof(g_led_bank_high));
+  memset(g_led_bank_pins, 0, sizeof(g_led_bank_pins));
+  memset(g_seg7_enable_pins, 0, sizeof(g_seg7_enable_pins));
 
   for (uint8_t led_idx = 0; led_idx < MAX_NUM_LEDS; led_idx++)
   {
-    if ((value & (1 << led_idx)) == (1 << led_idx))
-    {
-      if (led_config_data[led_idx].port_id == GPIO_PORTA)
-      {
-        if (led_config_data[led_idx].polarity == ACTIVE_HIGH)
-        {
-          GPIOA->DOUT31_0 |= led_config_data[led_idx].bit_mask;
-        } /* if */
-        else
-        {
-          GPIOA->DOUT31_0 &= ~led_config_data[led_idx].bit_mask;
-        } /* else */
-      } /* if */
-      else
-      {
-        if (led_config_data[led_idx].port_id == GPIO_PORTA)
-        {
-          GPIOB->DOUT31_0 |= led_config_data[led_idx].bit_mask;
-        } /* if */
-        else
-        {
-          GPIOB->DOUT31_0 &= ~led_config_data[led_idx].bit_mask;
-        } /* else */
-      } /* else */
-    } /* if */
-    else
+    port   = led_config_data[led_idx].port_id;
+    nibble = led_idx >> LED_BANK_IDX_SHIFT;
+    bit    = 1U << (led_idx & (LED_BANK_NIBBLE_SHIFT - 1));
+
+    g_led_bank_pins[port] |= led_config_data[led_idx].bit_mask;
+
+    for (uint8_t value = 0; value < LED_BANK_NIBBLE_VALUES; value++)
     {
-      if (led_config_data[led_idx].port_id == GPIO_PORTA)
-      {
-        if (led_config_data[led_idx].polarity == ACTIVE_HIGH)
-        {
-          GPIOA->DOUT31_0 &= ~led_config_data[led_idx].bit_mask;
-        } /* if */
-        else
-        {
-          GPIOA->DOUT31_0 |= led_config_data[led_idx].bit_mask;
-        } /* else */
-      } /* if */
-      else
-      {
-        if (led_config_data[led_idx].polarity == ACTIVE_HIGH)
-        {
-          GPIOB->DOUT31_0 &= ~led_config_data[led_idx].bit_mask;
-        } /* if */
-        else
-        {
-          GPIOB->DOUT31_0 |= led_config_data[led_idx].bit_mask;
-        } /* else */
-      } /* else */
-    } /* else */
+      g_led_bank_high[nibble][value][port] |= ((value & bit) != 0) ?
+            led_config_data[led_idx].active :
+            led_config_data[led_idx].inactive;
+    } /* for */
   } /* for */
 
-} /* leds_on */
+  for (uint8_t seg7_idx = 0; seg7_idx < MAX_NUM_SEG7_DISPLAYS; seg7_idx++)
+  {
+    g_seg7_enable_pins[enable_controls[seg7_idx].port_id] |=
+          enable_controls[seg7_idx].bit_mask;
+  } /* for */
+
+} /* leds_bank_build */
 
 //-----------------------------------------------------------------------------
 // DESCRIPTION:
 //    This function turns on a specified LED on the CSC202 Expansion Board
-//    based on the given index. It checks the configuration data to determine
-//    the port and polarity of the LED. If the LED is configured as active
-//    high, it sets the corresponding bit in the data output register to turn
-//    on the LED. If the LED is configured as active low, it clears the
-//    corresponding bit in the data output register.
+//    based on the given index. The LED descriptor holds the port and the
+//    pin masks for each level, so the LED is turned on with one DOUTSET
+//    and one DOUTCLR write (one of them writes 0) and no branches.
 //
 //     This function does not perform error checking to  verify that the
 //     led_idx parameter is valid entry into the led_config_data array.
@@ -710,29 +714,10 @@ void leds_on(uint32_t value)
 // -----------------------------------------------------------------------------
 void led_on(uint8_t led_idx)
 {
+  const gpio_struct *led = &led_config_data[led_idx];
 
-  if (led_config_data[led_idx].port_id == GPIO_PORTA)
-  {
-    if (led_config_data[led_idx].polarity == ACTIVE_HIGH)
-    {
-      GPIOA->DOUT31_0 |= led_config_data[led_idx].bit_mask;
-    } /* if */
-    else
-    {
-      GPIOA->DOUT31_0 &= ~led_config_data[led_idx].bit_mask;
-    } /* else */
-  } /* if */
-  else
-  {
-    if (led_config_data[led_idx].polarity == ACTIVE_HIGH)
-    {
-      GPIOB->DOUT31_0 |= led_config_data[led_idx].bit_mask;
-    } /* if */
-    else
-    {
-      GPIOB->DOUT31_0 &= ~led_config_data[led_idx].bit_mask;
-    } /* else */
-  } /* else */
+  led->port->DOUTSET31_0 = led->active;
+  led->port->DOUTCLR31_0 = led->inactive;
 
 } /* led_on */
 
@@ -740,11 +725,9 @@ void led_on(uint8_t led_idx)
 //-----------------------------------------------------------------------------
 // DESCRIPTION:
 //    This function turns off a specified LED on the CSC202 Expansion Board
-//    based on the given index. It checks the configuration data to determine
-//    the port and polarity of the LED. If the LED is configured as active
-//    high, it clears the corresponding bit in the data output register to turn
-//    off the LED. If the LED is configured as active low, it sets the
-//    corresponding bit in the data output register.
+//    based on the given index. The LED descriptor holds the port and the
+//    pin masks for each level, so the LED is turned off with one DOUTSET
+//    and one DOUTCLR write (one of them writes 0) and no branches.
 //
 //    This function does not perform error checking to verify that the
 //    led_idx parameter is a valid entry in the led_config_data array.
@@ -760,29 +743,10 @@ void led_on(uint8_t led_idx)
 // -----------------------------------------------------------------------------
 void led_off(uint8_t led_idx)
 {
+  const gpio_struct *led = &led_config_data[led_idx];
 
-  if (led_config_data[led_idx].port_id == GPIO_PORTA)
-  {
-    if (led_config_data[led_idx].polarity == ACTIVE_HIGH)
-    {
-      GPIOA->DOUT31_0 &= ~led_config_data[led_idx].bit_mask;
-    } /* if */
-    else
-    {
-      GPIOA->DOUT31_0 |= led_config_data[led_idx].bit_mask;
-    } /* else */
-  } /* if */
-  else
-  {
-    if (led_config_data[led_idx].polarity == ACTIVE_HIGH)
-    {
-      GPIOB->DOUT31_0 &= ~led_config_data[led_idx].bit_mask;
-    } /* if */
-    else
-    {
-      GPIOB->DOUT31_0 |= led_config_data[led_idx].bit_mask;
-    } /* else */
-  } /* else */
+  led->port->DOUTSET31_0 = led->inactive;
+  led->port->DOUTCLR31_0 = led->active;
 
 } /* led_off */
 
@@ -819,31 +783,19 @@ void seg7_init(void)
   {
     IOMUX->SECCFG.PINCM[led_config_data[idx].pin_cm] = gpio_pincm;
 
-    if (led_config_data[idx].port_id == GPIO_PORTA)
-    {
-      GPIOA->DOE31_0 |= led_config_data[idx].bit_mask;
-    } /* if */
-    else
-    {
-      GPIOB->DOE31_0 |= led_config_data[idx].bit_mask;
-    } /* else */
+    led_config_data[idx].port->DOE31_0 |= led_config_data[idx].bit_mask;
 
   }  /* for */
 
+  leds_bank_build();
   leds_off();
 
   for (uint8_t seg7_idx = 0; seg7_idx < 4; seg7_idx++)
   {
     IOMUX->SECCFG.PINCM[enable_controls[seg7_idx].pin_cm] = gpio_pincm;
 
-    if (enable_controls[seg7_idx].port_id == GPIO_PORTA)
-    {
-      GPIOA->DOE31_0 |= enable_controls[seg7_idx].bit_mask;
-    } /* if */
-    else
-    {
-      GPIOB->DOE31_0 |= enable_controls[seg7_idx].bit_mask;
-    } /* else */
+    enable_controls[seg7_idx].port->DOE31_0 |=
+      enable_controls[seg7_idx].bit_mask;
   }  /* for */
 
   seg7_off();
@@ -877,14 +829,7 @@ void seg7_deinit(void)
   {
     IOMUX->SECCFG.PINCM[led_config_data[idx].pin_cm] = gpio_pincm;
 
-    if (led_config_data[idx].port_id == GPIO_PORTA)
-    {
-      GPIOA->DOE31_0 |= led_config_data[idx].bit_mask;
-    } /* if */
-    else
-    {
-      GPIOB->DOE31_0 |= led_config_data[idx].bit_mask;
-    } /* else */
+    led_config_data[idx].port->DOE31_0 |= led_config_data[idx].bit_mask;
 
   }  /* for */
 
@@ -892,14 +837,8 @@ void seg7_deinit(void)
   {
     IOMUX->SECCFG.PINCM[enable_controls[seg7_idx].pin_cm] = gpio_pincm;
 
-    if (enable_controls[seg7_idx].port_id == GPIO_PORTA)
-    {
-      GPIOA->DOE31_0 &= ~enable_controls[seg7_idx].bit_mask;
-    } /* if */
-    else
-    {
-      GPIOB->DOE31_0 &= ~enable_controls[seg7_idx].bit_mask;
-    } /* else */
+    enable_controls[seg7_idx].port->DOE31_0 &=
+      ~enable_controls[seg7_idx].bit_mask;
   }  /* for */
 } /* seg7_deinit */
 
@@ -907,10 +846,9 @@ void seg7_deinit(void)
 //-----------------------------------------------------------------------------
 // DESCRIPTION:
 //    This function enables a specified 7-segment display digit on the
-//    CSC202 Expansion Board based on the given index. It checks the
-//    configuration data to determine the port for the 7-segment display
-//    digit. The function sets the corresponding bit in the data output
-//    register to enable the digit.
+//    CSC202 Expansion Board based on the given index. The enable
+//    descriptor holds the port and the pin mask, so the digit is enabled
+//    with one DOUTSET write.
 //
 // INPUT PARAMETERS:
 //    seg7_idx - A 8-bit index of the 7-segment display digit to be enabled.
@@ -923,18 +861,61 @@ void seg7_deinit(void)
 // -----------------------------------------------------------------------------
 void seg7_dig_enable(uint8_t seg7_idx)
 {
-  if (enable_controls[seg7_idx].port_id == GPIO_PORTA)
-  {
-    GPIOA->DOUT31_0 |= enable_controls[seg7_idx].bit_mask;
-  } /* if */
-  else
-  {
-    GPIOB->DOUT31_0 |= enable_controls[seg7_idx].bit_mask;
-  } /* else */
+  enable_controls[seg7_idx].port->DOUTSET31_0 =
+        enable_controls[seg7_idx].active;
 
 } /* seg7_dig_enable */
 
 
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function returns the port writes that show a value on the LED
+//    bank with one enable (digit or LED bar) on and all the others off,
+//    without writing them. A service that refreshes the display from an
+//    interrupt can build its writes ahead of time with it. Write clr_pins
+//    to DOUTCLR31_0 and then set_pins to DOUTSET31_0 of each port.
+//
+//    The pins must be set up with leds_init() and seg7_init() first.
+//
+// INPUT PARAMETERS:
+//    value      - LED bank value, bit n lights LED n (segment n)
+//    enable_idx - enable to turn on, SEG7_DIGn_ENABLE_IDX or
+//                 LED_BAR_ENABLE_IDX
+//
+// OUTPUT PARAMETERS:
+//    set_pins - pins to drive high on each port (MAX_NUM_GPIO_PORTS)
+//    clr_pins - pins to drive low on each port (MAX_NUM_GPIO_PORTS)
+//
+// RETURN:
+//    none
+// -----------------------------------------------------------------------------
+void seg7_port_masks(uint8_t value, uint8_t enable_idx, uint32_t set_pins[],
+     uint32_t clr_pins[])
+{
+  const uint32_t *low_pins  =
+        g_led_bank_high[0][value & LED_BANK_NIBBLE_MASK];
+  const uint32_t *high_pins =
+        g_led_bank_high[1][(value >> LED_BANK_NIBBLE_SHIFT) &
+                           LED_BANK_NIBBLE_MASK];
+
+  for (uint8_t port = 0; port < MAX_NUM_GPIO_PORTS; port++)
+  {
+    set_pins[port] = low_pins[port] | high_pins[port];
+    clr_pins[port] = (g_led_bank_pins[port] & ~set_pins[port]) |
+                     g_seg7_enable_pins[port];
+  } /* for */
+
+  clr_pins[enable_controls[LED_BAR_ENABLE_IDX].port_id] |=
+        enable_controls[LED_BAR_ENABLE_IDX].bit_mask;
+
+  set_pins[enable_controls[enable_idx].port_id] |=
+        enable_controls[enable_idx].bit_mask;
+  clr_pins[enable_controls[enable_idx].port_id] &=
+        ~enable_controls[enable_idx].bit_mask;
+
+} /* seg7_port_masks */
+
+
 //-----------------------------------------------------------------------------
 // DESCRIPTION:
 //    This function turns off all digits of the 7-segment display on the
@@ -954,17 +935,10 @@ void seg7_dig_enable(uint8_t seg7_idx)
 // -----------------------------------------------------------------------------
 void seg7_off(void)
 {
-  for (uint8_t seg7_idx = 0; seg7_idx < 4; seg7_idx++)
+  for (uint8_t port = 0; port < MAX_NUM_GPIO_PORTS; port++)
   {
-    if (enable_controls[seg7_idx].port_id == GPIO_PORTA)
-    {
-      GPIOA->DOUT31_0 &= ~enable_controls[seg7_idx].bit_mask;
-    } /* if */
-    else
-    {
-      GPIOB->DOUT31_0 &= ~enable_controls[seg7_idx].bit_mask;
-    } /* else */
-  }
+    g_gpio_ports[port]->DOUTCLR31_0 = g_seg7_enable_pins[port];
+  } /* for */
 } /* seg7_off */
 
 
@@ -992,10 +966,12 @@ void seg7_off(void)
 // -----------------------------------------------------------------------------
 void seg7_on(uint8_t value, uint8_t seg7_idx)
 {
-  leds_on(value);
-
+  // Turn the digits off first so the new segments never show on the
+  // digit that was enabled before
   seg7_off();
 
+  leds_on(value);
+
   seg7_dig_enable(seg7_idx);
 
 } /* seg7_on */
@@ -1115,27 +1091,9 @@ void lpsw_deinit(void)
 // -----------------------------------------------------------------------------
 bool is_lpsw_down(uint8_t sw_idx)
 {
-  bool sw_status = false;
-  uint8_t sw_value = 0;
-
-  if (lp_switch_config_data[sw_idx].port_id == GPIO_PORTA)
-  {
-    sw_value = ((GPIOA->DIN31_0 & lp_switch_config_data[sw_idx].bit_mask) ==
-                  lp_switch_config_data[sw_idx].bit_mask);
-  } /* if */
-  else
-  {
-    sw_value = ((GPIOB->DIN31_0 & lp_switch_config_data[sw_idx].bit_mask) ==
-                  lp_switch_config_data[sw_idx].bit_mask);
-  } /* else */
-
-  // Assumes 1 is returned when switch pressed - regardless of switch polarity
-  if (sw_value == 0x01)
-  {
-    sw_status = true;
-  } /* if */
+  const gpio_struct *sw = &lp_switch_config_data[sw_idx];
 
-  return (sw_status);
+  return ((sw->port->DIN31_0 & sw->bit_mask) == sw->active);
 
 } /* is_lpsw_down */
 
@@ -1157,29 +1115,33 @@ bool is_lpsw_down(uint8_t sw_idx)
 // -----------------------------------------------------------------------------
 bool is_lpsw_up(uint8_t sw_idx)
 {
-  bool sw_status = false;
-  uint8_t sw_value = 0;
+  const gpio_struct *sw = &lp_switch_config_data[sw_idx];
 
-  if (lp_switch_config_data[sw_idx].port_id == GPIO_PORTA)
-  {
-    sw_value = ((GPIOA->DIN31_0 & lp_switch_config_data[sw_idx].bit_mask) ==
-                lp_switch_config_data[sw_idx].bit_mask);
-  } /* if */
-  else
-  {
-    sw_value = ((GPIOB->DIN31_0 & lp_switch_config_data[sw_idx].bit_mask) ==
-                  lp_switch_config_data[sw_idx].bit_mask);
-  } /* else */
+  return ((sw->port->DIN31_0 & sw->bit_mask) != sw->active);
 
-  // Assumes 1 is returned when the switch pressed - regardless of switch polarity
-  if (sw_value != 0x1)
-  {
-    sw_status = true;
-  } /* if */
+} /* is_lpsw_up */
 
-  return (sw_status);
 
-} /* is_lpsw_up */
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function returns the port and pin of a LaunchPad switch, so a
+//    service that samples all the inputs with one read of each port can
+//    find its pin.
+//
+// INPUT PARAMETERS:
+//    sw_idx - switch index (LP_SW1_IDX or LP_SW2_IDX)
+//
+// OUTPUT PARAMETERS:
+//    port_id - GPIO_PORTA or GPIO_PORTB
+//
+// RETURN:
+//    bit mask of the pin in the port
+// -----------------------------------------------------------------------------
+uint32_t lpsw_port_mask(uint8_t sw_idx, uint8_t *port_id)
+{
+  *port_id = lp_switch_config_data[sw_idx].port_id;
+  return (lp_switch_config_data[sw_idx].bit_mask);
+} /* lpsw_port_mask */
 
 
 //-----------------------------------------------------------------------------
@@ -1261,34 +1223,46 @@ void dipsw_deinit(void)
 // -----------------------------------------------------------------------------
 uint8_t dipsw_read(void)
 {
-  uint8_t switch_value = 0;
+  const gpio_struct *sw;
   uint8_t dip_value = 0;
 
   for (uint8_t sw_idx = 0; sw_idx < MAX_NUM_DIPSW; sw_idx++)
   {
-    if (dip_switch_config_data[sw_idx].port_id == GPIO_PORTA)
-    {
-      switch_value = ((GPIOA->DIN31_0 & dip_switch_config_data[sw_idx].bit_mask) ==
-                       dip_switch_config_data[sw_idx].bit_mask);
-      dip_value |= switch_value << (MAX_NUM_DIPSW-1-sw_idx);
-    } /* if */
-    else
-    {
-      switch_value = ((GPIOB->DIN31_0 & dip_switch_config_data[sw_idx].bit_mask) ==
-                       dip_switch_config_data[sw_idx].bit_mask);
-      dip_value |= switch_value << (MAX_NUM_DIPSW-1-sw_idx);
-    } /* else */
-
+    sw = &dip_switch_config_data[sw_idx];
+    dip_value |= ((sw->port->DIN31_0 & sw->bit_mask) == sw->active) <<
+                 (MAX_NUM_DIPSW - 1 - sw_idx);
   }  /* for */
 
   return (dip_value);
 
 } /* dipsw_read */
 
+
 //-----------------------------------------------------------------------------
 // DESCRIPTION:
-//    This function reads the current state of the pushbuttons on the CSC202
-//    Expansion Board and returns TRUE if the button is down.
+//    This function returns the port and pin of a DIP switch or pushbutton
+//    on the CSC202 Expansion Board, so a service that samples all the
+//    inputs with one read of each port can find its pin.
+//
+// INPUT PARAMETERS:
+//    sw_idx - switch index (DIP_SWn_IDX or PBn_IDX)
+//
+// OUTPUT PARAMETERS:
+//    port_id - GPIO_PORTA or GPIO_PORTB
+//
+// RETURN:
+//    bit mask of the pin in the port
+// -----------------------------------------------------------------------------
+uint32_t dipsw_port_mask(uint8_t sw_idx, uint8_t *port_id)
+{
+  *port_id = dip_switch_config_data[sw_idx].port_id;
+  return (dip_switch_config_data[sw_idx].bit_mask);
+} /* dipsw_port_mask */
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function reads the current state of the pushbuttons on the CSC202
+//    Expansion Board and returns TRUE if the button is down.
 //
 // INPUT PARAMETERS:
 //    pb_idx - an 8-bit value that represents the pushbutton index
@@ -1302,27 +1276,9 @@ uint8_t dipsw_read(void)
 // -----------------------------------------------------------------------------
 bool is_pb_down(uint8_t pb_idx)
 {
-  bool pb_status = false;
-  uint8_t pb_value = 0;
+  const gpio_struct *pb = &dip_switch_config_data[pb_idx];
 
-  if (dip_switch_config_data[pb_idx].port_id == GPIO_PORTA)
-  {
-    pb_value = ((GPIOA->DIN31_0 & dip_switch_config_data[pb_idx].bit_mask) ==
-                  dip_switch_config_data[pb_idx].bit_mask);
-  } /* if */
-  else
-  {
-    pb_value = ((GPIOB->DIN31_0 & dip_switch_config_data[pb_idx].bit_mask) ==
-                  dip_switch_config_data[pb_idx].bit_mask);
-  } /* else */
-
-  // IOMUX has inversion enabled, so used !polarity
-  if (pb_value != dip_switch_config_data[pb_idx].polarity)
-  {
-    pb_status = true;
-  }
-
-  return (pb_status);
+  return ((pb->port->DIN31_0 & pb->bit_mask) == pb->active);
 
 } /* is_pb_down */
 
@@ -1344,27 +1300,9 @@ bool is_pb_down(uint8_t pb_idx)
 // -----------------------------------------------------------------------------
 bool is_pb_up(uint8_t pb_idx)
 {
-  bool pb_status = false;
-  uint8_t pb_value = 0;
+  const gpio_struct *pb = &dip_switch_config_data[pb_idx];
 
-  if (dip_switch_config_data[pb_idx].port_id == GPIO_PORTA)
-  {
-    pb_value = ((GPIOA->DIN31_0 & dip_switch_config_data[pb_idx].bit_mask) ==
-                dip_switch_config_data[pb_idx].bit_mask);
-  } /* if */
-  else
-  {
-    pb_value = ((GPIOB->DIN31_0 & dip_switch_config_data[pb_idx].bit_mask) ==
-                  dip_switch_config_data[pb_idx].bit_mask);
-  } /* else */
-
-  // IOMUX has inversion enabled, so used polarity
-  if (pb_value == dip_switch_config_data[pb_idx].polarity)
-  {
-    pb_status = true;
-  }
-
-  return (pb_status);
+  return ((pb->port->DIN31_0 & pb->bit_mask) != pb->active);
 
 } /* is_pb_up */
 
@@ -1393,10 +1331,10 @@ void  dipsw_filter_enable(void)
   // SW2 is PA22
   GPIOA->FILTEREN31_16 |= GPIO_FILTEREN31_16_DIN22_EIGHT_CYCLE;
   
-  // PB1 is PB18
+  // SW3 (PB1) is PB18
   GPIOB->FILTEREN31_16 |= GPIO_FILTEREN31_16_DIN18_EIGHT_CYCLE;
   
-  // SW2 is PA22
+  // SW4 (PB2) is PA15
   GPIOA->FILTEREN15_0 |= GPIO_FILTEREN15_0_DIN15_EIGHT_CYCLE;
   
   // for (uint8_t sw_idx = 0; sw_idx < MAX_NUM_DIPSW; sw_idx++)
@@ -1415,9 +1353,34 @@ void  dipsw_filter_enable(void)
 } /* dipsw_filter_enable */
 
 
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function disables the GPIO filter for the switches enabled by
+//    dipsw_filter_enable().
+//
+// INPUT PARAMETERS:
+//    none
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    none
+// -----------------------------------------------------------------------------
 void  dipsw_filter_disable(void)
 {
-  
+  // SW1 is PB19
+  GPIOB->FILTEREN31_16 &= ~GPIO_FILTEREN31_16_DIN19_MASK;
+
+  // SW2 is PA22
+  GPIOA->FILTEREN31_16 &= ~GPIO_FILTEREN31_16_DIN22_MASK;
+
+  // SW3 (PB1) is PB18
+  GPIOB->FILTEREN31_16 &= ~GPIO_FILTEREN31_16_DIN18_MASK;
+
+  // SW4 (PB2) is PA15
+  GPIOA->FILTEREN15_0 &= ~GPIO_FILTEREN15_0_DIN15_MASK;
+
 } /* dipsw_filter_disable */
 
 //***************************************************************************
@@ -1458,20 +1421,56 @@ void keypad_init(void)
   for (uint8_t index = 0; index < MAX_NUM_KP_COLS; index++)
   {
     IOMUX->SECCFG.PINCM[kp_col_config_data[index].pin_cm] = gpio_kp_cols;
-    if (kp_col_config_data[index].port_id == GPIO_PORTA)
-    {
-        GPIOA->DOE31_0 |= kp_col_config_data[index].bit_mask;
-    } /* if */
-    else
-    {
-        GPIOB->DOE31_0 |= kp_col_config_data[index].bit_mask;
-    } /* for */
+    kp_col_config_data[index].port->DOE31_0 |=
+      kp_col_config_data[index].bit_mask;
 
   }  /* for */
 
+  memset(g_kp_col_pins, 0, sizeof(g_kp_col_pins));
+  for (uint8_t col = 0; col < MAX_NUM_KP_COLS; col++)
+  {
+    g_kp_col_pins[kp_col_config_data[col].port_id] |=
+          kp_col_config_data[col].bit_mask;
+  } /* for */
+
+  for (uint8_t key = 0; key < MAX_NUM_KEYPAD_KEYS; key++)
+  {
+    g_kp_matrix_keys[
+          (keypad_code_line(keycodes[key]) * MAX_NUM_KP_ROWS) +
+          keypad_code_line(keycodes[key] >> KP_CODE_ROW_SHIFT)] = key;
+  } /* for */
+
 } /* keypad_init */
 
 
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function returns all the keypad row pins of each port, taken
+//    from kp_row_config_data. A driver that clears or registers the row
+//    interrupts a port at a time can use it.
+//
+// INPUT PARAMETERS:
+//    none
+//
+// OUTPUT PARAMETERS:
+//    row_pins - row pins of each port (MAX_NUM_GPIO_PORTS)
+//
+// RETURN:
+//    none
+// -----------------------------------------------------------------------------
+void keypad_row_masks(uint32_t row_pins[])
+{
+  memset(row_pins, 0, MAX_NUM_GPIO_PORTS * sizeof(row_pins[0]));
+
+  for (uint8_t row = 0; row < MAX_NUM_KP_ROWS; row++)
+  {
+    row_pins[kp_row_config_data[row].port_id] |=
+          kp_row_config_data[row].bit_mask;
+  } /* for */
+
+} /* keypad_row_masks */
+
+
 //-----------------------------------------------------------------------------
 // DESCRIPTION:
 //    This function de-configures the keypad matrix on the CSC202 Expansion
@@ -1502,14 +1501,8 @@ void keypad_deinit(void)
   for (uint8_t index = 0; index < MAX_NUM_KP_COLS; index++)
   {
     IOMUX->SECCFG.PINCM[kp_col_config_data[index].pin_cm] = gpio_kp_cols;
-    if (kp_col_config_data[index].port_id == GPIO_PORTA)
-    {
-        GPIOA->DOE31_0 |= kp_col_config_data[index].bit_mask;
-    } /* if */
-    else
-    {
-        GPIOB->DOE31_0 |= kp_col_config_data[index].bit_mask;
-    } /* for */
+    kp_col_config_data[index].port->DOE31_0 |=
+      kp_col_config_data[index].bit_mask;
 
   }  /* for */
 
@@ -1539,23 +1532,13 @@ void keypad_deinit(void)
 // -----------------------------------------------------------------------------
 uint8_t read_keyrow_data(void)
 {
+  const gpio_struct *row;
   uint8_t data = 0x00;
-  uint8_t bit  = 0x00;
 
   for (uint8_t row_num = 0; row_num < MAX_NUM_KP_ROWS; row_num++)
   {
-    if (kp_row_config_data[row_num].port_id == GPIO_PORTA)
-    {
-      bit  = (GPIOA->DIN31_0 & kp_row_config_data[row_num].bit_mask) == 
-              kp_row_config_data[row_num].bit_mask;
-      data |= (bit << row_num);
-    } /* if */
-    else
-    {
-      bit  = (GPIOB->DIN31_0 & kp_row_config_data[row_num].bit_mask) == 
-              kp_row_config_data[row_num].bit_mask;
-      data |= (bit << row_num);
-    } /* else */
+    row = &kp_row_config_data[row_num];
+    data |= ((row->port->DIN31_0 & row->bit_mask) == row->active) << row_num;
   } /* for */
 
   return (data);
@@ -1584,39 +1567,109 @@ uint8_t read_keyrow_data(void)
 // -----------------------------------------------------------------------------
 void write_keycol_data(uint8_t data)
 {
-  uint8_t mask = 0x01;
-  uint8_t bit  = 0x00;
+  const gpio_struct *col;
+  uint32_t level;
 
   for (uint8_t col_num = 0; col_num < MAX_NUM_KP_COLS; col_num++)
   {
-    bit = (data & mask) >> col_num;
-    mask <<= 1;
-    if (kp_col_config_data[col_num].port_id == GPIO_PORTA)
+    // All ones when the column is driven high, otherwise 0
+    level = 0U - ((data >> col_num) & 0x01);
+    col   = &kp_col_config_data[col_num];
+    col->port->DOUTSET31_0 = col->bit_mask & level;
+    col->port->DOUTCLR31_0 = col->bit_mask & ~level;
+  } /* for */
+} /* write_keycol_data */
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function reads the state of every key of the keypad matrix on the
+//    CSC202 Expansion Board. Each column is driven low in turn (the others
+//    high) and the rows of both ports are read at once, so a full scan is
+//    4 column steps. When it returns all the columns are driven low, so a
+//    key press pulls its row low.
+//
+//    NOTE: The keypad has no diodes. With 3 keys on the corners of a
+//          rectangle pressed, the key on the fourth corner reads as
+//          pressed too.
+//
+// INPUT PARAMETERS:
+//    none
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    uint16_t - bit (col * MAX_NUM_KP_ROWS + row) is set when the key in
+//               that column and row is pressed. keypad_matrix_key() gives
+//               the keycodes index of a bit.
+// -----------------------------------------------------------------------------
+uint16_t keypad_read_matrix(void)
+{
+  uint32_t din[MAX_NUM_GPIO_PORTS];
+  uint16_t matrix = 0;
+  uint8_t  bit = 0;
+
+  for (uint8_t col = 0; col < MAX_NUM_KP_COLS; col++)
+  {
+    for (uint8_t port = 0; port < MAX_NUM_GPIO_PORTS; port++)
     {
-      GPIOA->DOUT31_0 &= ~kp_col_config_data[col_num].bit_mask;
-      if (bit)
-      {
-        GPIOA->DOUT31_0 |= kp_col_config_data[col_num].bit_mask;
-      } /* IF */
-    } /* if */
-    else
+      g_gpio_ports[port]->DOUTSET31_0 = g_kp_col_pins[port];
+    } /* for */
+    kp_col_config_data[col].port->DOUTCLR31_0 =
+          kp_col_config_data[col].bit_mask;
+
+    clock_delay(KP_COL_SETTLE_CYCLES);
+
+    for (uint8_t port = 0; port < MAX_NUM_GPIO_PORTS; port++)
     {
-      GPIOB->DOUT31_0 &= ~kp_col_config_data[col_num].bit_mask;
-      if (bit)
+      din[port] = g_gpio_ports[port]->DIN31_0;
+    } /* for */
+
+    for (uint8_t row = 0; row < MAX_NUM_KP_ROWS; row++, bit++)
+    {
+      if ((din[kp_row_config_data[row].port_id] &
+           kp_row_config_data[row].bit_mask) == 0)
       {
-        GPIOB->DOUT31_0 |= kp_col_config_data[col_num].bit_mask;
-      } /* IF */
-    } /* else */
+        matrix |= (1U << bit);
+      } /* if */
+    } /* for */
   } /* for */
-} /* write_keycol_data */
+
+  for (uint8_t port = 0; port < MAX_NUM_GPIO_PORTS; port++)
+  {
+    g_gpio_ports[port]->DOUTCLR31_0 = g_kp_col_pins[port];
+  } /* for */
+
+  return (matrix);
+
+} /* keypad_read_matrix */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function returns the index in the `keycodes` array of the key
+//    for a bit of the value returned by keypad_read_matrix().
+//
+// INPUT PARAMETERS:
+//    bit - bit of the matrix, 0 to MAX_NUM_KEYPAD_KEYS - 1
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    uint8_t - index of the key in the `keycodes` array
+// -----------------------------------------------------------------------------
+uint8_t keypad_matrix_key(uint8_t bit)
+{
+  return (g_kp_matrix_keys[bit]);
+} /* keypad_matrix_key */
+
 
 //-----------------------------------------------------------------------------
 // DESCRIPTION:
 //    This function scans the keypad matrix on the CSC202 Expansion Board to
-//    detect which key is currently pressed. It sequentially drives each column
-//    and reads the state of the rows to determine if a keypress corresponds to
-//    any of the defined keycodes. It returns the index of the pressed key, or
-//    if no key is pressed, it returns the index of the next key to be checked.
+//    detect which key is currently pressed. The whole matrix is read with
+//    keypad_read_matrix() and the first pressed key found is returned.
 //
 // INPUT PARAMETERS:
 //    none
@@ -1626,37 +1679,55 @@ void write_keycol_data(uint8_t data)
 //
 // RETURN:
 //    uint8_t - The index of the key that is pressed, which corresponds to the
-//             key's position in the `keycodes` array. If no key is pressed, it
-//             returns the index of the next key to be checked (in the range
-//             0 to 15). If no key is detected, the return value will be 0x10,
-//             indicating that no key is pressed.
+//             key's position in the `keycodes` array. If no key is pressed,
+//             the return value will be NO_KEY_PRESSED (0x10).
 // -----------------------------------------------------------------------------
 uint8_t keypad_scan(void)
 {
-  uint8_t found = false;
-  uint8_t data  = 0x00;
-  uint8_t key   = 0;
+  uint16_t matrix = keypad_read_matrix();
+  uint8_t  key    = NO_KEY_PRESSED;
 
-  for (key = 0; ((key < MAX_NUM_KEYPAD_KEYS) && !found); )
+  for (uint8_t bit = 0; (bit < MAX_NUM_KEYPAD_KEYS) && (matrix != 0); bit++)
   {
-      write_keycol_data(keycodes[key]);
-      data = read_keyrow_data();
-
-      // Extract upper nibble and shift to lower nibble before comparing 
-      if (data == (keycodes[key] & 0xF0) >> 4)
-      {
-          found = true;
-      } /* if */
-      else
-      {
-          key++;
-      } /* else */
+    if ((matrix & (1U << bit)) != 0)
+    {
+      key    = g_kp_matrix_keys[bit];
+      matrix = 0;
+    } /* if */
   } /* for */
 
   return (key);
 } /* keypad_scan */
 
 
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function returns the column or row of a key code nibble, the
+//    position of its 0 bit.
+//
+// INPUT PARAMETERS:
+//    pattern - column pattern (low nibble) or row pattern of a key code
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    uint8_t - the column or row number
+// -----------------------------------------------------------------------------
+static uint8_t keypad_code_line(uint8_t pattern)
+{
+  uint8_t line = 0;
+
+  while ((line < MAX_NUM_KP_COLS) && ((pattern & (1U << line)) != 0))
+  {
+    line++;
+  } /* while */
+
+  return (line & (MAX_NUM_KP_COLS - 1));
+
+} /* keypad_code_line */
+
+
 //-----------------------------------------------------------------------------
 // DESCRIPTION:
 //    This function waits here for a key to be pressed on the keypad matrix. 
@@ -1785,6 +1856,10 @@ void I2C_mstr_init(void)
 
   // Configuration done, enable IIC
   I2C_INST->MASTER.MCR |= I2C_MCR_ACTIVE_ENABLE;
+
+  // Used to measure the latency of each transaction
+  cycle_counter_init();
+
 } /* I2C_mstr_init */
 
 
@@ -1858,7 +1933,7 @@ uint32_t static I2C_fill_tx_fifo(uint8_t *buffer, uint16_t count)
 //    I2C_ERR_ARB_LOST - if arbitration was lost during the transfer.
 //    I2C_ERR_NACK     - if the slave did not acknowledge the transfer.
 // -----------------------------------------------------------------------------
-static uint32_t I2C_mstr_send_internal(uint8_t slave, uint8_t data[], 
+static uint32_t I2C_mstr_send_xfer(uint8_t slave, uint8_t data[], 
           uint8_t length, i2c_burst_type_t i2c_type)
 {
   uint32_t ret_status = I2C_SUCCESS;
@@ -1966,6 +2041,45 @@ static uint32_t I2C_mstr_send_internal(uint8_t slave, uint8_t data[],
 
   return (ret_status);
 
+} /* I2C_mstr_send_xfer */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function performs an I2C write using I2C_mstr_send_xfer and keeps
+//    the health statistics for the slave device. If the transfer timed out
+//    the bus is recovered so that a stuck slave does not cause every later
+//    transfer to time out as well.
+//
+// INPUT PARAMETERS:
+//    slave    - The 7-bit address of the I2C slave device to which data is 
+//               sent.
+//
+//    data     - Pointer to a buffer of data to be transmitted.
+//
+//    length   - The number of bytes (max 8) to transmit. 
+//
+//    i2c_type - The type of burst (normal, start, continue or end).
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    I2C_SUCCESS      - if the read operation completed successfully.
+//    I2C_ERR_TIMEOUT  - if the I2C controller did not become idle in time.
+//    I2C_ERR_ARB_LOST - if arbitration was lost during the transfer.
+//    I2C_ERR_NACK     - if the slave did not acknowledge the transfer.
+// -----------------------------------------------------------------------------
+static uint32_t I2C_mstr_send_internal(uint8_t slave, uint8_t data[], 
+          uint8_t length, i2c_burst_type_t i2c_type)
+{
+  uint32_t start_cycles = cycle_counter_get();
+  uint32_t ret_status = I2C_mstr_send_xfer(slave, data, length, i2c_type);
+
+  I2C_mstr_xfer_done(slave, ret_status, start_cycles);
+
+  return (ret_status);
+
 } /* I2C_mstr_send_internal */
 
 
@@ -2135,6 +2249,134 @@ uint32_t I2C_mstr_send_end(uint8_t slave, uint8_t data[], uint8_t length)
   return I2C_mstr_send_internal(slave, data, length, I2C_END);
 } /* I2C_mstr_send_continue */
 
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function sends a long burst of bytes to a specified I2C slave
+//    device in a single transaction (one START, one address, one STOP).
+//    Unlike I2C_mstr_send it is not limited to the 8 byte TX FIFO: the FIFO
+//    is loaded before the burst starts and then topped up by polling while
+//    the controller shifts the bytes out.
+//
+//    Devices such as the PCF8574 latch every received byte, so one stream
+//    can carry a whole sequence of pin changes with the bus providing the
+//    time between them.
+//
+// INPUT PARAMETERS:
+//    slave   - The 7-bit address of the I2C slave device to which data is sent.
+//
+//    data    - Pointer to an array of bytes to transmit to the slave device.
+//
+//    length  - The number of bytes (1 to 4095) to transmit.
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    I2C_SUCCESS         - if the transmission completed successfully.
+//    I2C_FIFO_LOAD_ERROR - if the length is not valid.
+//    I2C_ERR_TIMEOUT     - if the I2C controller did not become idle in time.
+//    I2C_ERR_ARB_LOST    - if arbitration was lost during the transfer.
+//    I2C_ERR_NACK        - if the slave did not acknowledge the transfer.
+//-----------------------------------------------------------------------------
+uint32_t I2C_mstr_send_stream(uint8_t slave, const uint8_t data[],
+         uint16_t length)
+{
+  uint32_t start_cycles = cycle_counter_get();
+  uint32_t ret_status = I2C_SUCCESS;
+  uint32_t timeout = I2C_TIMEOUT_COUNT;
+  uint16_t index = 0;
+
+  if ((length == 0) || (length > (I2C_MCTR_MBLEN_MASK >> I2C_MCTR_MBLEN_OFS)))
+  {
+    return I2C_FIFO_LOAD_ERROR;
+  } /* if */
+
+  // Before we start, ensure I2C controller idle (IDLE bit = 1)
+  while ((I2C1->MASTER.MSR & I2C_MSR_IDLE_MASK) == I2C_MSR_IDLE_CLEARED)
+  {
+    if (--timeout == 0)
+    {
+      I2C_mstr_xfer_done(slave, I2C_ERR_TIMEOUT, start_cycles);
+      return I2C_ERR_TIMEOUT;
+    } /* if */
+    usec_delay(10);
+  } /* while */
+
+  // Flush the TX FIFO then preload as many bytes as it holds
+  I2C1->MASTER.MFIFOCTL |= I2C_MFIFOCTL_TXFLUSH_FLUSH;
+  while ((I2C1->MASTER.MFIFOSR & I2C_MFIFOSR_TXFIFOCNT_MASK) != 
+          I2C_MFIFOSR_TXFIFOCNT_MAXIMUM);
+  I2C1->MASTER.MFIFOCTL &= ~I2C_MFIFOCTL_TXFLUSH_MASK;
+
+  while ((index < length) &&
+         ((I2C1->MASTER.MFIFOSR & I2C_MFIFOSR_TXFIFOCNT_MASK) != 0))
+  {
+    I2C1->MASTER.MTXDATA = data[index++];
+  } /* while */
+
+  // Set the slave address and start the whole burst with START and STOP
+  I2C1->MASTER.MSA = (slave << I2C_MSA_SADDR_OFS) | I2C_MSA_DIR_TRANSMIT;
+  I2C1->MASTER.MCTR = (I2C_MCTR_ACK_DISABLE | I2C_MCTR_START_ENABLE |
+                      I2C_MCTR_STOP_ENABLE | I2C_MCTR_BURSTRUN_ENABLE |
+                      ((length << I2C_MCTR_MBLEN_OFS) & I2C_MCTR_MBLEN_MASK));
+
+  // Keep the FIFO topped up while the controller is sending
+  timeout = I2C_TIMEOUT_COUNT;
+  while ((index < length) && (ret_status == I2C_SUCCESS))
+  {
+    if ((I2C1->MASTER.MFIFOSR & I2C_MFIFOSR_TXFIFOCNT_MASK) != 0)
+    {
+      I2C1->MASTER.MTXDATA = data[index++];
+      timeout = I2C_TIMEOUT_COUNT;
+    }
+    else if ((I2C1->MASTER.MSR & (I2C_MSR_ERR_MASK | I2C_MSR_ARBLST_MASK))
+              != 0)
+    {
+      // slave NACKed or arbitration lost, the controller stops the burst
+      break;
+    }
+    else if (--timeout == 0)
+    {
+      ret_status = I2C_ERR_TIMEOUT;
+    }
+    else
+    {
+      usec_delay(1);
+    } /* if */
+  } /* while */
+
+  // wait until I2C controller FSM is not busy or we timeout
+  timeout = I2C_TIMEOUT_COUNT;
+  while ((ret_status == I2C_SUCCESS) &&
+         ((I2C1->MASTER.MSR & I2C_MSR_BUSY_MASK) == I2C_MSR_BUSY_SET))
+  {
+    if (--timeout == 0)
+    {
+      ret_status = I2C_ERR_TIMEOUT;
+    } /* if */
+    usec_delay(10);
+  } /* while */
+
+  if (ret_status == I2C_SUCCESS)
+  {
+    // check for error or if lost arbitration or no ack
+    if ((I2C1->MASTER.MSR & I2C_MSR_ARBLST_MASK) == I2C_MSR_ARBLST_SET)
+    {
+      ret_status = I2C_ERR_ARB_LOST;
+    } /* if */
+    else if ((I2C1->MASTER.MSR & I2C_MSR_ERR_MASK) == I2C_MSR_ERR_SET)
+    {
+      ret_status = I2C_ERR_NACK;
+    } /* else */
+  } /* if */
+
+  I2C_mstr_xfer_done(slave, ret_status, start_cycles);
+
+  return (ret_status);
+
+} /* I2C_mstr_send_stream */
+
 //-----------------------------------------------------------------------------
 // DESCRIPTION:
 //    This function reads up to 8 bytes of data from a specified I2C slave device.
@@ -2168,7 +2410,7 @@ uint32_t I2C_mstr_send_end(uint8_t slave, uint8_t data[], uint8_t length)
 //    I2C_ERR_ARB_LOST - if arbitration was lost during the transfer.
 //    I2C_ERR_NACK     - if the slave did not acknowledge the transfer.
 // -----------------------------------------------------------------------------
-static uint32_t I2C_mstr_read_internal(uint8_t slave, uint8_t *buffer, 
+static uint32_t I2C_mstr_read_xfer(uint8_t slave, uint8_t *buffer, 
                 uint8_t length, i2c_burst_type_t i2c_type)
 {
   uint32_t ret_status = I2C_SUCCESS;
@@ -2239,8 +2481,17 @@ static uint32_t I2C_mstr_read_internal(uint8_t slave, uint8_t *buffer,
                 I2C_MCTR_BURSTRUN_ENABLE |
                 ((length << I2C_MCTR_MBLEN_OFS) & I2C_MCTR_MBLEN_MASK));
 
-    // wait until I2C controller FSM is not busy
-    while((I2C1->MASTER.MSR & I2C_MSR_BUSY_MASK) == I2C_MSR_BUSY_SET);
+    // wait until I2C controller FSM is not busy or we timeout
+    timeout = I2C_TIMEOUT_COUNT;
+    while((I2C1->MASTER.MSR & I2C_MSR_BUSY_MASK) == I2C_MSR_BUSY_SET)
+    {
+      // Try until timeout expires to prevent hanging
+      if (--timeout == 0) 
+      {
+        return I2C_ERR_TIMEOUT;
+      } /* if */
+      usec_delay(10);
+    } /* while */
 
     // check for error or if lost arbitration or no ack
     if ((I2C1->MASTER.MSR & I2C_MSR_ARBLST_MASK) == I2C_MSR_ARBLST_SET)
@@ -2253,8 +2504,17 @@ static uint32_t I2C_mstr_read_internal(uint8_t slave, uint8_t *buffer,
     } /* else */
 
     // Before reading the data, ensure the data has landed in the RXFIFO
-    while (((I2C1->MASTER.MFIFOSR & I2C_MFIFOSR_RXFIFOCNT_MASK) >> 
-            I2C_MFIFOSR_RXFIFOCNT_OFS) < length);
+    timeout = I2C_TIMEOUT_COUNT;
+    while ((ret_status == I2C_SUCCESS) &&
+           (((I2C1->MASTER.MFIFOSR & I2C_MFIFOSR_RXFIFOCNT_MASK) >> 
+            I2C_MFIFOSR_RXFIFOCNT_OFS) < length))
+    {
+      if (--timeout == 0) 
+      {
+        return I2C_ERR_TIMEOUT;
+      } /* if */
+      usec_delay(10);
+    } /* while */
 
     // Read received bytes from FIFO
     if (ret_status == I2C_SUCCESS)
@@ -2271,6 +2531,44 @@ static uint32_t I2C_mstr_read_internal(uint8_t slave, uint8_t *buffer,
 
   return (ret_status);
 
+} /* I2C_mstr_read_xfer */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function performs an I2C read using I2C_mstr_read_xfer and keeps
+//    the health statistics for the slave device. If the transfer timed out
+//    the bus is recovered so that a stuck slave does not cause every later
+//    transfer to time out as well.
+//
+// INPUT PARAMETERS:
+//    slave    - The 7-bit address of the I2C slave device to read from.
+//
+//    buffer   - Pointer to a buffer where the received bytes will be stored.
+//
+//    length   - The number of bytes (max 8) to read.
+//
+//    i2c_type - The type of burst (normal, start, continue or end).
+//
+// OUTPUT PARAMETERS:
+//    buffer   - The array filled with the received data.
+//
+// RETURN:
+//    I2C_SUCCESS      - if the read operation completed successfully.
+//    I2C_ERR_TIMEOUT  - if the I2C controller did not become idle in time.
+//    I2C_ERR_ARB_LOST - if arbitration was lost during the transfer.
+//    I2C_ERR_NACK     - if the slave did not acknowledge the transfer.
+// -----------------------------------------------------------------------------
+static uint32_t I2C_mstr_read_internal(uint8_t slave, uint8_t *buffer, 
+                uint8_t length, i2c_burst_type_t i2c_type)
+{
+  uint32_t start_cycles = cycle_counter_get();
+  uint32_t ret_status = I2C_mstr_read_xfer(slave, buffer, length, i2c_type);
+
+  I2C_mstr_xfer_done(slave, ret_status, start_cycles);
+
+  return (ret_status);
+
 } /* I2C_mstr_read_internal */
 
 //-----------------------------------------------------------------------------
@@ -2414,6 +2712,338 @@ uint32_t I2C_mstr_read_end(uint8_t slave, uint8_t *buffer, uint8_t length)
 }
 
 
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function is called at the end of every I2C transfer. It records
+//    the result and latency of the transfer in the health statistics of the
+//    slave device. If the transfer timed out, the controller or a slave is
+//    holding the bus, so the bus is recovered before the next transfer.
+//
+// INPUT PARAMETERS:
+//    slave        - The 7-bit address of the I2C slave device.
+//    status       - The status code returned by the transfer.
+//    start_cycles - The cycle counter value when the transfer started.
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    none
+//-----------------------------------------------------------------------------
+static void I2C_mstr_xfer_done(uint8_t slave, uint32_t status, 
+          uint32_t start_cycles)
+{
+  uint32_t latency_us = cycles_to_usec(cycle_counter_get() - start_cycles);
+
+  I2C_record_dev_stats(slave, status, latency_us);
+
+  if (status == I2C_ERR_TIMEOUT)
+  {
+    (void)I2C_bus_recover();
+  } /* if */
+
+} /* I2C_mstr_xfer_done */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function drives or releases one of the I2C pins while the pins are
+//    configured as open-drain GPIO during bus recovery.
+//
+// INPUT PARAMETERS:
+//    idx   - index of the pin in iic_config_data (0 = SDA, 1 = SCL)
+//    level - 0 to drive the pin low, 1 to release it (pulled high)
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    none
+//-----------------------------------------------------------------------------
+static void I2C_recovery_pin_write(uint8_t idx, uint8_t level)
+{
+  GPIO_Regs *port = g_gpio_ports[iic_config_data[idx].port_id];
+
+  if (level)
+  {
+    port->DOUTSET31_0 = iic_config_data[idx].bit_mask;
+  } /* if */
+  else
+  {
+    port->DOUTCLR31_0 = iic_config_data[idx].bit_mask;
+  } /* else */
+
+  usec_delay(I2C_RECOVERY_HALF_PERIOD_US);
+
+} /* I2C_recovery_pin_write */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function reads the level of one of the I2C pins while the pins are
+//    configured as GPIO during bus recovery.
+//
+// INPUT PARAMETERS:
+//    idx - index of the pin in iic_config_data (0 = SDA, 1 = SCL)
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    true if the pin is high, false if it is held low
+//-----------------------------------------------------------------------------
+static bool I2C_recovery_pin_read(uint8_t idx)
+{
+  return ((g_gpio_ports[iic_config_data[idx].port_id]->DIN31_0 &
+           iic_config_data[idx].bit_mask) != 0);
+
+} /* I2C_recovery_pin_read */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function recovers the I2C bus after a transfer has failed with a
+//    timeout. A slave that was interrupted in the middle of a read can hold 
+//    SDA low forever, which makes every later transfer fail. The function:
+//      - Disables the I2C controller.
+//      - Switches SDA and SCL to open-drain GPIO outputs.
+//      - Clocks up to 9 SCL pulses until the slave releases SDA.
+//      - Generates a STOP condition (SDA rising while SCL is high).
+//      - Re-initializes the I2C controller and restores the FIFO triggers.
+//
+// INPUT PARAMETERS:
+//    none
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    I2C_SUCCESS     - if SDA and SCL are both high after the recovery.
+//    I2C_ERR_TIMEOUT - if a device is still holding the bus low.
+//-----------------------------------------------------------------------------
+uint32_t I2C_bus_recover(void)
+{
+  uint32_t ret_status = I2C_SUCCESS;
+  uint32_t fifo_ctl   = I2C_INST->MASTER.MFIFOCTL;
+  uint32_t gpio_pincm = IOMUX_PINCM_PC_CONNECTED | PINCM_GPIO_PIN_FUNC |
+                        IOMUX_PINCM_INENA_ENABLE | IOMUX_PINCM_HIZ1_ENABLE;
+
+  g_i2c_recovery_count++;
+
+  // Stop the controller from driving the bus
+  I2C_INST->MASTER.MCR &= ~I2C_MCR_ACTIVE_MASK;
+
+  // Take over SDA and SCL as open-drain GPIO, both released (high)
+  for (uint8_t idx = 0; idx < MAX_NUM_I2C_BITS; idx++)
+  {
+    I2C_recovery_pin_write(idx, 1);
+    IOMUX->SECCFG.PINCM[iic_config_data[idx].pin_cm] = gpio_pincm;
+    g_gpio_ports[iic_config_data[idx].port_id]->DOESET31_0 =
+          iic_config_data[idx].bit_mask;
+  } /* for */
+  usec_delay(I2C_RECOVERY_HALF_PERIOD_US);
+
+  // Clock SCL until the slave finishes its byte and lets go of SDA
+  for (uint8_t pulse = 0; (pulse < I2C_RECOVERY_SCL_PULSES) &&
+                          !I2C_recovery_pin_read(I2C_SDA_IDX); pulse++)
+  {
+    I2C_recovery_pin_write(I2C_SCL_IDX, 0);
+    I2C_recovery_pin_write(I2C_SCL_IDX, 1);
+  } /* for */
+
+  // Generate a STOP: SDA low while SCL is low, then SCL high, then SDA high
+  I2C_recovery_pin_write(I2C_SCL_IDX, 0);
+  I2C_recovery_pin_write(I2C_SDA_IDX, 0);
+  I2C_recovery_pin_write(I2C_SCL_IDX, 1);
+  I2C_recovery_pin_write(I2C_SDA_IDX, 1);
+
+  if (!I2C_recovery_pin_read(I2C_SDA_IDX) || 
+      !I2C_recovery_pin_read(I2C_SCL_IDX))
+  {
+    ret_status = I2C_ERR_TIMEOUT;
+  } /* if */
+
+  // Release the GPIO outputs and give the pins back to the controller
+  for (uint8_t idx = 0; idx < MAX_NUM_I2C_BITS; idx++)
+  {
+    g_gpio_ports[iic_config_data[idx].port_id]->DOECLR31_0 =
+          iic_config_data[idx].bit_mask;
+  } /* for */
+
+  I2C_mstr_init();
+
+  // Keep any FIFO trigger levels (used for DMA) that were configured
+  I2C_INST->MASTER.MFIFOCTL = fifo_ctl & ~(I2C_MFIFOCTL_TXFLUSH_MASK |
+                                           I2C_MFIFOCTL_RXFLUSH_MASK);
+
+  return (ret_status);
+
+} /* I2C_bus_recover */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function returns the number of times the I2C bus was recovered.
+//
+// INPUT PARAMETERS:
+//    none
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    the number of bus recoveries since reset
+//-----------------------------------------------------------------------------
+uint32_t I2C_get_recovery_count(void)
+{
+  return (g_i2c_recovery_count);
+} /* I2C_get_recovery_count */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function records the result of one transfer in the health 
+//    statistics of a slave device. Statistics are kept for the first 
+//    I2C_MAX_DEV_STATS addresses that are used; later addresses are not
+//    tracked. It is called from both the main loop and the DMA interrupts,
+//    so the update is made with interrupts disabled.
+//
+// INPUT PARAMETERS:
+//    slave      - The 7-bit address of the I2C slave device.
+//    status     - The status code returned by the transfer.
+//    latency_us - The time the transfer took in microseconds.
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    none
+//-----------------------------------------------------------------------------
+void I2C_record_dev_stats(uint8_t slave, uint32_t status, uint32_t latency_us)
+{
+  i2c_dev_stats_t *stats = NULL;
+  uint32_t primask;
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+
+  // Find the entry for this slave or the first unused entry
+  for (uint8_t idx = 0; (idx < I2C_MAX_DEV_STATS) && (stats == NULL); idx++)
+  {
+    if ((g_i2c_dev_stats[idx].xfer_count == 0) || 
+        (g_i2c_dev_stats[idx].slave == slave))
+    {
+      stats = &g_i2c_dev_stats[idx];
+    } /* if */
+  } /* for */
+
+  if (stats != NULL)
+  {
+    stats->slave = slave;
+    stats->xfer_count++;
+    stats->last_latency_us = latency_us;
+
+    if (latency_us > stats->max_latency_us)
+    {
+      stats->max_latency_us = latency_us;
+    } /* if */
+
+    switch (status)
+    {
+      case I2C_ERR_NACK:
+        stats->nack_count++;
+        break;
+
+      case I2C_ERR_ARB_LOST:
+        stats->arb_lost_count++;
+        break;
+
+      case I2C_ERR_TIMEOUT:
+        stats->timeout_count++;
+        break;
+
+      default:
+        break;
+    } /* switch */
+  } /* if */
+
+  __set_PRIMASK(primask);
+
+} /* I2C_record_dev_stats */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function copies the health statistics of a slave device.
+//
+// INPUT PARAMETERS:
+//    slave - The 7-bit address of the I2C slave device.
+//
+// OUTPUT PARAMETERS:
+//    stats - The statistics of the slave device.
+//
+// RETURN:
+//    true if statistics are kept for the slave device, otherwise false
+//-----------------------------------------------------------------------------
+bool I2C_get_dev_stats(uint8_t slave, i2c_dev_stats_t *stats)
+{
+  bool found = false;
+  uint32_t primask;
+
+  // Copy the entry in one piece, an interrupt may be updating it
+  primask = __get_PRIMASK();
+  __disable_irq();
+
+  for (uint8_t idx = 0; (idx < I2C_MAX_DEV_STATS) && !found; idx++)
+  {
+    if ((g_i2c_dev_stats[idx].xfer_count != 0) && 
+        (g_i2c_dev_stats[idx].slave == slave))
+    {
+      *stats = g_i2c_dev_stats[idx];
+      found = true;
+    } /* if */
+  } /* for */
+
+  __set_PRIMASK(primask);
+
+  return (found);
+
+} /* I2C_get_dev_stats */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function clears the health statistics of all slave devices and 
+//    the bus recovery count.
+//
+// INPUT PARAMETERS:
+//    none
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    none
+//-----------------------------------------------------------------------------
+void I2C_clear_dev_stats(void)
+{
+  uint32_t primask;
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+
+  for (uint8_t idx = 0; idx < I2C_MAX_DEV_STATS; idx++)
+  {
+    g_i2c_dev_stats[idx] = (i2c_dev_stats_t){0};
+  } /* for */
+
+  g_i2c_recovery_count = 0;
+
+  __set_PRIMASK(primask);
+
+} /* I2C_clear_dev_stats */
+
+
 
 
 
@@ -57,6 +57,7 @@
 //-----------------------------------------------------------------------------
 // Loads MSP launchpad board support macros and definitions
 //-----------------------------------------------------------------------------
+#include <ti/devices/msp/msp.h>
 
 // see ti_devices_msp_peripherals_hw_iomux__include hw_iomux.h
 #define PINCM_GPIO_PIN_FUNC                              ((uint32_t)0x00000001U)
@@ -98,6 +99,7 @@
 
 #define GPIO_PORTA                                                           (0)
 #define GPIO_PORTB                                                           (1)
+#define MAX_NUM_GPIO_PORTS                                                   (2)
 
 // Defines for RED LED1 on Launchpad
 #define LP_LED_RED_PORT                                             (GPIO_PORTA)
@@ -252,13 +254,35 @@
 #define I2C_ERR_NACK                                                         (2)
 #define I2C_FIFO_LOAD_ERROR                                                  (3)
 #define I2C_ERR_TIMEOUT                                                      (4)
-#define I2C_TIMEOUT_COUNT                                             (200000UL)
+#define I2C_ERR_BUSY                                                         (5)
+
+// Each timeout count is 10us. A full 8-byte burst at 100kHz takes under 1ms,
+// so 20ms leaves room for clock stretching without stalling for seconds.
+#define I2C_TIMEOUT_COUNT                                               (2000UL)
+
+// I2C bus recovery (9 SCL pulses then STOP) timing and per-device statistics
+#define I2C_RECOVERY_SCL_PULSES                                              (9)
+#define I2C_RECOVERY_HALF_PERIOD_US                                          (5)
+#define I2C_MAX_DEV_STATS                                                    (8)
+
+// Define a structure to hold the health statistics for one I2C slave device
+typedef struct
+{
+  uint8_t  slave;
+  uint32_t xfer_count;
+  uint32_t nack_count;
+  uint32_t arb_lost_count;
+  uint32_t timeout_count;
+  uint32_t last_latency_us;
+  uint32_t max_latency_us;
+} i2c_dev_stats_t;
 
 
 // --------------------------------------------------------------------------
 // Prototype for Launchpad support functions
 // --------------------------------------------------------------------------
 void launchpad_gpio_init(void);
+GPIO_Regs *gpio_port_regs(uint8_t port_id);
 
 void lp_leds_init(void);
 void lp_leds_deinit(void);
@@ -277,23 +301,34 @@ void led_off(uint8_t led_idx);
 void seg7_init(void);
 void seg7_deinit(void);
 void seg7_off(void);
+void seg7_dig_enable(uint8_t seg7_idx);
+void seg7_port_masks(uint8_t value, uint8_t enable_idx, uint32_t set_pins[],
+     uint32_t clr_pins[]);
 void seg7_on(uint8_t value, uint8_t seg7_dig);
 void seg7_hex(uint8_t hex, uint8_t seg7_dig);
 
 void dipsw_init(void);
 void dipsw_deinit(void);
 uint8_t dipsw_read(void);
+uint32_t dipsw_port_mask(uint8_t sw_idx, uint8_t *port_id);
 bool is_pb_down(uint8_t pb_idx);
 bool is_pb_up(uint8_t pb_idx);
 void dipsw_filter_enable(void);
+void dipsw_filter_disable(void);
 
 void lpsw_init(void);
 void lpsw_deinit(void);
 bool is_lpsw_down(uint8_t pb_idx);
 bool is_lpsw_up(uint8_t pb_idx);
+uint32_t lpsw_port_mask(uint8_t sw_idx, uint8_t *port_id);
 
 void keypad_init(void);
+void keypad_row_masks(uint32_t row_pins[]);
 void keypad_deinit(void);
+uint8_t read_keyrow_data(void);
+void write_keycol_data(uint8_t data);
+uint16_t keypad_read_matrix(void);
+uint8_t keypad_matrix_key(uint8_t bit);
 uint8_t keypad_scan(void);
 uint8_t getkey_pressed(void);
 void wait_no_key_pressed(void);
@@ -304,11 +339,18 @@ uint32_t I2C_mstr_send(uint8_t slave, uint8_t data[], uint8_t byte_count);
 uint32_t I2C_mstr_send_start(uint8_t slave, uint8_t data[], uint8_t byte_count);
 uint32_t I2C_mstr_send_continue(uint8_t slave, uint8_t data[], uint8_t byte_count);
 uint32_t I2C_mstr_send_end(uint8_t slave, uint8_t data[], uint8_t byte_count);
+uint32_t I2C_mstr_send_stream(uint8_t slave, const uint8_t data[],
+         uint16_t length);
 uint32_t I2C_mstr_read1(uint8_t slave, uint8_t data[]);
 uint32_t I2C_mstr_read(uint8_t slave, uint8_t data[], uint8_t byte_count);
 uint32_t I2C_mstr_read_start(uint8_t slave, uint8_t data[], uint8_t byte_count);
 uint32_t I2C_mstr_read_continue(uint8_t slave, uint8_t data[], uint8_t byte_count);
 uint32_t I2C_mstr_read_end(uint8_t slave, uint8_t data[], uint8_t byte_count);
+uint32_t I2C_bus_recover(void);
+uint32_t I2C_get_recovery_count(void);
+void I2C_record_dev_stats(uint8_t slave, uint32_t status, uint32_t latency_us);
+bool I2C_get_dev_stats(uint8_t slave, i2c_dev_stats_t *stats);
+void I2C_clear_dev_stats(void);
 
 void motor0_init(void);
 void motor0_pwm_init(uint32_t load_value, uint32_t compare_value);
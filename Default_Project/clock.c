@@ -55,7 +55,6 @@
 //-----------------------------------------------------------------------------
 // Define symbolic constants used by the program
 //-----------------------------------------------------------------------------
-#define MSEC_PER_SECOND                                                   (1000)
 #define USEC_PER_SECOND                                                (1000000)
 
 
@@ -64,6 +63,11 @@
 //-----------------------------------------------------------------------------
 uint32_t volatile g_bus_clock_freq = 32000000; 
 
+//-----------------------------------------------------------------------------
+// global signal to track status of the free running cycle counter
+//-----------------------------------------------------------------------------
+static uint8_t g_cycle_counter_running = 0;
+
 //------------------------------------------------------------------------------
 // DESCRIPTION:
 //   This function returns current configured bus clock frequency for the 
@@ -448,4 +452,115 @@ void sys_tick_disable(void)
   SysTick->VAL  = 0;
   SysTick->LOAD = 0;
   SysTick->CTRL = 0;
-} /* sys_tick_disable */
\ No newline at end of file
+} /* sys_tick_disable */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function configures the 32-bit general purpose timer (TIMG12) as
+//    a free running up counter clocked by the bus clock. The counter wraps
+//    from 0xFFFFFFFF to 0 and does not generate interrupts. It is used to
+//    time stamp events and to measure the latency of driver operations by
+//    subtracting two readings of cycle_counter_get().
+//
+//    Calling this function after the counter is running has no effect, so
+//    each driver that needs time stamps can safely call it from its own
+//    initialization function.
+//
+// INPUT PARAMETERS:
+//   none
+//
+// OUTPUT PARAMETERS:
+//   none
+//
+// RETURN:
+//   none
+// -----------------------------------------------------------------------------
+void cycle_counter_init(void)
+{
+  if (g_cycle_counter_running)
+  {
+    return;
+  } /* if */
+
+  // Reset the timer
+  CYCLE_COUNTER_INST->GPRCM.RSTCTL = (GPTIMER_RSTCTL_KEY_UNLOCK_W |
+        GPTIMER_RSTCTL_RESETSTKYCLR_CLR | GPTIMER_RSTCTL_RESETASSERT_ASSERT);
+
+  // Enable power to the timer
+  CYCLE_COUNTER_INST->GPRCM.PWREN = (GPTIMER_PWREN_KEY_UNLOCK_W |
+        GPTIMER_PWREN_ENABLE_ENABLE);
+
+  clock_delay(PERIPHERAL_PWR_UP_DELAY);
+
+  // Count bus clock cycles with no division
+  CYCLE_COUNTER_INST->CLKSEL = (GPTIMER_CLKSEL_BUSCLK_SEL_ENABLE |
+        GPTIMER_CLKSEL_MFCLK_SEL_DISABLE | GPTIMER_CLKSEL_LFCLK_SEL_DISABLE);
+  CYCLE_COUNTER_INST->CLKDIV = GPTIMER_CLKDIV_RATIO_DIV_BY_1;
+  CYCLE_COUNTER_INST->COMMONREGS.CPS = 0;
+
+  // Count up from 0 to the full 32-bit range and repeat forever
+  CYCLE_COUNTER_INST->COUNTERREGS.LOAD = 0xFFFFFFFF;
+  CYCLE_COUNTER_INST->COUNTERREGS.CTRCTL = (GPTIMER_CTRCTL_CVAE_ZEROVAL |
+        GPTIMER_CTRCTL_CM_UP | GPTIMER_CTRCTL_REPEAT_REPEAT_1);
+
+  // No interrupt is required
+  CYCLE_COUNTER_INST->CPU_INT.IMASK = 0;
+
+  // Enable the clock and start counting
+  CYCLE_COUNTER_INST->COMMONREGS.CCLKCTL = GPTIMER_CCLKCTL_CLKEN_ENABLED;
+  CYCLE_COUNTER_INST->COUNTERREGS.CTRCTL |= GPTIMER_CTRCTL_EN_ENABLED;
+
+  g_cycle_counter_running = 1;
+
+} /* cycle_counter_init */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function returns the current value of the free running cycle
+//    counter. The difference between two readings, computed with unsigned
+//    32-bit arithmetic, is the number of bus clock cycles between them even
+//    if the counter wrapped once. Returns 0 if the counter is not running.
+//
+// INPUT PARAMETERS:
+//   none
+//
+// OUTPUT PARAMETERS:
+//   none
+//
+// RETURN:
+//   current count of the free running counter
+// -----------------------------------------------------------------------------
+uint32_t cycle_counter_get(void)
+{
+  uint32_t count = 0;
+
+  if (g_cycle_counter_running)
+  {
+    count = CYCLE_COUNTER_INST->COUNTERREGS.CTR;
+  } /* if */
+
+  return (count);
+
+} /* cycle_counter_get */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function converts a number of bus clock cycles, as measured with
+//    cycle_counter_get(), into microseconds.
+//
+// INPUT PARAMETERS:
+//   cycles - a 32-bit number of bus clock cycles
+//
+// OUTPUT PARAMETERS:
+//   none
+//
+// RETURN:
+//   the number of microseconds
+// -----------------------------------------------------------------------------
+uint32_t cycles_to_usec(uint32_t cycles)
+{
+  return (cycles / (g_bus_clock_freq / USEC_PER_SECOND));
+} /* cycles_to_usec */
@@ -55,6 +55,14 @@
 // Define symbolic constants used by the program
 //-----------------------------------------------------------------------------
 
+// Bus clock cycles to wait after enabling power to a peripheral
+#define PERIPHERAL_PWR_UP_DELAY                                             (24)
+
+#define MSEC_PER_SECOND                                                   (1000)
+
+// Free running 32-bit timer used to time stamp events and measure latency
+#define CYCLE_COUNTER_INST                                                TIMG12
+
 
 // ----------------------------------------------------------------------------
 // Prototype for support functions
@@ -73,4 +81,8 @@ void sys_tick_init(uint32_t period);
 void sys_tick_disable(void);
 void sys_tick_reset(void);
 
+void cycle_counter_init(void);
+uint32_t cycle_counter_get(void);
+uint32_t cycles_to_usec(uint32_t cycles);
+
 #endif /* __CLOCK_H__ */
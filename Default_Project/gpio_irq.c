@@ -0,0 +1,396 @@
+// *****************************************************************************
+// ***************************    C Source Code     ****************************
+// *****************************************************************************
+//   DESIGNER NAME:  Bruce Link
+//
+//         VERSION:  1.0
+//
+//       FILE NAME:  gpio_irq.c
+//
+//-----------------------------------------------------------------------------
+// DESCRIPTION
+//    This file contains the GROUP1 (GPIOA and GPIOB) pin interrupt service.
+//    See gpio_irq.h for how to use it.
+//
+//
+//-----------------------------------------------------------------------------
+// DISCLAIMER
+//    This code was developed for educational purposes as part of the CSC202
+//    course at Monroe Community Collage and is provided "as is" without
+//    warranties of any kind, whether express, implied, or statutory.
+//
+//    The author and organization do not warrant the accuracy, completeness, or
+//    reliability of the code. The author and organization shall not be liable
+//    for any direct, indirect, incidental, special, exemplary, or consequential
+//    damages arising out of the use of or inability to use the code, even if
+//    advised of the possibility of such damages.
+//
+//    Use of this code is at your own risk, and it is recommended to validate
+//    and adapt the code for your specific application and hardware
+//    requirements.
+//
+// Copyright (c) 2026 by Bruce Link
+//    You may use, edit, run or distribute this file as long as the above
+//    copyright notice remains
+// *****************************************************************************
+//******************************************************************************
+
+//-----------------------------------------------------------------------------
+// Load standard C include files
+//-----------------------------------------------------------------------------
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+//-----------------------------------------------------------------------------
+// Loads MSP launchpad board support macros and definitions
+//-----------------------------------------------------------------------------
+#include <ti/devices/msp/msp.h>
+#include "LaunchPad.h"
+#include "clock.h"
+#include "gpio_irq.h"
+
+
+//-----------------------------------------------------------------------------
+// Define symbolic constants used by the module
+//-----------------------------------------------------------------------------
+
+// GPIOA and GPIOB share the GROUP1 interrupt
+#define GPIO_IRQ_INT_IRQN                                         GPIOA_INT_IRQn
+
+// The POLARITY registers have a 2-bit field for each of 16 pins
+#define GPIO_IRQ_POL_FIELD_BITS                                              (2)
+#define GPIO_IRQ_POL_FIELD_MASK                                              (3)
+#define GPIO_IRQ_POL_PINS                                                   (16)
+
+// Multiplying a single set bit by this de Bruijn constant puts a different
+// value in the top 5 bits for each of the 32 bit positions
+#define GPIO_IRQ_DEBRUIJN                                          (0x077CB531U)
+#define GPIO_IRQ_DEBRUIJN_SHIFT                                             (27)
+
+
+//-----------------------------------------------------------------------------
+// Define function prototypes used by the module
+//-----------------------------------------------------------------------------
+static void gpio_irq_set_edge(GPIO_Regs *gpio, uint8_t pin, uint8_t edge);
+
+
+//-----------------------------------------------------------------------------
+// Define global variables and structures here.
+// NOTE: when possible avoid using global variables
+//-----------------------------------------------------------------------------
+
+// Pin number for the top 5 bits of (single set bit * GPIO_IRQ_DEBRUIJN)
+static const uint8_t g_gpio_irq_debruijn_pin[GPIO_IRQ_PINS_PER_PORT] =
+{
+   0,  1, 28,  2, 29, 14, 24,  3, 30, 22, 20, 15, 25, 17,  4,  8,
+  31, 27, 13, 23, 21, 19, 16,  7, 26, 12, 18,  6, 11,  5, 10,  9
+};
+
+static gpio_irq_callback_t
+       g_gpio_irq_callbacks[MAX_NUM_GPIO_PORTS][GPIO_IRQ_PINS_PER_PORT];
+static gpio_irq_stats_t
+       g_gpio_irq_stats[MAX_NUM_GPIO_PORTS][GPIO_IRQ_PINS_PER_PORT];
+
+// Cycle count at the start of the last handler
+static volatile uint32_t g_gpio_irq_entry = 0;
+
+static bool g_gpio_irq_ready = false;
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function sets up the pin interrupt service: the cycle counter is
+//    started for the statistics and the GROUP1 interrupt is enabled in the
+//    NVIC. It can be called by every driver that uses the service, only
+//    the first call clears the callbacks.
+//
+// INPUT PARAMETERS:
+//    none
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    none
+// -----------------------------------------------------------------------------
+void gpio_irq_init(void)
+{
+  if (g_gpio_irq_ready)
+  {
+    return;
+  } /* if */
+
+  cycle_counter_init();
+
+  memset(g_gpio_irq_callbacks, 0, sizeof(g_gpio_irq_callbacks));
+  memset(g_gpio_irq_stats, 0, sizeof(g_gpio_irq_stats));
+  g_gpio_irq_ready = true;
+
+  NVIC_ClearPendingIRQ(GPIO_IRQ_INT_IRQN);
+  NVIC_EnableIRQ(GPIO_IRQ_INT_IRQN);
+
+} /* gpio_irq_init */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function registers a callback for pins of a port and enables
+//    their interrupt on the given edge. An earlier registration of the
+//    same pins is replaced. Edges that happened before the call are
+//    cleared.
+//
+// INPUT PARAMETERS:
+//    port_id  - GPIO_PORTA or GPIO_PORTB
+//    pins     - pins of the port (bit n is DIOn)
+//    edge     - GPIO_IRQ_EDGE_RISING, GPIO_IRQ_EDGE_FALLING or
+//               GPIO_IRQ_EDGE_BOTH
+//    callback - function called from the interrupt for each edge
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    true if the pins were registered, false if a parameter is not valid
+// -----------------------------------------------------------------------------
+bool gpio_irq_register(uint8_t port_id, uint32_t pins, uint8_t edge,
+     gpio_irq_callback_t callback)
+{
+  GPIO_Regs *gpio;
+  uint32_t   primask;
+
+  if ((port_id >= MAX_NUM_GPIO_PORTS) || (callback == NULL) ||
+      (edge == GPIO_IRQ_EDGE_NONE) || (edge > GPIO_IRQ_EDGE_BOTH))
+  {
+    return (false);
+  } /* if */
+
+  gpio    = gpio_port_regs(port_id);
+  primask = __get_PRIMASK();
+  __disable_irq();
+
+  gpio->CPU_INT.IMASK &= ~pins;
+  for (uint8_t pin = 0; pin < GPIO_IRQ_PINS_PER_PORT; pin++)
+  {
+    if ((pins & (1U << pin)) != 0)
+    {
+      g_gpio_irq_callbacks[port_id][pin] = callback;
+      gpio_irq_set_edge(gpio, pin, edge);
+    } /* if */
+  } /* for */
+  gpio->CPU_INT.ICLR   = pins;
+  gpio->CPU_INT.IMASK |= pins;
+
+  __set_PRIMASK(primask);
+
+  return (true);
+
+} /* gpio_irq_register */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function disables the interrupt of pins of a port and removes
+//    their callback.
+//
+// INPUT PARAMETERS:
+//    port_id - GPIO_PORTA or GPIO_PORTB
+//    pins    - pins of the port (bit n is DIOn)
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    none
+// -----------------------------------------------------------------------------
+void gpio_irq_unregister(uint8_t port_id, uint32_t pins)
+{
+  GPIO_Regs *gpio;
+  uint32_t   primask;
+
+  if (port_id >= MAX_NUM_GPIO_PORTS)
+  {
+    return;
+  } /* if */
+
+  gpio    = gpio_port_regs(port_id);
+  primask = __get_PRIMASK();
+  __disable_irq();
+
+  gpio->CPU_INT.IMASK &= ~pins;
+  gpio->CPU_INT.ICLR   = pins;
+  for (uint8_t pin = 0; pin < GPIO_IRQ_PINS_PER_PORT; pin++)
+  {
+    if ((pins & (1U << pin)) != 0)
+    {
+      g_gpio_irq_callbacks[port_id][pin] = NULL;
+      gpio_irq_set_edge(gpio, pin, GPIO_IRQ_EDGE_NONE);
+    } /* if */
+  } /* for */
+
+  __set_PRIMASK(primask);
+
+} /* gpio_irq_unregister */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function returns the cycle count at the start of the last GROUP1
+//    handler. A callback can use it to time its own work from the start
+//    of the interrupt.
+//
+// INPUT PARAMETERS:
+//    none
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    cycle_counter_get() value at the start of the handler
+// -----------------------------------------------------------------------------
+uint32_t gpio_irq_entry_cycles(void)
+{
+  return (g_gpio_irq_entry);
+} /* gpio_irq_entry_cycles */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    These functions read the statistics of a pin and clear the statistics
+//    of all the pins.
+//
+// INPUT PARAMETERS:
+//    port_id - GPIO_PORTA or GPIO_PORTB
+//    pin     - pin number, 0-31
+//
+// OUTPUT PARAMETERS:
+//    stats - copy of the statistics of the pin (gpio_irq_get_stats)
+//
+// RETURN:
+//    false if the port or the pin is not valid (gpio_irq_get_stats)
+// -----------------------------------------------------------------------------
+bool gpio_irq_get_stats(uint8_t port_id, uint8_t pin, gpio_irq_stats_t *stats)
+{
+  uint32_t primask;
+
+  if ((port_id >= MAX_NUM_GPIO_PORTS) || (pin >= GPIO_IRQ_PINS_PER_PORT))
+  {
+    return (false);
+  } /* if */
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  *stats = g_gpio_irq_stats[port_id][pin];
+  __set_PRIMASK(primask);
+
+  return (true);
+
+} /* gpio_irq_get_stats */
+
+void gpio_irq_clear_stats(void)
+{
+  uint32_t primask = __get_PRIMASK();
+
+  __disable_irq();
+  memset(g_gpio_irq_stats, 0, sizeof(g_gpio_irq_stats));
+  __set_PRIMASK(primask);
+
+} /* gpio_irq_clear_stats */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function sets the POLARITY register field of a pin, which
+//    selects the edge it interrupts on.
+//
+// INPUT PARAMETERS:
+//    gpio - GPIO port registers
+//    pin  - pin number, 0-31
+//    edge - GPIO_IRQ_EDGE_x
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    none
+// -----------------------------------------------------------------------------
+static void gpio_irq_set_edge(GPIO_Regs *gpio, uint8_t pin, uint8_t edge)
+{
+  uint8_t  shift = (pin % GPIO_IRQ_POL_PINS) * GPIO_IRQ_POL_FIELD_BITS;
+  uint32_t field = (uint32_t)GPIO_IRQ_POL_FIELD_MASK << shift;
+  uint32_t value = (uint32_t)edge << shift;
+
+  if (pin < GPIO_IRQ_POL_PINS)
+  {
+    gpio->POLARITY15_0 = (gpio->POLARITY15_0 & ~field) | value;
+  } /* if */
+  else
+  {
+    gpio->POLARITY31_16 = (gpio->POLARITY31_16 & ~field) | value;
+  } /* else */
+
+} /* gpio_irq_set_edge */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    GROUP1 (GPIOA and GPIOB) interrupt service routine. The masked status
+//    of each port is read and cleared once, then the callback of each pin
+//    in it is called, lowest pin first.
+//
+//    The Cortex-M0+ has no CLZ instruction, so the next pin is found by
+//    isolating the lowest set bit (pending & -pending) and looking up its
+//    de Bruijn product, a multiply and a table read. The loop runs once
+//    for each pending pin.
+//
+// INPUT PARAMETERS:
+//    none
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    none
+// -----------------------------------------------------------------------------
+void GROUP1_IRQHandler(void)
+{
+  uint32_t          start = cycle_counter_get();
+  GPIO_Regs        *gpio;
+  gpio_irq_stats_t *stats;
+  uint32_t          pending;
+  uint32_t          lowest;
+  uint32_t          cycles;
+  uint8_t           pin;
+
+  g_gpio_irq_entry = start;
+
+  for (uint8_t port = 0; port < MAX_NUM_GPIO_PORTS; port++)
+  {
+    gpio    = gpio_port_regs(port);
+    pending = gpio->CPU_INT.MIS;
+    gpio->CPU_INT.ICLR = pending;
+
+    while (pending != 0)
+    {
+      lowest   = pending & (0U - pending);
+      pending ^= lowest;
+      pin      = g_gpio_irq_debruijn_pin[(lowest * GPIO_IRQ_DEBRUIJN) >>
+                                         GPIO_IRQ_DEBRUIJN_SHIFT];
+
+      if (g_gpio_irq_callbacks[port][pin] != NULL)
+      {
+        cycles = cycle_counter_get() - start;
+        stats  = &g_gpio_irq_stats[port][pin];
+        stats->events++;
+        stats->latency_cycles = cycles;
+        if (cycles > stats->max_cycles)
+        {
+          stats->max_cycles = cycles;
+        } /* if */
+
+        g_gpio_irq_callbacks[port][pin](port, pin);
+      } /* if */
+    } /* while */
+  } /* for */
+
+} /* GROUP1_IRQHandler */
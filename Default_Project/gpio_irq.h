@@ -0,0 +1,105 @@
+// *****************************************************************************
+// ***************************    C Source Code     ****************************
+// *****************************************************************************
+//   DESIGNER NAME:  Bruce Link
+//
+//         VERSION:  1.0
+//
+//       FILE NAME:  gpio_irq.h
+//
+//-----------------------------------------------------------------------------
+// DESCRIPTION
+//    This module owns the GROUP1 interrupt, which is shared by all the
+//    pins of GPIOA and GPIOB. A driver registers a callback for the pins it
+//    needs, with the edge (rising, falling or both) to interrupt on, and
+//    the handler calls it for each pin that has a pending edge.
+//
+//    The handler reads the masked interrupt status of each port once,
+//    clears it, and walks only the bits that are set, lowest pin first, so
+//    its cost depends on the number of pins that interrupted and not on
+//    the 64 pins it covers. An edge that happens while a callback runs
+//    interrupts again.
+//
+//    For each pin the events are counted, and the time from the start of
+//    the handler to the call of the callback is measured with the cycle
+//    counter (TIMG12). The time taken by the core to take the interrupt,
+//    before the handler starts, is not included.
+//
+//    Typical use:
+//
+//      gpio_irq_init();
+//      gpio_irq_register(GPIO_PORTB, KP_ROW0_MASK | KP_ROW1_MASK,
+//                        GPIO_IRQ_EDGE_BOTH, my_callback);
+//
+//    NOTE: Callbacks run in the interrupt, keep them short. The pin must
+//          be set up as an input (IOMUX INENA) by its driver.
+//
+//
+//-----------------------------------------------------------------------------
+// DISCLAIMER
+//    This code was developed for educational purposes as part of the CSC202
+//    course at Monroe Community Collage and is provided "as is" without
+//    warranties of any kind, whether express, implied, or statutory.
+//
+//    The author and organization do not warrant the accuracy, completeness, or
+//    reliability of the code. The author and organization shall not be liable
+//    for any direct, indirect, incidental, special, exemplary, or consequential
+//    damages arising out of the use of or inability to use the code, even if
+//    advised of the possibility of such damages.
+//
+//    Use of this code is at your own risk, and it is recommended to validate
+//    and adapt the code for your specific application and hardware
+//    requirements.
+//
+// Copyright (c) 2026 by Bruce Link
+//    You may use, edit, run or distribute this file as long as the above
+//    copyright notice remains
+// *****************************************************************************
+//******************************************************************************
+
+#ifndef __GPIO_IRQ_H__
+#define __GPIO_IRQ_H__
+
+//-----------------------------------------------------------------------------
+// Load standard C include files
+//-----------------------------------------------------------------------------
+#include <stdint.h>
+#include <stdbool.h>
+
+//-----------------------------------------------------------------------------
+// Define symbolic constants used by the module
+//-----------------------------------------------------------------------------
+
+// Number of pins of each port
+#define GPIO_IRQ_PINS_PER_PORT                                              (32)
+
+// Edges to interrupt on, the values of the GPIO POLARITY register fields
+#define GPIO_IRQ_EDGE_NONE                                                   (0)
+#define GPIO_IRQ_EDGE_RISING                                                 (1)
+#define GPIO_IRQ_EDGE_FALLING                                                (2)
+#define GPIO_IRQ_EDGE_BOTH                                                   (3)
+
+// Callback called from the interrupt for a pin with a pending edge
+typedef void (*gpio_irq_callback_t)(uint8_t port_id, uint8_t pin);
+
+// Define a structure to hold the statistics of a pin
+typedef struct
+{
+  uint32_t events;            // times the callback was called
+  uint32_t latency_cycles;    // last handler start to callback called
+  uint32_t max_cycles;        // longest of latency_cycles
+} gpio_irq_stats_t;
+
+
+// ----------------------------------------------------------------------------
+// Prototype for support functions
+// ----------------------------------------------------------------------------
+void gpio_irq_init(void);
+bool gpio_irq_register(uint8_t port_id, uint32_t pins, uint8_t edge,
+     gpio_irq_callback_t callback);
+void gpio_irq_unregister(uint8_t port_id, uint32_t pins);
+uint32_t gpio_irq_entry_cycles(void);
+bool gpio_irq_get_stats(uint8_t port_id, uint8_t pin, gpio_irq_stats_t *stats);
+void gpio_irq_clear_stats(void);
+
+#endif /* __GPIO_IRQ_H__ */
@@ -0,0 +1,288 @@
+// *****************************************************************************
+// ***************************    C Source Code     ****************************
+// *****************************************************************************
+//   DESIGNER NAME:  Bruce Link
+//
+//         VERSION:  1.0
+//
+//       FILE NAME:  i2c_bench.c
+//
+//-----------------------------------------------------------------------------
+// DESCRIPTION
+//    This file contains the I2C master mode benchmark. See i2c_bench.h for
+//    the report format.
+//
+//-----------------------------------------------------------------------------
+// DISCLAIMER
+//    This code was developed for educational purposes as part of the CSC202
+//    course at Monroe Community Collage and is provided "as is" without
+//    warranties of any kind, whether express, implied, or statutory.
+//
+//    The author and organization do not warrant the accuracy, completeness, or
+//    reliability of the code. The author and organization shall not be liable
+//    for any direct, indirect, incidental, special, exemplary, or consequential
+//    damages arising out of the use of or inability to use the code, even if
+//    advised of the possibility of such damages.
+//
+//    Use of this code is at your own risk, and it is recommended to validate
+//    and adapt the code for your specific application and hardware
+//    requirements.
+//
+// Copyright (c) 2026 by Bruce Link
+//    You may use, edit, run or distribute this file as long as the above
+//    copyright notice remains
+// *****************************************************************************
+//******************************************************************************
+
+//-----------------------------------------------------------------------------
+// Load standard C include files
+//-----------------------------------------------------------------------------
+#include <stdint.h>
+#include <stdbool.h>
+
+//-----------------------------------------------------------------------------
+// Loads MSP launchpad board support macros and definitions
+//-----------------------------------------------------------------------------
+#include <ti/devices/msp/msp.h>
+#include "LaunchPad.h"
+#include "clock.h"
+#include "i2c_bench.h"
+#include "i2c_dma.h"
+#include "num_ascii.h"
+#include "uart.h"
+
+
+//-----------------------------------------------------------------------------
+// Define symbolic constants used by the module
+//-----------------------------------------------------------------------------
+
+// Time given to the STOP of the last burst before the next one is started
+#define I2C_BENCH_GAP_USEC                                                 (100)
+
+#define I2C_BENCH_PERCENT                                                  (100)
+
+
+//-----------------------------------------------------------------------------
+// Define function prototypes used by the module
+//-----------------------------------------------------------------------------
+static void i2c_bench_out_string(const char *string);
+static void i2c_bench_out_u32(uint32_t value);
+
+
+//-----------------------------------------------------------------------------
+// Define global variables and structures here.
+// NOTE: when possible avoid using global variables
+//-----------------------------------------------------------------------------
+
+// Define a structure to hold one benchmark mode. The send function starts
+// (or for the polled mode makes) the whole transfer. A background transfer
+// is still running when the send function returns.
+typedef struct
+{
+  const char *name;
+  uint32_t  (*send)(uint8_t slave, const uint8_t data[], uint16_t length);
+  bool        background;
+} i2c_bench_mode_t;
+
+static const i2c_bench_mode_t g_i2c_bench_modes[I2C_BENCH_NUM_MODES] =
+{
+  {"polled", I2C_mstr_send_stream, false},
+  {"irq",    I2C_mstr_irq_send,    true},
+  {"dma",    I2C_mstr_dma_send,    true}
+};
+
+static uint8_t g_i2c_bench_data[I2C_BENCH_LENGTH];
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function sends I2C_BENCH_RUNS bursts of I2C_BENCH_LENGTH bytes to
+//    the slave with each mode and records, with the cycle counter, how long
+//    each transfer took and how much of that time the CPU spent on it. The
+//    I2C controller and the DMA mode must be set up with I2C_mstr_init()
+//    and I2C_dma_init().
+//
+// INPUT PARAMETERS:
+//    slave - The 7-bit address of the I2C slave device to send to.
+//    fill  - The value of every byte sent.
+//
+// OUTPUT PARAMETERS:
+//    results - timing of each mode, I2C_BENCH_NUM_MODES entries
+//
+// RETURN:
+//    number of entries written to results
+// -----------------------------------------------------------------------------
+uint8_t i2c_bench_run(uint8_t slave, uint8_t fill,
+        i2c_bench_result_t results[])
+{
+  uint32_t status;
+  uint32_t start;
+  uint32_t wait_start;
+  uint32_t last;
+  uint32_t now;
+  uint32_t gap;
+  uint32_t min_gap;
+  uint32_t loops;
+  uint32_t cpu_cycles;
+
+  for (uint16_t idx = 0; idx < I2C_BENCH_LENGTH; idx++)
+  {
+    g_i2c_bench_data[idx] = fill;
+  } /* for */
+
+  cycle_counter_init();
+
+  for (uint8_t mode = 0; mode < I2C_BENCH_NUM_MODES; mode++)
+  {
+    results[mode].name         = g_i2c_bench_modes[mode].name;
+    results[mode].runs         = I2C_BENCH_RUNS;
+    results[mode].status       = I2C_SUCCESS;
+    results[mode].total_cycles = 0;
+    results[mode].cpu_cycles   = 0;
+    results[mode].irqs         = 0;
+
+    for (uint16_t run = 0; run < I2C_BENCH_RUNS; run++)
+    {
+      usec_delay(I2C_BENCH_GAP_USEC);
+      I2C_dma_clear_irq_count();
+
+      start  = cycle_counter_get();
+      status = g_i2c_bench_modes[mode].send(slave, g_i2c_bench_data,
+                                            I2C_BENCH_LENGTH);
+      last   = cycle_counter_get();
+      cpu_cycles = last - start;
+
+      // Spin on the cycle counter until the transfer is done. The shortest
+      // pass is the loop itself, the rest of the time went to interrupts.
+      if (g_i2c_bench_modes[mode].background && (status == I2C_SUCCESS))
+      {
+        wait_start = last;
+        min_gap    = UINT32_MAX;
+        loops      = 0;
+
+        while (I2C_dma_busy())
+        {
+          (void)I2C_dma_check_timeout();
+
+          now = cycle_counter_get();
+          gap = now - last;
+          if (gap < min_gap)
+          {
+            min_gap = gap;
+          } /* if */
+          last = now;
+          loops++;
+        } /* while */
+
+        cpu_cycles += (last - wait_start) - (loops * min_gap);
+        status = I2C_dma_wait();
+      } /* if */
+
+      results[mode].total_cycles += last - start;
+      results[mode].cpu_cycles   += cpu_cycles;
+      results[mode].irqs         += I2C_dma_get_irq_count();
+
+      if (status != I2C_SUCCESS)
+      {
+        results[mode].status = status;
+      } /* if */
+    } /* for */
+  } /* for */
+
+  return (I2C_BENCH_NUM_MODES);
+
+} /* i2c_bench_run */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function sends the benchmark results over the UART as CSV, a
+//    header line followed by one line per mode. The UART must be set up
+//    with UART_init().
+//
+// INPUT PARAMETERS:
+//    results - timing of each mode from i2c_bench_run()
+//    count   - number of entries in results
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    none
+// -----------------------------------------------------------------------------
+void i2c_bench_print_csv(const i2c_bench_result_t results[], uint8_t count)
+{
+  uint32_t cpu_pct;
+
+  i2c_bench_out_string("mode,runs,bytes,status,avg_us,cpu_us,cpu_pct,"
+                       "irqs\r\n");
+
+  for (uint8_t mode = 0; mode < count; mode++)
+  {
+    cpu_pct = 0;
+    if (results[mode].total_cycles != 0)
+    {
+      cpu_pct = (uint32_t)(((uint64_t)results[mode].cpu_cycles *
+                            I2C_BENCH_PERCENT) / results[mode].total_cycles);
+    } /* if */
+
+    i2c_bench_out_string(results[mode].name);
+    UART_out_char(',');
+    i2c_bench_out_u32(results[mode].runs);
+    UART_out_char(',');
+    i2c_bench_out_u32(I2C_BENCH_LENGTH);
+    UART_out_char(',');
+    i2c_bench_out_u32(results[mode].status);
+    UART_out_char(',');
+    i2c_bench_out_u32(cycles_to_usec(results[mode].total_cycles /
+                                     results[mode].runs));
+    UART_out_char(',');
+    i2c_bench_out_u32(cycles_to_usec(results[mode].cpu_cycles /
+                                     results[mode].runs));
+    UART_out_char(',');
+    i2c_bench_out_u32(cpu_pct);
+    UART_out_char(',');
+    i2c_bench_out_u32(results[mode].irqs / results[mode].runs);
+    i2c_bench_out_string("\r\n");
+  } /* for */
+
+} /* i2c_bench_print_csv */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    These functions send a string or an unsigned number (without leading
+//    spaces) over the UART.
+//
+// INPUT PARAMETERS:
+//    string - NULL terminated string to send
+//    value  - number to send
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    none
+// -----------------------------------------------------------------------------
+static void i2c_bench_out_string(const char *string)
+{
+  while (*string != '\0')
+  {
+    UART_out_char(*string++);
+  } /* while */
+} /* i2c_bench_out_string */
+
+static void i2c_bench_out_u32(uint32_t value)
+{
+  char  digits[NUM_ASCII_U32_WIDTH + 1];
+  char *first = digits;
+
+  u32_to_ascii(value, digits);
+  while (*first == ' ')
+  {
+    first++;
+  } /* while */
+
+  i2c_bench_out_string(first);
+
+} /* i2c_bench_out_u32 */
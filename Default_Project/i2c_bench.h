@@ -0,0 +1,105 @@
+// *****************************************************************************
+// ***************************    C Source Code     ****************************
+// *****************************************************************************
+//   DESIGNER NAME:  Bruce Link
+//
+//         VERSION:  1.0
+//
+//       FILE NAME:  i2c_bench.h
+//
+//-----------------------------------------------------------------------------
+// DESCRIPTION
+//    This module measures the CPU cost of sending one burst to an I2C slave
+//    with each I2C master mode (polled, IRQ and DMA) and reports the results
+//    over the UART as CSV, one line per mode:
+//
+//      mode,runs,bytes,status,avg_us,cpu_us,cpu_pct,irqs
+//      polled,10,256,0,23810,23810,100,0
+//      irq,10,256,0,23830,402,1,33
+//      dma,10,256,0,23820,34,0,2
+//
+//    avg_us is the time of one transfer from its start to done. cpu_us is
+//    the part of it the CPU spent on the transfer: all of it for the polled
+//    mode, the start call plus the interrupts for the others. cpu_pct is
+//    cpu_us as a percentage of avg_us and irqs the interrupts taken by one
+//    transfer. status is the I2C status of the last run that failed (0 if
+//    every run passed).
+//
+//    The time taken by interrupts is found by reading the cycle counter in
+//    a tight loop while the transfer runs. The shortest time between two
+//    reads is the loop itself, anything longer was spent in an interrupt.
+//
+//    Typical use, with the PCF8574 of the LCD backpack as the slave:
+//
+//      UART_init(115200);
+//      I2C_mstr_init();
+//      I2C_dma_init();
+//      count = i2c_bench_run(LCD_IIC_ADDRESS, LCD_BACKLIGHT_ENABLE, results);
+//      i2c_bench_print_csv(results, count);
+//
+//    NOTE: Every byte of the burst is the fill byte, pick one the slave
+//          ignores. The LCD backpack only latches it on its pins, and a fill
+//          with the E bit clear leaves the display as it is. Do not run the
+//          benchmark while the I2C scheduler or the LCD service uses the bus.
+//
+//-----------------------------------------------------------------------------
+// DISCLAIMER
+//    This code was developed for educational purposes as part of the CSC202
+//    course at Monroe Community Collage and is provided "as is" without
+//    warranties of any kind, whether express, implied, or statutory.
+//
+//    The author and organization do not warrant the accuracy, completeness, or
+//    reliability of the code. The author and organization shall not be liable
+//    for any direct, indirect, incidental, special, exemplary, or consequential
+//    damages arising out of the use of or inability to use the code, even if
+//    advised of the possibility of such damages.
+//
+//    Use of this code is at your own risk, and it is recommended to validate
+//    and adapt the code for your specific application and hardware
+//    requirements.
+//
+// Copyright (c) 2026 by Bruce Link
+//    You may use, edit, run or distribute this file as long as the above
+//    copyright notice remains
+// *****************************************************************************
+//******************************************************************************
+
+#ifndef __I2C_BENCH_H__
+#define __I2C_BENCH_H__
+
+//-----------------------------------------------------------------------------
+// Load standard C include files
+//-----------------------------------------------------------------------------
+#include <stdint.h>
+
+//-----------------------------------------------------------------------------
+// Define symbolic constants used by the module
+//-----------------------------------------------------------------------------
+
+// Number of modes timed by i2c_bench_run, size the results array with it
+#define I2C_BENCH_NUM_MODES                                                  (3)
+
+// Number of transfers per mode and the length of each burst
+#define I2C_BENCH_RUNS                                                      (10)
+#define I2C_BENCH_LENGTH                                                   (256)
+
+// Define a structure to hold the timing of one mode
+typedef struct
+{
+  const char *name;           // mode name used in the CSV
+  uint16_t    runs;           // number of transfers timed
+  uint32_t    status;         // I2C status of the last failed transfer
+  uint32_t    total_cycles;   // bus clock cycles of all transfers
+  uint32_t    cpu_cycles;     // bus clock cycles the CPU spent on them
+  uint32_t    irqs;           // interrupts taken by all transfers
+} i2c_bench_result_t;
+
+
+// ----------------------------------------------------------------------------
+// Prototype for support functions
+// ----------------------------------------------------------------------------
+uint8_t i2c_bench_run(uint8_t slave, uint8_t fill,
+        i2c_bench_result_t results[]);
+void i2c_bench_print_csv(const i2c_bench_result_t results[], uint8_t count);
+
+#endif /* __I2C_BENCH_H__ */
@@ -0,0 +1,879 @@
+// *****************************************************************************
+// ***************************    C Source Code     ****************************
+// *****************************************************************************
+//   DESIGNER NAME:  Bruce Link
+//
+//         VERSION:  1.0
+//
+//       FILE NAME:  i2c_dma.c
+//
+//-----------------------------------------------------------------------------
+// DESCRIPTION
+//    This module adds an optional DMA transfer mode to the I2C controller
+//    (master) that is configured by I2C_mstr_init() in LaunchPad.c. The I2C
+//    TX and RX FIFO triggers are routed to two DMA channels so that long
+//    bursts are moved between RAM and the I2C FIFO without the CPU. A
+//    transfer completes with two interrupts: one from the DMA channel and
+//    one from the I2C controller.
+//
+//    I2C_mstr_irq_send() is an interrupt driven transfer without the DMA,
+//    kept for comparison. i2c_bench.c measures the CPU cost of the polled,
+//    IRQ and DMA modes.
+//
+//-----------------------------------------------------------------------------
+// DISCLAIMER
+//    This code was developed for educational purposes as part of the CSC202
+//    course at Monroe Community Collage and is provided "as is" without
+//    warranties of any kind, whether express, implied, or statutory.
+//
+//    The author and organization do not warrant the accuracy, completeness, or
+//    reliability of the code. The author and organization shall not be liable
+//    for any direct, indirect, incidental, special, exemplary, or consequential
+//    damages arising out of the use of or inability to use the code, even if
+//    advised of the possibility of such damages.
+//
+//    Use of this code is at your own risk, and it is recommended to validate
+//    and adapt the code for your specific application and hardware
+//    requirements.
+//
+// Copyright (c) 2026 by Bruce Link
+//    You may use, edit, run or distribute this file as long as the above
+//    copyright notice remains
+// *****************************************************************************
+//******************************************************************************
+
+//-----------------------------------------------------------------------------
+// Load standard C include files
+//-----------------------------------------------------------------------------
+#include <stdint.h>
+#include <stdbool.h>
+
+//-----------------------------------------------------------------------------
+// Loads MSP launchpad board support macros and definitions
+//-----------------------------------------------------------------------------
+#include <ti/devices/msp/msp.h>
+#include "LaunchPad.h"
+#include "clock.h"
+#include "i2c_dma.h"
+
+
+//-----------------------------------------------------------------------------
+// Define symbolic constants used by the module
+//-----------------------------------------------------------------------------
+
+// Events that must be seen before a DMA transfer is complete
+#define I2C_DMA_EVENT_DMA_DONE                                         (1U << 0)
+#define I2C_DMA_EVENT_I2C_DONE                                         (1U << 1)
+#define I2C_DMA_EVENT_ALL     (I2C_DMA_EVENT_DMA_DONE | I2C_DMA_EVENT_I2C_DONE)
+
+// I2C controller interrupts used while a DMA transfer is in progress
+#define I2C_DMA_CPU_INT_MASK      (I2C_CPU_INT_IMASK_MTXDONE_SET |            \
+                                   I2C_CPU_INT_IMASK_MRXDONE_SET |            \
+                                   I2C_CPU_INT_IMASK_MNACK_SET |              \
+                                   I2C_CPU_INT_IMASK_MARBLOST_SET)
+
+// I2C controller interrupts used while an IRQ transfer is in progress
+#define I2C_DMA_IRQ_CPU_INT_MASK  (I2C_DMA_CPU_INT_MASK |                     \
+                                   I2C_CPU_INT_IMASK_MTXFIFOTRIG_SET)
+
+
+//-----------------------------------------------------------------------------
+// Define global variables and structures here.
+// NOTE: when possible avoid using global variables
+//-----------------------------------------------------------------------------
+static volatile uint8_t   g_i2c_dma_xfer_type   = I2C_DMA_XFER_IDLE;
+static volatile uint8_t   g_i2c_dma_events      = 0;
+static volatile uint32_t  g_i2c_dma_status      = I2C_SUCCESS;
+static volatile uint32_t  g_i2c_dma_irq_count   = 0;
+static volatile bool      g_i2c_dma_idle_wait   = false;
+static uint8_t            g_i2c_dma_slave       = 0;
+static uint32_t           g_i2c_dma_start       = 0;
+static uint32_t           g_i2c_dma_timeout     = 0;
+static const uint8_t     *g_i2c_dma_irq_data    = NULL;
+static volatile uint16_t  g_i2c_dma_irq_left    = 0;
+static i2c_dma_callback_t g_i2c_dma_callback    = NULL;
+
+
+//-----------------------------------------------------------------------------
+// Define function prototypes used by the module
+//-----------------------------------------------------------------------------
+static uint32_t I2C_dma_timeout_cycles(uint16_t length);
+static void I2C_dma_abort(void);
+static void I2C_dma_fill_fifo(void);
+static void I2C_dma_complete(uint32_t status);
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function prepares the I2C controller and the DMA controller for
+//    DMA transfers. It must be called after I2C_mstr_init(). The I2C TX FIFO
+//    trigger is routed to DMA event 1 and the RX FIFO trigger is routed to
+//    DMA event 0. The two DMA channels are configured for single byte
+//    transfers that are paced by these triggers. Finally, the DMA and I2C
+//    interrupts are enabled in the NVIC.
+//
+// INPUT PARAMETERS:
+//    none
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    none
+// -----------------------------------------------------------------------------
+void I2C_dma_init(void)
+{
+  // Request a DMA transfer whenever the TX FIFO is empty or the RX FIFO
+  // has at least one byte in it
+  I2C_INST->MASTER.MFIFOCTL = (I2C_MFIFOCTL_TXTRIG_EMPTY |
+                               I2C_MFIFOCTL_RXTRIG_LEVEL_1);
+
+  // Route FIFO triggers to the DMA but keep them masked until needed
+  I2C_INST->DMA_TRIG1.IMASK = I2C_DMA_TRIG1_IMASK_MTXFIFOTRIG_CLR;
+  I2C_INST->DMA_TRIG0.IMASK = I2C_DMA_TRIG0_IMASK_MRXFIFOTRIG_CLR;
+
+  // TX channel: memory (incrementing) to MTXDATA (fixed), one byte a trigger
+  DMA->DMATRIG[I2C_DMA_TX_CHAN].DMATCTL = (DMA_DMATCTL_DMATINT_EXTERNAL |
+                          (I2C_DMA_TX_TRIG & DMA_DMATCTL_DMATSEL_MASK));
+  DMA->DMACHAN[I2C_DMA_TX_CHAN].DMADA = (uint32_t)&I2C_INST->MASTER.MTXDATA;
+  DMA->DMACHAN[I2C_DMA_TX_CHAN].DMACTL = (DMA_DMACTL_DMATM_SINGLE |
+                          DMA_DMACTL_DMASRCINCR_INCREMENT |
+                          DMA_DMACTL_DMADSTINCR_UNCHANGED |
+                          DMA_DMACTL_DMASRCWDTH_BYTE |
+                          DMA_DMACTL_DMADSTWDTH_BYTE);
+
+  // RX channel: MRXDATA (fixed) to memory (incrementing), one byte a trigger
+  DMA->DMATRIG[I2C_DMA_RX_CHAN].DMATCTL = (DMA_DMATCTL_DMATINT_EXTERNAL |
+                          (I2C_DMA_RX_TRIG & DMA_DMATCTL_DMATSEL_MASK));
+  DMA->DMACHAN[I2C_DMA_RX_CHAN].DMASA = (uint32_t)&I2C_INST->MASTER.MRXDATA;
+  DMA->DMACHAN[I2C_DMA_RX_CHAN].DMACTL = (DMA_DMACTL_DMATM_SINGLE |
+                          DMA_DMACTL_DMASRCINCR_UNCHANGED |
+                          DMA_DMACTL_DMADSTINCR_INCREMENT |
+                          DMA_DMACTL_DMASRCWDTH_BYTE |
+                          DMA_DMACTL_DMADSTWDTH_BYTE);
+
+  // Only interrupt when a channel has moved its last byte
+  DMA->CPU_INT.IMASK |= ((1U << I2C_DMA_TX_CHAN) | (1U << I2C_DMA_RX_CHAN));
+
+  // I2C controller interrupts are unmasked only during a DMA transfer
+  I2C_INST->CPU_INT.IMASK = 0;
+
+  g_i2c_dma_xfer_type = I2C_DMA_XFER_IDLE;
+  g_i2c_dma_status    = I2C_SUCCESS;
+
+  NVIC_ClearPendingIRQ(DMA_INT_IRQn);
+  NVIC_EnableIRQ(DMA_INT_IRQn);
+  NVIC_ClearPendingIRQ(I2C_INST_INT_IRQN);
+  NVIC_EnableIRQ(I2C_INST_INT_IRQN);
+
+} /* I2C_dma_init */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function registers a function that is called, from interrupt
+//    context, when a DMA transfer has completed. The status of the transfer
+//    is passed to the callback. Passing NULL removes the callback.
+//
+// INPUT PARAMETERS:
+//    callback - pointer to the function to call when a transfer completes
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    none
+// -----------------------------------------------------------------------------
+void I2C_dma_set_callback(i2c_dma_callback_t callback)
+{
+  g_i2c_dma_callback = callback;
+} /* I2C_dma_set_callback */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function starts a non-blocking transfer of multiple bytes to a
+//    specified I2C slave device. The DMA TX channel feeds the I2C TX FIFO
+//    from the data buffer and the I2C controller generates a START, the
+//    whole burst and a STOP. The function returns as soon as the transfer
+//    is started.
+//
+//    NOTE: The data buffer must not be modified until the transfer is done.
+//
+// INPUT PARAMETERS:
+//    slave  - The 7-bit address of the I2C slave device to which data is sent.
+//
+//    data   - Pointer to a buffer of data to be transmitted.
+//
+//    length - The number of bytes (1 to I2C_DMA_MAX_LENGTH) to transmit.
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    I2C_SUCCESS         - if the transfer was started.
+//    I2C_ERR_BUSY        - if a DMA transfer or the I2C controller is busy.
+//    I2C_FIFO_LOAD_ERROR - if the length is not valid.
+// -----------------------------------------------------------------------------
+uint32_t I2C_mstr_dma_send(uint8_t slave, const uint8_t data[],
+         uint16_t length)
+{
+  if ((length == 0) || (length > I2C_DMA_MAX_LENGTH))
+  {
+    return I2C_FIFO_LOAD_ERROR;
+  } /* if */
+
+  if ((g_i2c_dma_xfer_type != I2C_DMA_XFER_IDLE) ||
+      ((I2C_INST->MASTER.MSR & I2C_MSR_IDLE_MASK) == I2C_MSR_IDLE_CLEARED))
+  {
+    return I2C_ERR_BUSY;
+  } /* if */
+
+  // Ensure the TX FIFO is empty before the DMA starts filling it
+  I2C_INST->MASTER.MFIFOCTL |= I2C_MFIFOCTL_TXFLUSH_FLUSH;
+  while ((I2C_INST->MASTER.MFIFOSR & I2C_MFIFOSR_TXFIFOCNT_MASK) !=
+          I2C_MFIFOSR_TXFIFOCNT_MAXIMUM);
+  I2C_INST->MASTER.MFIFOCTL &= ~I2C_MFIFOCTL_TXFLUSH_MASK;
+
+  g_i2c_dma_xfer_type = I2C_DMA_XFER_TX;
+  g_i2c_dma_events    = 0;
+  g_i2c_dma_status    = I2C_SUCCESS;
+  g_i2c_dma_slave     = slave;
+  g_i2c_dma_start     = cycle_counter_get();
+  g_i2c_dma_timeout   = I2C_dma_timeout_cycles(length);
+
+  // Arm the TX DMA channel
+  DMA->DMACHAN[I2C_DMA_TX_CHAN].DMASA = (uint32_t)data;
+  DMA->DMACHAN[I2C_DMA_TX_CHAN].DMASZ = length;
+  DMA->DMACHAN[I2C_DMA_TX_CHAN].DMACTL |= DMA_DMACTL_DMAEN_ENABLE;
+
+  // Clear stale I2C events then unmask controller and FIFO trigger events
+  I2C_INST->CPU_INT.ICLR = I2C_DMA_CPU_INT_MASK;
+  I2C_INST->CPU_INT.IMASK = I2C_DMA_CPU_INT_MASK;
+  I2C_INST->DMA_TRIG1.IMASK = I2C_DMA_TRIG1_IMASK_MTXFIFOTRIG_SET;
+
+  // Set the slave address and start the burst with START and STOP
+  I2C_INST->MASTER.MSA = (slave << I2C_MSA_SADDR_OFS) | I2C_MSA_DIR_TRANSMIT;
+  I2C_INST->MASTER.MCTR = (I2C_MCTR_ACK_DISABLE | I2C_MCTR_START_ENABLE |
+                      I2C_MCTR_STOP_ENABLE | I2C_MCTR_BURSTRUN_ENABLE |
+                      ((length << I2C_MCTR_MBLEN_OFS) & I2C_MCTR_MBLEN_MASK));
+
+  return I2C_SUCCESS;
+
+} /* I2C_mstr_dma_send */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function starts a non-blocking read of multiple bytes from a
+//    specified I2C slave device. The DMA RX channel empties the I2C RX FIFO
+//    into the data buffer while the I2C controller generates a START, the
+//    whole burst and a STOP. The function returns as soon as the transfer
+//    is started.
+//
+//    NOTE: The data buffer is only valid once the transfer is done.
+//
+// INPUT PARAMETERS:
+//    slave  - The 7-bit address of the I2C slave device to read from.
+//
+//    data   - Pointer to a buffer where the received bytes will be stored.
+//
+//    length - The number of bytes (1 to I2C_DMA_MAX_LENGTH) to read.
+//
+// OUTPUT PARAMETERS:
+//    data   - The buffer is filled by the DMA as the bytes are received.
+//
+// RETURN:
+//    I2C_SUCCESS         - if the transfer was started.
+//    I2C_ERR_BUSY        - if a DMA transfer or the I2C controller is busy.
+//    I2C_FIFO_LOAD_ERROR - if the length is not valid.
+// -----------------------------------------------------------------------------
+uint32_t I2C_mstr_dma_read(uint8_t slave, uint8_t data[], uint16_t length)
+{
+  if ((length == 0) || (length > I2C_DMA_MAX_LENGTH))
+  {
+    return I2C_FIFO_LOAD_ERROR;
+  } /* if */
+
+  if ((g_i2c_dma_xfer_type != I2C_DMA_XFER_IDLE) ||
+      ((I2C_INST->MASTER.MSR & I2C_MSR_IDLE_MASK) == I2C_MSR_IDLE_CLEARED))
+  {
+    return I2C_ERR_BUSY;
+  } /* if */
+
+  // Ensure the RX FIFO is empty before the DMA starts draining it
+  I2C_INST->MASTER.MFIFOCTL |= I2C_MFIFOCTL_RXFLUSH_FLUSH;
+  while ((I2C_INST->MASTER.MFIFOSR & I2C_MFIFOSR_RXFIFOCNT_MASK) !=
+          I2C_MFIFOSR_RXFIFOCNT_MINIMUM);
+  I2C_INST->MASTER.MFIFOCTL &= ~I2C_MFIFOCTL_RXFLUSH_MASK;
+
+  g_i2c_dma_xfer_type = I2C_DMA_XFER_RX;
+  g_i2c_dma_events    = 0;
+  g_i2c_dma_status    = I2C_SUCCESS;
+  g_i2c_dma_slave     = slave;
+  g_i2c_dma_start     = cycle_counter_get();
+  g_i2c_dma_timeout   = I2C_dma_timeout_cycles(length);
+
+  // Arm the RX DMA channel
+  DMA->DMACHAN[I2C_DMA_RX_CHAN].DMADA = (uint32_t)data;
+  DMA->DMACHAN[I2C_DMA_RX_CHAN].DMASZ = length;
+  DMA->DMACHAN[I2C_DMA_RX_CHAN].DMACTL |= DMA_DMACTL_DMAEN_ENABLE;
+
+  // Clear stale I2C events then unmask controller and FIFO trigger events
+  I2C_INST->CPU_INT.ICLR = I2C_DMA_CPU_INT_MASK;
+  I2C_INST->CPU_INT.IMASK = I2C_DMA_CPU_INT_MASK;
+  I2C_INST->DMA_TRIG0.IMASK = I2C_DMA_TRIG0_IMASK_MRXFIFOTRIG_SET;
+
+  // Set the slave address and start the burst with START and STOP
+  I2C_INST->MASTER.MSA = (slave << I2C_MSA_SADDR_OFS) | I2C_MSA_DIR_RECEIVE;
+  I2C_INST->MASTER.MCTR = (I2C_MCTR_ACK_ENABLE | I2C_MCTR_START_ENABLE |
+                      I2C_MCTR_STOP_ENABLE | I2C_MCTR_BURSTRUN_ENABLE |
+                      ((length << I2C_MCTR_MBLEN_OFS) & I2C_MCTR_MBLEN_MASK));
+
+  return I2C_SUCCESS;
+
+} /* I2C_mstr_dma_read */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function starts a non-blocking transfer of multiple bytes to a
+//    specified I2C slave device without the DMA. The TX FIFO is filled
+//    here and refilled by the I2C interrupt each time it is empty, one
+//    interrupt for every I2C_DMA_FIFO_DEPTH bytes. The I2C controller
+//    generates a START, the whole burst and a STOP. The transfer finishes
+//    the same way as a DMA transfer, so I2C_dma_busy(), I2C_dma_wait() and
+//    the callback all work with it. It is used to compare the CPU cost of
+//    an interrupt driven transfer with the DMA mode.
+//
+//    NOTE: The data buffer must not be modified until the transfer is done.
+//
+// INPUT PARAMETERS:
+//    slave  - The 7-bit address of the I2C slave device to which data is sent.
+//
+//    data   - Pointer to a buffer of data to be transmitted.
+//
+//    length - The number of bytes (1 to I2C_DMA_MAX_LENGTH) to transmit.
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    I2C_SUCCESS         - if the transfer was started.
+//    I2C_ERR_BUSY        - if a DMA transfer or the I2C controller is busy.
+//    I2C_FIFO_LOAD_ERROR - if the length is not valid.
+// -----------------------------------------------------------------------------
+uint32_t I2C_mstr_irq_send(uint8_t slave, const uint8_t data[],
+         uint16_t length)
+{
+  if ((length == 0) || (length > I2C_DMA_MAX_LENGTH))
+  {
+    return I2C_FIFO_LOAD_ERROR;
+  } /* if */
+
+  if ((g_i2c_dma_xfer_type != I2C_DMA_XFER_IDLE) ||
+      ((I2C_INST->MASTER.MSR & I2C_MSR_IDLE_MASK) == I2C_MSR_IDLE_CLEARED))
+  {
+    return I2C_ERR_BUSY;
+  } /* if */
+
+  // Ensure the TX FIFO is empty before it is filled
+  I2C_INST->MASTER.MFIFOCTL |= I2C_MFIFOCTL_TXFLUSH_FLUSH;
+  while ((I2C_INST->MASTER.MFIFOSR & I2C_MFIFOSR_TXFIFOCNT_MASK) !=
+          I2C_MFIFOSR_TXFIFOCNT_MAXIMUM);
+  I2C_INST->MASTER.MFIFOCTL &= ~I2C_MFIFOCTL_TXFLUSH_MASK;
+
+  g_i2c_dma_xfer_type = I2C_DMA_XFER_IRQ_TX;
+  g_i2c_dma_events    = 0;
+  g_i2c_dma_status    = I2C_SUCCESS;
+  g_i2c_dma_slave     = slave;
+  g_i2c_dma_start     = cycle_counter_get();
+  g_i2c_dma_timeout   = I2C_dma_timeout_cycles(length);
+  g_i2c_dma_irq_data  = data;
+  g_i2c_dma_irq_left  = length;
+
+  // Load the first bytes, the FIFO trigger is unmasked only if more remain
+  I2C_INST->CPU_INT.ICLR = I2C_DMA_IRQ_CPU_INT_MASK;
+  I2C_dma_fill_fifo();
+  if (g_i2c_dma_irq_left != 0)
+  {
+    I2C_INST->CPU_INT.IMASK = I2C_DMA_IRQ_CPU_INT_MASK;
+  } /* if */
+
+  // Set the slave address and start the burst with START and STOP
+  I2C_INST->MASTER.MSA = (slave << I2C_MSA_SADDR_OFS) | I2C_MSA_DIR_TRANSMIT;
+  I2C_INST->MASTER.MCTR = (I2C_MCTR_ACK_DISABLE | I2C_MCTR_START_ENABLE |
+                      I2C_MCTR_STOP_ENABLE | I2C_MCTR_BURSTRUN_ENABLE |
+                      ((length << I2C_MCTR_MBLEN_OFS) & I2C_MCTR_MBLEN_MASK));
+
+  return I2C_SUCCESS;
+
+} /* I2C_mstr_irq_send */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function returns true while a DMA transfer is in progress.
+//
+// INPUT PARAMETERS:
+//    none
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    true  - if a DMA transfer is in progress
+//    false - if the DMA transfer mode is idle
+// -----------------------------------------------------------------------------
+bool I2C_dma_busy(void)
+{
+  return (g_i2c_dma_xfer_type != I2C_DMA_XFER_IDLE);
+} /* I2C_dma_busy */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function checks that the module and the I2C controller are idle
+//    so a new transfer can be started. If a DMA transfer is in progress the
+//    callback is already due when it finishes. If only the controller is
+//    busy (the STOP of the last burst is still on the bus) the controller
+//    STOP interrupt is enabled and the registered callback is called with
+//    I2C_SUCCESS, from interrupt context, once the bus is idle. It must be
+//    called with interrupts disabled.
+//
+// INPUT PARAMETERS:
+//    none
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    true  - if a transfer can be started now
+//    false - if the callback will be called when the bus is free
+// -----------------------------------------------------------------------------
+bool I2C_dma_notify_idle(void)
+{
+  if (g_i2c_dma_xfer_type != I2C_DMA_XFER_IDLE)
+  {
+    return false;
+  } /* if */
+
+  if (g_i2c_dma_idle_wait)
+  {
+    return false;
+  } /* if */
+
+  if ((I2C_INST->MASTER.MSR & I2C_MSR_IDLE_MASK) != I2C_MSR_IDLE_CLEARED)
+  {
+    return true;
+  } /* if */
+
+  g_i2c_dma_idle_wait = true;
+  g_i2c_dma_start     = cycle_counter_get();
+  g_i2c_dma_timeout   = I2C_dma_timeout_cycles(0);
+  I2C_INST->CPU_INT.ICLR  = I2C_CPU_INT_IMASK_MSTOP_SET;
+  I2C_INST->CPU_INT.IMASK = I2C_CPU_INT_IMASK_MSTOP_SET;
+
+  // The STOP may have finished before its flag was cleared
+  if ((I2C_INST->MASTER.MSR & I2C_MSR_IDLE_MASK) != I2C_MSR_IDLE_CLEARED)
+  {
+    I2C_INST->CPU_INT.IMASK = 0;
+    I2C_INST->CPU_INT.ICLR  = I2C_CPU_INT_IMASK_MSTOP_SET;
+    g_i2c_dma_idle_wait = false;
+    return true;
+  } /* if */
+
+  return false;
+
+} /* I2C_dma_notify_idle */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function aborts the current DMA transfer if it has run past its
+//    deadline. The deadline is set when the transfer is started and allows
+//    I2C_DMA_TIMEOUT_MSEC plus the time to move the bytes. An aborted
+//    transfer has both DMA channels stopped and the controller FIFOs
+//    flushed, the bus is recovered with I2C_bus_recover() and the transfer
+//    is finished with I2C_ERR_TIMEOUT, which also calls the registered
+//    callback. A wait started by I2C_dma_notify_idle() that is still
+//    pending after I2C_DMA_TIMEOUT_MSEC is ended the same way. It can be
+//    called from the main loop or from an interrupt.
+//
+// INPUT PARAMETERS:
+//    none
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    true  - if the transfer was aborted
+//    false - if no transfer is in progress or it is still within its time
+// -----------------------------------------------------------------------------
+bool I2C_dma_check_timeout(void)
+{
+  uint32_t primask;
+  bool     idle_wait;
+  bool     expired;
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+
+  idle_wait = g_i2c_dma_idle_wait;
+  expired = (((g_i2c_dma_xfer_type == I2C_DMA_XFER_TX) ||
+              (g_i2c_dma_xfer_type == I2C_DMA_XFER_RX) ||
+              (g_i2c_dma_xfer_type == I2C_DMA_XFER_IRQ_TX) || idle_wait) &&
+             ((cycle_counter_get() - g_i2c_dma_start) > g_i2c_dma_timeout));
+
+  // Stop the hardware and keep the module busy while the bus is recovered
+  if (expired)
+  {
+    I2C_dma_abort();
+    g_i2c_dma_idle_wait = false;
+    g_i2c_dma_xfer_type = I2C_DMA_XFER_ABORT;
+  } /* if */
+
+  __set_PRIMASK(primask);
+
+  if (expired)
+  {
+    I2C_bus_recover();
+
+    primask = __get_PRIMASK();
+    __disable_irq();
+    if (idle_wait)
+    {
+      // No transfer was started, only tell the client the bus is free
+      g_i2c_dma_xfer_type = I2C_DMA_XFER_IDLE;
+      if (g_i2c_dma_callback != NULL)
+      {
+        g_i2c_dma_callback(I2C_ERR_TIMEOUT);
+      } /* if */
+    }
+    else
+    {
+      I2C_dma_complete(I2C_ERR_TIMEOUT);
+    } /* if */
+    __set_PRIMASK(primask);
+  } /* if */
+
+  return expired;
+
+} /* I2C_dma_check_timeout */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function blocks until the current DMA transfer is done or has
+//    been aborted because it ran past its deadline. It only reads module
+//    state and the cycle counter while it waits, it does not poll the I2C
+//    controller. It does not sleep with __WFI() because a stuck transfer
+//    raises no interrupt to wake it up.
+//
+// INPUT PARAMETERS:
+//    none
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    I2C_SUCCESS      - if the last transfer completed successfully.
+//    I2C_ERR_ARB_LOST - if arbitration was lost during the transfer.
+//    I2C_ERR_NACK     - if the slave did not acknowledge the transfer.
+//    I2C_ERR_TIMEOUT  - if the transfer was aborted and the bus recovered.
+// -----------------------------------------------------------------------------
+uint32_t I2C_dma_wait(void)
+{
+  while (g_i2c_dma_xfer_type != I2C_DMA_XFER_IDLE)
+  {
+    I2C_dma_check_timeout();
+  } /* while */
+
+  return (g_i2c_dma_status);
+
+} /* I2C_dma_wait */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    These functions return and clear the number of DMA and I2C interrupts
+//    serviced by this module. i2c_bench.c uses them to count the interrupts
+//    taken by each transfer mode.
+//
+// INPUT PARAMETERS:
+//    none
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    I2C_dma_get_irq_count - number of interrupts serviced
+// -----------------------------------------------------------------------------
+uint32_t I2C_dma_get_irq_count(void)
+{
+  return (g_i2c_dma_irq_count);
+} /* I2C_dma_get_irq_count */
+
+void I2C_dma_clear_irq_count(void)
+{
+  g_i2c_dma_irq_count = 0;
+} /* I2C_dma_clear_irq_count */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function returns the number of bus clock cycles a transfer of
+//    the given length is allowed before it is aborted.
+//
+// INPUT PARAMETERS:
+//    length - number of bytes in the transfer
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    timeout in bus clock cycles
+// -----------------------------------------------------------------------------
+static uint32_t I2C_dma_timeout_cycles(uint16_t length)
+{
+  return ((get_bus_clock_freq() / MSEC_PER_SECOND) *
+          (I2C_DMA_TIMEOUT_MSEC + (length / I2C_DMA_BYTES_PER_MSEC)));
+} /* I2C_dma_timeout_cycles */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function stops a transfer that is stuck on the bus. It masks the
+//    FIFO trigger and I2C controller events, disables both DMA channels,
+//    drops any interrupt they left pending, ends the burst and flushes the
+//    controller FIFOs. It must be called with interrupts disabled.
+//
+// INPUT PARAMETERS:
+//    none
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    none
+// -----------------------------------------------------------------------------
+static void I2C_dma_abort(void)
+{
+  I2C_INST->DMA_TRIG1.IMASK = I2C_DMA_TRIG1_IMASK_MTXFIFOTRIG_CLR;
+  I2C_INST->DMA_TRIG0.IMASK = I2C_DMA_TRIG0_IMASK_MRXFIFOTRIG_CLR;
+  I2C_INST->CPU_INT.IMASK = 0;
+
+  DMA->DMACHAN[I2C_DMA_TX_CHAN].DMACTL &= ~DMA_DMACTL_DMAEN_MASK;
+  DMA->DMACHAN[I2C_DMA_RX_CHAN].DMACTL &= ~DMA_DMACTL_DMAEN_MASK;
+
+  DMA->CPU_INT.ICLR = ((1U << I2C_DMA_TX_CHAN) | (1U << I2C_DMA_RX_CHAN));
+  I2C_INST->CPU_INT.ICLR = I2C_DMA_CPU_INT_MASK;
+  NVIC_ClearPendingIRQ(DMA_INT_IRQn);
+  NVIC_ClearPendingIRQ(I2C_INST_INT_IRQN);
+
+  I2C_INST->MASTER.MCTR = 0;
+
+  I2C_INST->MASTER.MFIFOCTL |= (I2C_MFIFOCTL_TXFLUSH_FLUSH |
+                                I2C_MFIFOCTL_RXFLUSH_FLUSH);
+  while ((I2C_INST->MASTER.MFIFOSR & I2C_MFIFOSR_TXFIFOCNT_MASK) !=
+          I2C_MFIFOSR_TXFIFOCNT_MAXIMUM);
+  while ((I2C_INST->MASTER.MFIFOSR & I2C_MFIFOSR_RXFIFOCNT_MASK) !=
+          I2C_MFIFOSR_RXFIFOCNT_MINIMUM);
+  I2C_INST->MASTER.MFIFOCTL &= ~(I2C_MFIFOCTL_TXFLUSH_MASK |
+                                 I2C_MFIFOCTL_RXFLUSH_MASK);
+
+} /* I2C_dma_abort */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function moves bytes of an IRQ transfer into the TX FIFO until it
+//    is full or every byte is in it. Once the last byte is in the FIFO the
+//    FIFO trigger is masked and the transfer waits for the controller, the
+//    same as a DMA transfer whose channel has moved its last byte.
+//
+// INPUT PARAMETERS:
+//    none
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    none
+// -----------------------------------------------------------------------------
+static void I2C_dma_fill_fifo(void)
+{
+  while ((g_i2c_dma_irq_left != 0) &&
+         ((I2C_INST->MASTER.MFIFOSR & I2C_MFIFOSR_TXFIFOCNT_MASK) != 0))
+  {
+    I2C_INST->MASTER.MTXDATA = *g_i2c_dma_irq_data++;
+    g_i2c_dma_irq_left--;
+  } /* while */
+
+  if (g_i2c_dma_irq_left == 0)
+  {
+    I2C_INST->CPU_INT.IMASK = I2C_DMA_CPU_INT_MASK;
+    g_i2c_dma_events |= I2C_DMA_EVENT_DMA_DONE;
+  } /* if */
+
+} /* I2C_dma_fill_fifo */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function finishes the current DMA transfer. It masks the FIFO
+//    trigger and I2C controller events, disables both DMA channels, saves
+//    the transfer status, records it in the health statistics of the slave
+//    device and calls the registered callback.
+//
+// INPUT PARAMETERS:
+//    status - the I2C status code of the transfer
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    none
+// -----------------------------------------------------------------------------
+static void I2C_dma_complete(uint32_t status)
+{
+  I2C_INST->DMA_TRIG1.IMASK = I2C_DMA_TRIG1_IMASK_MTXFIFOTRIG_CLR;
+  I2C_INST->DMA_TRIG0.IMASK = I2C_DMA_TRIG0_IMASK_MRXFIFOTRIG_CLR;
+  I2C_INST->CPU_INT.IMASK = 0;
+
+  DMA->DMACHAN[I2C_DMA_TX_CHAN].DMACTL &= ~DMA_DMACTL_DMAEN_MASK;
+  DMA->DMACHAN[I2C_DMA_RX_CHAN].DMACTL &= ~DMA_DMACTL_DMAEN_MASK;
+
+  g_i2c_dma_status    = status;
+  g_i2c_dma_xfer_type = I2C_DMA_XFER_IDLE;
+
+  I2C_record_dev_stats(g_i2c_dma_slave, status,
+                       cycles_to_usec(cycle_counter_get() - g_i2c_dma_start));
+
+  if (g_i2c_dma_callback != NULL)
+  {
+    g_i2c_dma_callback(status);
+  } /* if */
+
+} /* I2C_dma_complete */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    DMA interrupt service routine. It is executed when one of the I2C DMA
+//    channels has moved its last byte. For a read this means all the data
+//    is in RAM. For a write the last byte is in the TX FIFO and the transfer
+//    finishes when the I2C controller reports that it is done.
+//
+// INPUT PARAMETERS:
+//    none
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    none
+// -----------------------------------------------------------------------------
+void DMA_IRQHandler(void)
+{
+  uint32_t int_idx;
+
+  g_i2c_dma_irq_count++;
+
+  // Reading IIDX clears the highest priority pending channel interrupt
+  while ((int_idx = DMA->CPU_INT.IIDX) != DMA_CPU_INT_IIDX_STAT_NO_INTR)
+  {
+    if ((int_idx == (DMA_CPU_INT_IIDX_STAT_DMACH0 + I2C_DMA_TX_CHAN)) ||
+        (int_idx == (DMA_CPU_INT_IIDX_STAT_DMACH0 + I2C_DMA_RX_CHAN)))
+    {
+      if (g_i2c_dma_xfer_type != I2C_DMA_XFER_IDLE)
+      {
+        g_i2c_dma_events |= I2C_DMA_EVENT_DMA_DONE;
+
+        if (g_i2c_dma_events == I2C_DMA_EVENT_ALL)
+        {
+          I2C_dma_complete(I2C_SUCCESS);
+        } /* if */
+      } /* if */
+    } /* if */
+  } /* while */
+
+} /* DMA_IRQHandler */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    I2C controller interrupt service routine. It is executed when the
+//    controller has finished the burst or when the burst has failed. An
+//    error ends the transfer immediately and stops the DMA channel. It also
+//    refills the TX FIFO of an IRQ transfer and reports the STOP interrupt
+//    armed by I2C_dma_notify_idle().
+//
+// INPUT PARAMETERS:
+//    none
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    none
+// -----------------------------------------------------------------------------
+void I2C_INST_IRQHandler(void)
+{
+  uint32_t int_idx;
+
+  g_i2c_dma_irq_count++;
+
+  while ((int_idx = I2C_INST->CPU_INT.IIDX) != I2C_CPU_INT_IIDX_STAT_NO_INTR)
+  {
+    // The bus went idle while a client was waiting for it
+    if ((int_idx == I2C_CPU_INT_IIDX_STAT_MSTOPFG) && g_i2c_dma_idle_wait)
+    {
+      I2C_INST->CPU_INT.IMASK = 0;
+      g_i2c_dma_idle_wait = false;
+      if (g_i2c_dma_callback != NULL)
+      {
+        g_i2c_dma_callback(I2C_SUCCESS);
+      } /* if */
+      continue;
+    } /* if */
+
+    if ((g_i2c_dma_xfer_type != I2C_DMA_XFER_TX) &&
+        (g_i2c_dma_xfer_type != I2C_DMA_XFER_RX) &&
+        (g_i2c_dma_xfer_type != I2C_DMA_XFER_IRQ_TX))
+    {
+      continue;
+    } /* if */
+
+    switch (int_idx)
+    {
+      case I2C_CPU_INT_IIDX_STAT_MTXFIFOTRIG:
+        if (g_i2c_dma_xfer_type == I2C_DMA_XFER_IRQ_TX)
+        {
+          I2C_dma_fill_fifo();
+        } /* if */
+        break;
+
+      case I2C_CPU_INT_IIDX_STAT_MTXDONEFG:
+      case I2C_CPU_INT_IIDX_STAT_MRXDONEFG:
+        g_i2c_dma_events |= I2C_DMA_EVENT_I2C_DONE;
+        if (g_i2c_dma_events == I2C_DMA_EVENT_ALL)
+        {
+          I2C_dma_complete(I2C_SUCCESS);
+        } /* if */
+        break;
+
+      case I2C_CPU_INT_IIDX_STAT_MNACKFG:
+        I2C_dma_complete(I2C_ERR_NACK);
+        break;
+
+      case I2C_CPU_INT_IIDX_STAT_MARBLOSTFG:
+        I2C_dma_complete(I2C_ERR_ARB_LOST);
+        break;
+
+      default:
+        break;
+    } /* switch */
+  } /* while */
+
+} /* I2C_INST_IRQHandler */
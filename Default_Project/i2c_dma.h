@@ -0,0 +1,121 @@
+// *****************************************************************************
+// ***************************    C Source Code     ****************************
+// *****************************************************************************
+//   DESIGNER NAME:  Bruce Link
+//
+//         VERSION:  1.0
+//
+//       FILE NAME:  i2c_dma.h
+//
+//-----------------------------------------------------------------------------
+// DESCRIPTION
+//    This module adds an optional DMA transfer mode to the I2C controller
+//    (master) that is configured by I2C_mstr_init() in LaunchPad.c. The I2C
+//    TX and RX FIFO triggers are routed to two DMA channels so that long
+//    bursts (a full LCD frame, an EEPROM page, etc.) are moved between RAM
+//    and the I2C FIFO without the CPU. The CPU only sees two interrupts per
+//    transfer:
+//      - DMA_IRQHandler   when the DMA channel has moved the last byte
+//      - I2C1_IRQHandler  when the controller reports the burst is done
+//                         (or that the slave NACKed / arbitration was lost)
+//
+//    Transfers are non-blocking. The application can poll I2C_dma_busy(),
+//    block with I2C_dma_wait(), or register a callback that is executed
+//    from interrupt context when the transfer is complete. A transfer that
+//    runs past its deadline (for example a slave that holds SCL low) is
+//    aborted by I2C_dma_wait() or by a call to I2C_dma_check_timeout(). The
+//    bus is then recovered and the transfer ends with I2C_ERR_TIMEOUT.
+//
+//    For comparison, I2C_mstr_irq_send() moves a burst without the DMA.
+//    The I2C interrupt refills the TX FIFO each time it empties, so the CPU
+//    sees one interrupt for every I2C_DMA_FIFO_DEPTH bytes. It finishes
+//    the same way as a DMA transfer. See i2c_bench.h for the benchmark
+//    that compares the CPU cost of the polled, IRQ and DMA modes.
+//
+//    The polled I2C_mstr_* functions can still be used when no DMA transfer
+//    is in progress.
+//
+//-----------------------------------------------------------------------------
+// DISCLAIMER
+//    This code was developed for educational purposes as part of the CSC202
+//    course at Monroe Community Collage and is provided "as is" without
+//    warranties of any kind, whether express, implied, or statutory.
+//
+//    The author and organization do not warrant the accuracy, completeness, or
+//    reliability of the code. The author and organization shall not be liable
+//    for any direct, indirect, incidental, special, exemplary, or consequential
+//    damages arising out of the use of or inability to use the code, even if
+//    advised of the possibility of such damages.
+//
+//    Use of this code is at your own risk, and it is recommended to validate
+//    and adapt the code for your specific application and hardware
+//    requirements.
+//
+// Copyright (c) 2026 by Bruce Link
+//    You may use, edit, run or distribute this file as long as the above
+//    copyright notice remains
+// *****************************************************************************
+//******************************************************************************
+
+#ifndef __I2C_DMA_H__
+#define __I2C_DMA_H__
+
+//-----------------------------------------------------------------------------
+// Load standard C include files
+//-----------------------------------------------------------------------------
+#include <stdint.h>
+#include <stdbool.h>
+
+//-----------------------------------------------------------------------------
+// Define symbolic constants used by the module
+//-----------------------------------------------------------------------------
+
+// DMA channels used for the I2C controller FIFOs
+#define I2C_DMA_TX_CHAN                                                      (0)
+#define I2C_DMA_RX_CHAN                                                      (1)
+
+// DMA trigger sources published by the I2C controller
+#define I2C_DMA_TX_TRIG                                         (DMA_I2C1_TX_TRIG)
+#define I2C_DMA_RX_TRIG                                         (DMA_I2C1_RX_TRIG)
+
+// MBLEN field of MCTR is 12-bits wide
+#define I2C_DMA_MAX_LENGTH                                                (4095)
+
+// Number of bytes the I2C controller TX FIFO holds
+#define I2C_DMA_FIFO_DEPTH                                                   (8)
+
+// Types of DMA transfers
+#define I2C_DMA_XFER_IDLE                                                    (0)
+#define I2C_DMA_XFER_TX                                                      (1)
+#define I2C_DMA_XFER_RX                                                      (2)
+#define I2C_DMA_XFER_ABORT                                                   (3)
+#define I2C_DMA_XFER_IRQ_TX                                                  (4)
+
+// A transfer that is not done I2C_DMA_TIMEOUT_MSEC after it started, plus
+// one millisecond for every I2C_DMA_BYTES_PER_MSEC bytes, is aborted. A
+// 100kHz bus moves about 11 bytes a millisecond.
+#define I2C_DMA_TIMEOUT_MSEC                                                (20)
+#define I2C_DMA_BYTES_PER_MSEC                                              (10)
+
+// Function prototype for the transfer complete callback
+typedef void (*i2c_dma_callback_t)(uint32_t status);
+
+
+// ----------------------------------------------------------------------------
+// Prototype for support functions
+// ----------------------------------------------------------------------------
+void I2C_dma_init(void);
+void I2C_dma_set_callback(i2c_dma_callback_t callback);
+uint32_t I2C_mstr_dma_send(uint8_t slave, const uint8_t data[],
+         uint16_t length);
+uint32_t I2C_mstr_dma_read(uint8_t slave, uint8_t data[], uint16_t length);
+uint32_t I2C_mstr_irq_send(uint8_t slave, const uint8_t data[],
+         uint16_t length);
+bool I2C_dma_busy(void);
+bool I2C_dma_notify_idle(void);
+bool I2C_dma_check_timeout(void);
+uint32_t I2C_dma_wait(void);
+uint32_t I2C_dma_get_irq_count(void);
+void I2C_dma_clear_irq_count(void);
+
+#endif /* __I2C_DMA_H__ */
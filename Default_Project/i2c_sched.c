@@ -0,0 +1,679 @@
+// *****************************************************************************
+// ***************************    C Source Code     ****************************
+// *****************************************************************************
+//   DESIGNER NAME:  Bruce Link
+//
+//         VERSION:  1.0
+//
+//       FILE NAME:  i2c_sched.c
+//
+//-----------------------------------------------------------------------------
+// DESCRIPTION
+//    This module arbitrates the I2C bus between several device drivers.
+//    Each driver registers as a client and queues its transactions with
+//    I2C_sched_write() or I2C_sched_read(). One transaction runs at a time
+//    in the I2C DMA mode. When it completes, the DMA callback picks the next
+//    transaction, so a high priority client (e.g. a sensor read) never waits
+//    behind more than the one transaction that is already on the bus, while
+//    bulk traffic (e.g. LCD refreshes) keeps running in the background.
+//
+//    Clients of equal priority are served with a deficit round robin. Each
+//    round a waiting client earns (share * I2C_SCHED_QUANTUM_BYTES) bytes of
+//    credit and a transaction is started only when the client has enough
+//    credit to cover its length. Over time each client gets bus bytes in
+//    proportion to its share.
+//
+//    The time a transaction spends in the queue is measured with the cycle
+//    counter and is kept per client as wait time statistics.
+//
+//-----------------------------------------------------------------------------
+// DISCLAIMER
+//    This code was developed for educational purposes as part of the CSC202
+//    course at Monroe Community Collage and is provided "as is" without
+//    warranties of any kind, whether express, implied, or statutory.
+//
+//    The author and organization do not warrant the accuracy, completeness, or
+//    reliability of the code. The author and organization shall not be liable
+//    for any direct, indirect, incidental, special, exemplary, or consequential
+//    damages arising out of the use of or inability to use the code, even if
+//    advised of the possibility of such damages.
+//
+//    Use of this code is at your own risk, and it is recommended to validate
+//    and adapt the code for your specific application and hardware
+//    requirements.
+//
+// Copyright (c) 2026 by Bruce Link
+//    You may use, edit, run or distribute this file as long as the above
+//    copyright notice remains
+// *****************************************************************************
+//******************************************************************************
+
+//-----------------------------------------------------------------------------
+// Load standard C include files
+//-----------------------------------------------------------------------------
+#include <string.h>
+
+//-----------------------------------------------------------------------------
+// Loads MSP launchpad board support macros and definitions
+//-----------------------------------------------------------------------------
+#include <ti/devices/msp/msp.h>
+#include "LaunchPad.h"
+#include "clock.h"
+#include "i2c_dma.h"
+#include "i2c_sched.h"
+
+
+//-----------------------------------------------------------------------------
+// Define symbolic constants used by the module
+//-----------------------------------------------------------------------------
+#define I2C_SCHED_NO_CLIENT                                               (0xFF)
+
+
+//-----------------------------------------------------------------------------
+// Define global variables and structures here.
+// NOTE: when possible avoid using global variables
+//-----------------------------------------------------------------------------
+
+// Define a structure to hold the state of a registered client
+typedef struct
+{
+  uint8_t            priority;
+  uint8_t            share;
+  int32_t            deficit;
+  i2c_sched_xfer_t  *head;
+  i2c_sched_xfer_t  *tail;
+  i2c_sched_stats_t  stats;
+} i2c_sched_client_t;
+
+static i2c_sched_client_t         g_i2c_sched_client[I2C_SCHED_MAX_CLIENTS];
+static uint8_t                    g_i2c_sched_client_count  = 0;
+static uint8_t                    g_i2c_sched_next_client   = 0;
+static uint8_t                    g_i2c_sched_active_client = 0;
+static i2c_sched_xfer_t *volatile g_i2c_sched_active        = NULL;
+
+
+//-----------------------------------------------------------------------------
+// Define function prototypes used by the module
+//-----------------------------------------------------------------------------
+static uint32_t I2C_sched_submit(uint8_t client, i2c_sched_xfer_t *xfer,
+                uint8_t slave, uint8_t direction, uint8_t data[],
+                uint16_t length);
+static bool I2C_sched_queued(void);
+static uint8_t I2C_sched_pick(void);
+static void I2C_sched_dispatch(void);
+static void I2C_sched_finish(i2c_sched_xfer_t *xfer, uint32_t status);
+static void I2C_sched_dma_done(uint32_t status);
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function resets the scheduler, removes all clients and registers
+//    the scheduler as the completion callback of the I2C DMA mode. It must
+//    be called after I2C_mstr_init() and I2C_dma_init().
+//
+// INPUT PARAMETERS:
+//    none
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    none
+// -----------------------------------------------------------------------------
+void I2C_sched_init(void)
+{
+  memset(g_i2c_sched_client, 0, sizeof(g_i2c_sched_client));
+  g_i2c_sched_client_count = 0;
+  g_i2c_sched_next_client  = 0;
+  g_i2c_sched_active       = NULL;
+
+  I2C_dma_set_callback(I2C_sched_dma_done);
+
+} /* I2C_sched_init */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function registers a new client of the I2C bus.
+//
+// INPUT PARAMETERS:
+//    priority - 0 is the highest priority. A queued transaction of a higher
+//               priority client is always started before any transaction of
+//               a lower priority client.
+//
+//    share    - relative bandwidth share (1 to 255) among the clients that
+//               have the same priority. A share of 0 is treated as 1.
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    client id to pass to the other functions, or I2C_SCHED_INVALID_CLIENT
+//    if all I2C_SCHED_MAX_CLIENTS client slots are in use.
+// -----------------------------------------------------------------------------
+uint8_t I2C_sched_register(uint8_t priority, uint8_t share)
+{
+  uint8_t client;
+
+  if (g_i2c_sched_client_count >= I2C_SCHED_MAX_CLIENTS)
+  {
+    return I2C_SCHED_INVALID_CLIENT;
+  } /* if */
+
+  client = g_i2c_sched_client_count;
+  memset(&g_i2c_sched_client[client], 0, sizeof(i2c_sched_client_t));
+  g_i2c_sched_client[client].priority = priority;
+  g_i2c_sched_client[client].share    = (share == 0) ? 1 : share;
+  g_i2c_sched_client_count++;
+
+  return client;
+
+} /* I2C_sched_register */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    These functions queue a transaction that writes bytes to, or reads
+//    bytes from, an I2C slave device. The transaction is started right away
+//    if the bus is free, otherwise it is started by the scheduler when it is
+//    the best candidate at a transaction boundary. The functions do not
+//    wait for the transaction to finish.
+//
+//    If the callback field of the transaction is not NULL, it is called
+//    from interrupt context when the transaction is done. Set it (or clear
+//    it) before calling these functions.
+//
+// INPUT PARAMETERS:
+//    client - client id returned by I2C_sched_register()
+//
+//    xfer   - pointer to a transaction structure owned by the caller. It
+//             and the data buffer must stay valid until the transaction is
+//             done. Its state field must be I2C_SCHED_XFER_DONE (a zero
+//             initialized structure) the first time it is used.
+//
+//    slave  - The 7-bit address of the I2C slave device.
+//
+//    data   - Pointer to the bytes to send or to a buffer for the bytes read
+//
+//    length - The number of bytes (1 to I2C_DMA_MAX_LENGTH) to transfer.
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    I2C_SUCCESS         - if the transaction was queued.
+//    I2C_ERR_BUSY        - if the transaction structure is already queued,
+//                          it is left unchanged.
+//    I2C_FIFO_LOAD_ERROR - if the client id or the length is not valid.
+// -----------------------------------------------------------------------------
+uint32_t I2C_sched_write(uint8_t client, i2c_sched_xfer_t *xfer,
+         uint8_t slave, uint8_t data[], uint16_t length)
+{
+  return (I2C_sched_submit(client, xfer, slave, I2C_SCHED_WRITE, data,
+                           length));
+
+} /* I2C_sched_write */
+
+uint32_t I2C_sched_read(uint8_t client, i2c_sched_xfer_t *xfer,
+         uint8_t slave, uint8_t data[], uint16_t length)
+{
+  return (I2C_sched_submit(client, xfer, slave, I2C_SCHED_READ, data,
+                           length));
+
+} /* I2C_sched_read */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function returns true once a queued transaction has finished.
+//
+// INPUT PARAMETERS:
+//    xfer - pointer to the transaction
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    true  - if the transaction is done (its status field is valid)
+//    false - if the transaction is still queued or on the bus
+// -----------------------------------------------------------------------------
+bool I2C_sched_xfer_done(const i2c_sched_xfer_t *xfer)
+{
+  return (xfer->state == I2C_SCHED_XFER_DONE);
+} /* I2C_sched_xfer_done */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function blocks until a queued transaction has finished. While it
+//    waits it calls I2C_sched_tick(), so a transaction ahead of it, or the
+//    transaction itself, that is stuck on the bus is ended at its deadline
+//    and the wait is bounded. It does not sleep with __WFI() because a stuck
+//    bus raises no interrupt to wake it up.
+//
+// INPUT PARAMETERS:
+//    xfer - pointer to the transaction
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    The I2C status code of the transaction (I2C_SUCCESS, I2C_ERR_NACK, ...)
+// -----------------------------------------------------------------------------
+uint32_t I2C_sched_wait(const i2c_sched_xfer_t *xfer)
+{
+  while (xfer->state != I2C_SCHED_XFER_DONE)
+  {
+    I2C_sched_tick();
+  } /* while */
+
+  return (xfer->status);
+
+} /* I2C_sched_wait */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function checks the deadline of the transaction on the bus. A
+//    transaction that has not finished by its deadline (see
+//    I2C_dma_check_timeout()) is aborted, the bus is recovered and the
+//    transaction is finished with I2C_ERR_TIMEOUT. The next client is then
+//    served. The same applies to a bus that does not go idle before the
+//    next transaction can start. Call it from a periodic interrupt, such
+//    as SysTick_Handler(), or from the main loop.
+//
+// INPUT PARAMETERS:
+//    none
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    none
+// -----------------------------------------------------------------------------
+void I2C_sched_tick(void)
+{
+  (void)I2C_dma_check_timeout();
+} /* I2C_sched_tick */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    These functions return and clear the statistics of a client. The wait
+//    time is the time between queuing a transaction and starting it on the
+//    bus.
+//
+// INPUT PARAMETERS:
+//    client - client id returned by I2C_sched_register()
+//
+// OUTPUT PARAMETERS:
+//    stats  - copy of the statistics of the client
+//
+// RETURN:
+//    I2C_sched_get_stats - true if the client id is valid, false otherwise
+// -----------------------------------------------------------------------------
+bool I2C_sched_get_stats(uint8_t client, i2c_sched_stats_t *stats)
+{
+  uint32_t primask;
+
+  if (client >= g_i2c_sched_client_count)
+  {
+    return false;
+  } /* if */
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  *stats = g_i2c_sched_client[client].stats;
+  __set_PRIMASK(primask);
+
+  return true;
+
+} /* I2C_sched_get_stats */
+
+void I2C_sched_clear_stats(uint8_t client)
+{
+  uint32_t primask;
+
+  if (client < g_i2c_sched_client_count)
+  {
+    primask = __get_PRIMASK();
+    __disable_irq();
+    memset(&g_i2c_sched_client[client].stats, 0, sizeof(i2c_sched_stats_t));
+    __set_PRIMASK(primask);
+  } /* if */
+
+} /* I2C_sched_clear_stats */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function fills in a transaction and adds it to the tail of the
+//    queue of a client, then starts the scheduler if the bus is free. The
+//    transaction and the queue are updated with interrupts disabled because
+//    the DMA callback also walks the queues. A transaction that is still
+//    queued or on the bus is left as it is.
+//
+// INPUT PARAMETERS:
+//    client    - client id returned by I2C_sched_register()
+//
+//    xfer      - pointer to the transaction to queue
+//
+//    slave     - The 7-bit address of the I2C slave device.
+//
+//    direction - I2C_SCHED_WRITE or I2C_SCHED_READ
+//
+//    data      - Pointer to the bytes to send or to a buffer for the bytes
+//
+//    length    - The number of bytes (1 to I2C_DMA_MAX_LENGTH) to transfer.
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    I2C_SUCCESS, I2C_ERR_BUSY or I2C_FIFO_LOAD_ERROR
+// -----------------------------------------------------------------------------
+static uint32_t I2C_sched_submit(uint8_t client, i2c_sched_xfer_t *xfer,
+                uint8_t slave, uint8_t direction, uint8_t data[],
+                uint16_t length)
+{
+  i2c_sched_client_t *cl;
+  uint32_t primask;
+
+  if ((client >= g_i2c_sched_client_count) || (length == 0) ||
+      (length > I2C_DMA_MAX_LENGTH))
+  {
+    return I2C_FIFO_LOAD_ERROR;
+  } /* if */
+
+  cl = &g_i2c_sched_client[client];
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+
+  if (xfer->state != I2C_SCHED_XFER_DONE)
+  {
+    __set_PRIMASK(primask);
+    return I2C_ERR_BUSY;
+  } /* if */
+
+  xfer->slave         = slave;
+  xfer->direction     = direction;
+  xfer->data          = data;
+  xfer->length        = length;
+  xfer->state         = I2C_SCHED_XFER_QUEUED;
+  xfer->status        = I2C_SUCCESS;
+  xfer->queued_cycles = cycle_counter_get();
+  xfer->next          = NULL;
+
+  if (cl->tail == NULL)
+  {
+    cl->head = xfer;
+  }
+  else
+  {
+    cl->tail->next = xfer;
+  } /* if */
+  cl->tail = xfer;
+
+  I2C_sched_dispatch();
+
+  __set_PRIMASK(primask);
+
+  return I2C_SUCCESS;
+
+} /* I2C_sched_submit */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function returns true if any client has a queued transaction.
+//
+// INPUT PARAMETERS:
+//    none
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    true  - if a transaction is waiting for the bus
+//    false - if all the queues are empty
+// -----------------------------------------------------------------------------
+static bool I2C_sched_queued(void)
+{
+  for (uint8_t client = 0; client < g_i2c_sched_client_count; client++)
+  {
+    if (g_i2c_sched_client[client].head != NULL)
+    {
+      return true;
+    } /* if */
+  } /* for */
+
+  return false;
+
+} /* I2C_sched_queued */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function selects the client whose transaction goes on the bus
+//    next. Only clients at the highest waiting priority are considered. They
+//    are visited in round robin order starting after the client served
+//    last, and each visit adds one quantum of credit until a client has
+//    enough credit for the transaction at the head of its queue. A client
+//    whose queue is empty loses its credit so it can not save up bandwidth
+//    while idle.
+//
+// INPUT PARAMETERS:
+//    none
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    client id, or I2C_SCHED_NO_CLIENT if no transaction is queued
+// -----------------------------------------------------------------------------
+static uint8_t I2C_sched_pick(void)
+{
+  i2c_sched_client_t *cl;
+  uint8_t best_priority = 0xFF;
+  bool    found         = false;
+  uint8_t client;
+  uint8_t idx;
+
+  for (client = 0; client < g_i2c_sched_client_count; client++)
+  {
+    cl = &g_i2c_sched_client[client];
+    if (cl->head == NULL)
+    {
+      cl->deficit = 0;
+    }
+    else if (!found || (cl->priority < best_priority))
+    {
+      best_priority = cl->priority;
+      found = true;
+    } /* if */
+  } /* for */
+
+  if (!found)
+  {
+    return I2C_SCHED_NO_CLIENT;
+  } /* if */
+
+  // Every pass gives each waiting client more credit, so this terminates
+  idx = g_i2c_sched_next_client;
+  while (true)
+  {
+    if (idx >= g_i2c_sched_client_count)
+    {
+      idx = 0;
+    } /* if */
+
+    cl = &g_i2c_sched_client[idx];
+    if ((cl->head != NULL) && (cl->priority == best_priority))
+    {
+      if (cl->deficit >= (int32_t)cl->head->length)
+      {
+        cl->deficit -= cl->head->length;
+        g_i2c_sched_next_client = idx;
+        return idx;
+      } /* if */
+
+      cl->deficit += (int32_t)cl->share * I2C_SCHED_QUANTUM_BYTES;
+    } /* if */
+
+    idx++;
+  } /* while */
+
+} /* I2C_sched_pick */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function starts the next transaction when the bus is free. It is
+//    called with interrupts disabled or from the DMA callback. A transaction
+//    that can not be started is finished with the error and the next one is
+//    tried.
+//
+//    The DMA callback runs as soon as the controller reports the burst is
+//    done, which can be slightly before the STOP condition has finished.
+//    Rather than wait for the controller here, in interrupt context, the
+//    function returns and I2C_dma_notify_idle() calls the DMA callback
+//    again from the STOP interrupt, which dispatches from there.
+//
+// INPUT PARAMETERS:
+//    none
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    none
+// -----------------------------------------------------------------------------
+static void I2C_sched_dispatch(void)
+{
+  i2c_sched_client_t *cl;
+  i2c_sched_xfer_t   *xfer;
+  uint32_t wait_us;
+  uint32_t status;
+  uint8_t  client;
+
+  while ((g_i2c_sched_active == NULL) && I2C_sched_queued())
+  {
+    if (!I2C_dma_notify_idle())
+    {
+      return;
+    } /* if */
+
+    client = I2C_sched_pick();
+    if (client == I2C_SCHED_NO_CLIENT)
+    {
+      return;
+    } /* if */
+
+    // Remove the transaction from the head of the queue
+    cl = &g_i2c_sched_client[client];
+    xfer = cl->head;
+    cl->head = xfer->next;
+    if (cl->head == NULL)
+    {
+      cl->tail = NULL;
+    } /* if */
+    xfer->next = NULL;
+
+    // Update wait time statistics of the client
+    wait_us = cycles_to_usec(cycle_counter_get() - xfer->queued_cycles);
+    cl->stats.xfer_count++;
+    cl->stats.byte_count    += xfer->length;
+    cl->stats.total_wait_us += wait_us;
+    if (wait_us > cl->stats.max_wait_us)
+    {
+      cl->stats.max_wait_us = wait_us;
+    } /* if */
+
+    xfer->state = I2C_SCHED_XFER_ACTIVE;
+    g_i2c_sched_active = xfer;
+    g_i2c_sched_active_client = client;
+
+    if (xfer->direction == I2C_SCHED_READ)
+    {
+      status = I2C_mstr_dma_read(xfer->slave, xfer->data, xfer->length);
+    }
+    else
+    {
+      status = I2C_mstr_dma_send(xfer->slave, xfer->data, xfer->length);
+    } /* if */
+
+    if (status != I2C_SUCCESS)
+    {
+      cl->stats.error_count++;
+      g_i2c_sched_active = NULL;
+      I2C_sched_finish(xfer, status);
+    } /* if */
+  } /* while */
+
+} /* I2C_sched_dispatch */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function marks a transaction as done and calls its callback.
+//
+// INPUT PARAMETERS:
+//    xfer   - pointer to the transaction
+//
+//    status - the I2C status code of the transaction
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    none
+// -----------------------------------------------------------------------------
+static void I2C_sched_finish(i2c_sched_xfer_t *xfer, uint32_t status)
+{
+  xfer->status = status;
+  xfer->state  = I2C_SCHED_XFER_DONE;
+
+  if (xfer->callback != NULL)
+  {
+    xfer->callback(xfer);
+  } /* if */
+
+} /* I2C_sched_finish */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function is the I2C DMA completion callback. It finishes the
+//    active transaction and, at this transaction boundary, starts the best
+//    queued transaction. It is also called with no active transaction when
+//    the bus has gone idle after I2C_dma_notify_idle(), and then only
+//    dispatches.
+//
+// INPUT PARAMETERS:
+//    status - the I2C status code of the completed DMA transfer
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    none
+// -----------------------------------------------------------------------------
+static void I2C_sched_dma_done(uint32_t status)
+{
+  i2c_sched_xfer_t *xfer = g_i2c_sched_active;
+
+  if (xfer != NULL)
+  {
+    if (status != I2C_SUCCESS)
+    {
+      g_i2c_sched_client[g_i2c_sched_active_client].stats.error_count++;
+    } /* if */
+
+    g_i2c_sched_active = NULL;
+    I2C_sched_finish(xfer, status);
+  } /* if */
+
+  I2C_sched_dispatch();
+
+} /* I2C_sched_dma_done */
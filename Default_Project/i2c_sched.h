@@ -0,0 +1,123 @@
+// *****************************************************************************
+// ***************************    C Source Code     ****************************
+// *****************************************************************************
+//   DESIGNER NAME:  Bruce Link
+//
+//         VERSION:  1.0
+//
+//       FILE NAME:  i2c_sched.h
+//
+//-----------------------------------------------------------------------------
+// DESCRIPTION
+//    This module is a bus arbiter for devices that share the I2C controller
+//    (for example the LCD1602 backpack and the BOOSTXL-EDUMKII sensors).
+//    Each driver registers as a client with a priority and a bandwidth
+//    share. Transactions are queued per client and dispatched one at a time
+//    using the I2C DMA mode, so the next transaction is chosen at every
+//    transaction boundary:
+//      - The client with the highest priority (lowest number) that has a
+//        queued transaction always goes first.
+//      - Clients with the same priority split the bus by bandwidth share
+//        using a deficit round robin on the number of bytes transferred.
+//
+//    Transactions are described by i2c_sched_xfer_t structures that belong
+//    to the caller and must stay valid until the transaction is done.
+//
+//    Every transaction has a deadline. I2C_sched_tick(), called from a
+//    periodic interrupt and by I2C_sched_wait(), aborts a transaction that
+//    is stuck on the bus, recovers the bus and moves on to the next client.
+//
+//    NOTE: While the scheduler is in use, all traffic on the I2C bus should
+//          go through it. The polled I2C_mstr_* functions do not wait for a
+//          scheduled transaction to finish.
+//
+//-----------------------------------------------------------------------------
+// DISCLAIMER
+//    This code was developed for educational purposes as part of the CSC202
+//    course at Monroe Community Collage and is provided "as is" without
+//    warranties of any kind, whether express, implied, or statutory.
+//
+//    The author and organization do not warrant the accuracy, completeness, or
+//    reliability of the code. The author and organization shall not be liable
+//    for any direct, indirect, incidental, special, exemplary, or consequential
+//    damages arising out of the use of or inability to use the code, even if
+//    advised of the possibility of such damages.
+//
+//    Use of this code is at your own risk, and it is recommended to validate
+//    and adapt the code for your specific application and hardware
+//    requirements.
+//
+// Copyright (c) 2026 by Bruce Link
+//    You may use, edit, run or distribute this file as long as the above
+//    copyright notice remains
+// *****************************************************************************
+//******************************************************************************
+
+#ifndef __I2C_SCHED_H__
+#define __I2C_SCHED_H__
+
+//-----------------------------------------------------------------------------
+// Load standard C include files
+//-----------------------------------------------------------------------------
+#include <stdint.h>
+#include <stdbool.h>
+
+//-----------------------------------------------------------------------------
+// Define symbolic constants used by the module
+//-----------------------------------------------------------------------------
+#define I2C_SCHED_MAX_CLIENTS                                                (4)
+#define I2C_SCHED_INVALID_CLIENT                                          (0xFF)
+
+// Bytes a client may send per round for each unit of bandwidth share
+#define I2C_SCHED_QUANTUM_BYTES                                              (8)
+
+// Direction of a scheduled transaction
+#define I2C_SCHED_WRITE                                                      (0)
+#define I2C_SCHED_READ                                                       (1)
+
+// State of a scheduled transaction
+#define I2C_SCHED_XFER_DONE                                                  (0)
+#define I2C_SCHED_XFER_QUEUED                                                (1)
+#define I2C_SCHED_XFER_ACTIVE                                                (2)
+
+// Define a structure to hold one scheduled I2C transaction
+typedef struct i2c_sched_xfer
+{
+  uint8_t                slave;
+  uint8_t                direction;
+  uint8_t               *data;
+  uint16_t               length;
+  volatile uint8_t       state;
+  volatile uint32_t      status;
+  uint32_t               queued_cycles;
+  void                 (*callback)(struct i2c_sched_xfer *xfer);
+  struct i2c_sched_xfer *next;
+} i2c_sched_xfer_t;
+
+// Define a structure to hold the wait time statistics of a client
+typedef struct
+{
+  uint32_t xfer_count;
+  uint32_t byte_count;
+  uint32_t error_count;
+  uint32_t total_wait_us;
+  uint32_t max_wait_us;
+} i2c_sched_stats_t;
+
+
+// ----------------------------------------------------------------------------
+// Prototype for support functions
+// ----------------------------------------------------------------------------
+void I2C_sched_init(void);
+uint8_t I2C_sched_register(uint8_t priority, uint8_t share);
+uint32_t I2C_sched_write(uint8_t client, i2c_sched_xfer_t *xfer,
+         uint8_t slave, uint8_t data[], uint16_t length);
+uint32_t I2C_sched_read(uint8_t client, i2c_sched_xfer_t *xfer,
+         uint8_t slave, uint8_t data[], uint16_t length);
+bool I2C_sched_xfer_done(const i2c_sched_xfer_t *xfer);
+uint32_t I2C_sched_wait(const i2c_sched_xfer_t *xfer);
+void I2C_sched_tick(void);
+bool I2C_sched_get_stats(uint8_t client, i2c_sched_stats_t *stats);
+void I2C_sched_clear_stats(uint8_t client);
+
+#endif /* __I2C_SCHED_H__ */
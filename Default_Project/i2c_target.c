@@ -0,0 +1,685 @@
+// *****************************************************************************
+// ***************************    C Source Code     ****************************
+// *****************************************************************************
+//   DESIGNER NAME:  Bruce Link
+//
+//         VERSION:  1.0
+//
+//       FILE NAME:  i2c_target.c
+//
+//-----------------------------------------------------------------------------
+// DESCRIPTION
+//    This module implements an interrupt driven I2C target (slave) on I2C0
+//    with a double-buffered register map. The target interrupts used are:
+//      - START        latch the front buffer and preload the TX FIFO
+//      - TX FIFO trig keep the TX FIFO topped up during a controller read
+//      - RX FIFO trig store the register pointer and written bytes
+//      - STOP         report written bytes and apply a pending publish
+//
+//    The TX FIFO is kept filled ahead of the controller so the target only
+//    stretches the clock if this interrupt is held off for several bytes, or
+//    briefly after a repeated START that follows a register pointer write.
+//
+//-----------------------------------------------------------------------------
+// DISCLAIMER
+//    This code was developed for educational purposes as part of the CSC202
+//    course at Monroe Community Collage and is provided "as is" without
+//    warranties of any kind, whether express, implied, or statutory.
+//
+//    The author and organization do not warrant the accuracy, completeness, or
+//    reliability of the code. The author and organization shall not be liable
+//    for any direct, indirect, incidental, special, exemplary, or consequential
+//    damages arising out of the use of or inability to use the code, even if
+//    advised of the possibility of such damages.
+//
+//    Use of this code is at your own risk, and it is recommended to validate
+//    and adapt the code for your specific application and hardware
+//    requirements.
+//
+// Copyright (c) 2026 by Bruce Link
+//    You may use, edit, run or distribute this file as long as the above
+//    copyright notice remains
+// *****************************************************************************
+//******************************************************************************
+
+//-----------------------------------------------------------------------------
+// Load standard C include files
+//-----------------------------------------------------------------------------
+#include <string.h>
+
+//-----------------------------------------------------------------------------
+// Loads MSP launchpad board support macros and definitions
+//-----------------------------------------------------------------------------
+#include <ti/devices/msp/msp.h>
+#include "LaunchPad.h"
+#include "clock.h"
+#include "i2c_target.h"
+
+
+//-----------------------------------------------------------------------------
+// Define symbolic constants used by the module
+//-----------------------------------------------------------------------------
+#define I2C_TGT_NUM_BANKS                                                    (2)
+
+// The loopback test waits up to this long for the target to see a STOP
+// or to apply a publish
+#define I2C_TGT_LOOPBACK_WAIT_MSEC                                          (10)
+
+// Step between the bytes of the loopback test pattern
+#define I2C_TGT_LOOPBACK_STEP                                               (37)
+
+// I2C target interrupts used by the module
+#define I2C_TGT_CPU_INT_MASK      (I2C_CPU_INT_IMASK_SSTART_SET |             \
+                                   I2C_CPU_INT_IMASK_SSTOP_SET |              \
+                                   I2C_CPU_INT_IMASK_STXFIFOTRG_SET |         \
+                                   I2C_CPU_INT_IMASK_SRXFIFOTRG_SET)
+
+
+//-----------------------------------------------------------------------------
+// Define global variables and structures here.
+// NOTE: when possible avoid using global variables
+//-----------------------------------------------------------------------------
+static uint8_t  g_i2c_tgt_tx_regs[I2C_TGT_NUM_BANKS][I2C_TGT_REG_MAP_SIZE];
+static uint8_t  g_i2c_tgt_rx_regs[I2C_TGT_REG_MAP_SIZE];
+
+static volatile uint8_t   g_i2c_tgt_front       = 0;
+static volatile bool      g_i2c_tgt_pending     = false;
+static volatile bool      g_i2c_tgt_in_xfer     = false;
+static volatile uint32_t  g_i2c_tgt_xfer_count  = 0;
+static uint8_t            g_i2c_tgt_pointer     = 0;
+static uint8_t            g_i2c_tgt_tx_bank     = 0;
+static uint8_t            g_i2c_tgt_tx_index    = 0;
+static uint8_t            g_i2c_tgt_rx_count    = 0;
+static i2c_tgt_callback_t g_i2c_tgt_callback    = NULL;
+
+
+//-----------------------------------------------------------------------------
+// Define function prototypes used by the module
+//-----------------------------------------------------------------------------
+static void I2C_tgt_swap_banks(void);
+static void I2C_tgt_fill_tx_fifo(void);
+static void I2C_tgt_drain_rx_fifo(void);
+static void I2C_tgt_end_write(void);
+static bool I2C_tgt_wait_stop(uint32_t xfer_count);
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function configures I2C0 as an I2C target with the given 7-bit
+//    address. Both register map buffers are cleared, the TX/RX FIFO
+//    triggers are set and the target interrupts are enabled in the NVIC.
+//
+// INPUT PARAMETERS:
+//    own_addr - 7-bit I2C address the target responds to
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    none
+// -----------------------------------------------------------------------------
+void I2C_tgt_init(uint8_t own_addr)
+{
+  // Resets I2C peripheral
+  I2C_TGT_INST->GPRCM.RSTCTL = (I2C_RSTCTL_KEY_UNLOCK_W |
+                  I2C_RSTCTL_RESETSTKYCLR_CLR | I2C_RSTCTL_RESETASSERT_ASSERT);
+
+  // Enable power to I2C peripheral
+  I2C_TGT_INST->GPRCM.PWREN = (I2C_PWREN_KEY_UNLOCK_W |
+                               I2C_PWREN_ENABLE_ENABLE);
+
+  // Configure GPIO Ports as alternate IC2 function
+  IOMUX->SECCFG.PINCM[I2C_TGT_SDA_IOMUX] = (IOMUX_PINCM_HIZ1_ENABLE |
+         IOMUX_PINCM_INENA_ENABLE | IOMUX_PINCM_PC_CONNECTED |
+         I2C_TGT_SDA_PINCM_IOMUX_FUNC);
+  IOMUX->SECCFG.PINCM[I2C_TGT_SCL_IOMUX] = (IOMUX_PINCM_HIZ1_ENABLE |
+         IOMUX_PINCM_INENA_ENABLE | IOMUX_PINCM_PC_CONNECTED |
+         I2C_TGT_SCL_PINCM_IOMUX_FUNC);
+
+  // time for I2C to power up
+  clock_delay(PERIPHERAL_PWR_UP_DELAY);
+
+  // Selects BUSCLK as the clock source for IIC
+  I2C_TGT_INST->CLKSEL = I2C_CLKSEL_BUSCLK_SEL_ENABLE;
+  I2C_TGT_INST->CLKDIV = I2C_CLKDIV_RATIO_DIV_BY_1;
+
+  memset(g_i2c_tgt_tx_regs, 0, sizeof(g_i2c_tgt_tx_regs));
+  memset(g_i2c_tgt_rx_regs, 0, sizeof(g_i2c_tgt_rx_regs));
+  g_i2c_tgt_front      = 0;
+  g_i2c_tgt_pending    = false;
+  g_i2c_tgt_in_xfer    = false;
+  g_i2c_tgt_pointer    = 0;
+  g_i2c_tgt_rx_count   = 0;
+  g_i2c_tgt_xfer_count = 0;
+
+  // Set own address and FIFO triggers (refill TX when 4 or fewer bytes)
+  I2C_TGT_INST->SLAVE.SOAR = (((uint32_t)own_addr << I2C_SOAR_OAR_OFS) |
+                              I2C_SOAR_OAREN_ENABLE);
+  I2C_TGT_INST->SLAVE.SFIFOCTL = (I2C_SFIFOCTL_TXTRIG_LEVEL_4 |
+                                  I2C_SFIFOCTL_RXTRIG_LEVEL_1);
+
+  I2C_TGT_INST->CPU_INT.ICLR = I2C_TGT_CPU_INT_MASK;
+  I2C_TGT_INST->CPU_INT.IMASK = I2C_TGT_CPU_INT_MASK;
+
+  // Configuration done, enable the target
+  I2C_TGT_INST->SLAVE.SCTR = (I2C_SCTR_SCLKSTRETCH_ENABLE |
+                              I2C_SCTR_ACTIVE_ENABLE);
+
+  NVIC_ClearPendingIRQ(I2C_TGT_INST_INT_IRQN);
+  NVIC_EnableIRQ(I2C_TGT_INST_INT_IRQN);
+
+} /* I2C_tgt_init */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function registers a function that is called, from interrupt
+//    context, at the end of a controller write that stored at least one
+//    byte in the receive registers. Passing NULL removes the callback.
+//
+// INPUT PARAMETERS:
+//    callback - pointer to the function to call
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    none
+// -----------------------------------------------------------------------------
+void I2C_tgt_set_callback(i2c_tgt_callback_t callback)
+{
+  g_i2c_tgt_callback = callback;
+} /* I2C_tgt_set_callback */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function copies bytes into the back buffer of the transmit
+//    registers. The controller does not see them until I2C_tgt_publish()
+//    is called. Writes that run past the end of the map wrap to offset 0.
+//
+// INPUT PARAMETERS:
+//    offset - first register to write
+//
+//    data   - Pointer to the bytes to copy
+//
+//    length - The number of bytes to copy (up to I2C_TGT_REG_MAP_SIZE)
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    I2C_SUCCESS         - if the bytes were copied.
+//    I2C_ERR_BUSY        - if the previous publish has not been applied yet.
+//    I2C_FIFO_LOAD_ERROR - if the length is larger than the register map.
+// -----------------------------------------------------------------------------
+uint32_t I2C_tgt_write_regs(uint8_t offset, const uint8_t data[],
+         uint8_t length)
+{
+  uint8_t *back;
+
+  if (length > I2C_TGT_REG_MAP_SIZE)
+  {
+    return I2C_FIFO_LOAD_ERROR;
+  } /* if */
+
+  // The back buffer is still visible to the controller until the swap
+  if (g_i2c_tgt_pending)
+  {
+    return I2C_ERR_BUSY;
+  } /* if */
+
+  back = g_i2c_tgt_tx_regs[g_i2c_tgt_front ^ 1];
+  for (uint8_t idx = 0; idx < length; idx++)
+  {
+    back[(offset + idx) & I2C_TGT_REG_MAP_MASK] = data[idx];
+  } /* for */
+
+  return I2C_SUCCESS;
+
+} /* I2C_tgt_write_regs */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function makes the back buffer of the transmit registers visible
+//    to the controller. If a transaction is in progress the swap is made at
+//    its STOP, so a read never mixes old and new data. Use
+//    I2C_tgt_publish_pending() to find out when the swap has been made.
+//
+// INPUT PARAMETERS:
+//    none
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    none
+// -----------------------------------------------------------------------------
+void I2C_tgt_publish(void)
+{
+  uint32_t primask;
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+
+  if (g_i2c_tgt_in_xfer)
+  {
+    g_i2c_tgt_pending = true;
+  }
+  else
+  {
+    I2C_tgt_swap_banks();
+  } /* if */
+
+  __set_PRIMASK(primask);
+
+} /* I2C_tgt_publish */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function returns true while a publish is waiting for the current
+//    transaction to end. The back buffer can not be written until then.
+//
+// INPUT PARAMETERS:
+//    none
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    true if a publish is pending, false otherwise
+// -----------------------------------------------------------------------------
+bool I2C_tgt_publish_pending(void)
+{
+  return (g_i2c_tgt_pending);
+} /* I2C_tgt_publish_pending */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function copies bytes out of the receive registers that were
+//    written by the controller.
+//
+// INPUT PARAMETERS:
+//    offset - first register to read
+//
+//    length - The number of bytes to copy (up to I2C_TGT_REG_MAP_SIZE)
+//
+// OUTPUT PARAMETERS:
+//    data   - buffer that receives the bytes
+//
+// RETURN:
+//    none
+// -----------------------------------------------------------------------------
+void I2C_tgt_read_regs(uint8_t offset, uint8_t data[], uint8_t length)
+{
+  uint32_t primask;
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+
+  for (uint8_t idx = 0; idx < length; idx++)
+  {
+    data[idx] = g_i2c_tgt_rx_regs[(offset + idx) & I2C_TGT_REG_MAP_MASK];
+  } /* for */
+
+  __set_PRIMASK(primask);
+
+} /* I2C_tgt_read_regs */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function returns the number of transactions (START to STOP)
+//    addressed to this target.
+//
+// INPUT PARAMETERS:
+//    none
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    number of transactions
+// -----------------------------------------------------------------------------
+uint32_t I2C_tgt_get_xfer_count(void)
+{
+  return (g_i2c_tgt_xfer_count);
+} /* I2C_tgt_get_xfer_count */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function checks the target against the I2C controller of the same
+//    board (I2C1 on PB3/PB2 wired to I2C0 on PA0/PA1). It must be called
+//    after I2C_mstr_init() and I2C_tgt_init(own_addr). Two transactions
+//    are checked:
+//      - A controller read. A pattern is published in the transmit
+//        registers, the register pointer is set to 0 and the whole map is
+//        read back with I2C_mstr_read().
+//      - A controller write. The inverted pattern is written to the whole
+//        map with I2C_mstr_send_stream() and, once the target has seen the
+//        STOP, compared with the receive registers.
+//    The pattern starts at a different value every call, so data left by
+//    an earlier run is not mistaken for a pass.
+//
+//    NOTE: The transmit and receive registers are overwritten.
+//
+// INPUT PARAMETERS:
+//    own_addr - 7-bit I2C address given to I2C_tgt_init()
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    I2C_SUCCESS       - if both transactions returned the bytes sent.
+//    I2C_TGT_ERR_DATA  - if a byte received does not match the byte sent.
+//    I2C_ERR_TIMEOUT   - if the target did not finish a transaction in time.
+//    I2C_ERR_BUSY      - if an earlier publish has not been applied yet.
+//    other I2C codes   - the status of the failed I2C_mstr_* call.
+// -----------------------------------------------------------------------------
+uint32_t I2C_tgt_loopback_test(uint8_t own_addr)
+{
+  uint8_t  sent[I2C_TGT_REG_MAP_SIZE + 1];
+  uint8_t  received[I2C_TGT_REG_MAP_SIZE];
+  uint8_t  seed = (uint8_t)g_i2c_tgt_xfer_count;
+  uint32_t status;
+  uint32_t xfer_count;
+
+  for (uint8_t idx = 0; idx < I2C_TGT_REG_MAP_SIZE; idx++)
+  {
+    sent[idx] = (uint8_t)(seed + (idx * I2C_TGT_LOOPBACK_STEP));
+  } /* for */
+
+  // Controller read: publish the pattern then read the whole map from 0
+  if (I2C_tgt_write_regs(0, sent, I2C_TGT_REG_MAP_SIZE) != I2C_SUCCESS)
+  {
+    return I2C_ERR_BUSY;
+  } /* if */
+  I2C_tgt_publish();
+
+  xfer_count = g_i2c_tgt_xfer_count;
+  status = I2C_mstr_send1(own_addr, 0);
+  if (status != I2C_SUCCESS)
+  {
+    return status;
+  } /* if */
+
+  if (!I2C_tgt_wait_stop(xfer_count))
+  {
+    return I2C_ERR_TIMEOUT;
+  } /* if */
+
+  status = I2C_mstr_read(own_addr, received, I2C_TGT_REG_MAP_SIZE);
+  if (status != I2C_SUCCESS)
+  {
+    return status;
+  } /* if */
+
+  if (memcmp(received, sent, I2C_TGT_REG_MAP_SIZE) != 0)
+  {
+    return I2C_TGT_ERR_DATA;
+  } /* if */
+
+  // Controller write: register pointer 0 followed by the inverted pattern
+  for (uint8_t idx = I2C_TGT_REG_MAP_SIZE; idx > 0; idx--)
+  {
+    sent[idx] = (uint8_t)~sent[idx - 1];
+  } /* for */
+  sent[0] = 0;
+
+  xfer_count = g_i2c_tgt_xfer_count;
+  status = I2C_mstr_send_stream(own_addr, sent, I2C_TGT_REG_MAP_SIZE + 1);
+  if (status != I2C_SUCCESS)
+  {
+    return status;
+  } /* if */
+
+  if (!I2C_tgt_wait_stop(xfer_count))
+  {
+    return I2C_ERR_TIMEOUT;
+  } /* if */
+
+  I2C_tgt_read_regs(0, received, I2C_TGT_REG_MAP_SIZE);
+  if (memcmp(received, &sent[1], I2C_TGT_REG_MAP_SIZE) != 0)
+  {
+    return I2C_TGT_ERR_DATA;
+  } /* if */
+
+  return I2C_SUCCESS;
+
+} /* I2C_tgt_loopback_test */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function waits, for up to I2C_TGT_LOOPBACK_WAIT_MSEC, until the
+//    target has seen the STOP of a transaction started after xfer_count was
+//    read. The controller is done before the target interrupt has run.
+//
+// INPUT PARAMETERS:
+//    xfer_count - transaction count read before the transaction was started
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    true if the target saw the STOP, false if the wait timed out
+// -----------------------------------------------------------------------------
+static bool I2C_tgt_wait_stop(uint32_t xfer_count)
+{
+  for (uint16_t wait = 0; wait < I2C_TGT_LOOPBACK_WAIT_MSEC; wait++)
+  {
+    if (g_i2c_tgt_xfer_count != xfer_count)
+    {
+      return true;
+    } /* if */
+    msec_delay(1);
+  } /* for */
+
+  return (g_i2c_tgt_xfer_count != xfer_count);
+
+} /* I2C_tgt_wait_stop */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function makes the back buffer the front buffer and copies the
+//    new front buffer into the new back buffer, so the application can
+//    update only the registers that changed. It must be called with the
+//    target interrupt disabled or from the interrupt handler.
+//
+// INPUT PARAMETERS:
+//    none
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    none
+// -----------------------------------------------------------------------------
+static void I2C_tgt_swap_banks(void)
+{
+  uint8_t front = g_i2c_tgt_front ^ 1;
+
+  g_i2c_tgt_front = front;
+  memcpy(g_i2c_tgt_tx_regs[front ^ 1], g_i2c_tgt_tx_regs[front],
+         I2C_TGT_REG_MAP_SIZE);
+  g_i2c_tgt_pending = false;
+
+} /* I2C_tgt_swap_banks */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function loads the TX FIFO with transmit registers from the bank
+//    latched at the START until the FIFO is full.
+//
+// INPUT PARAMETERS:
+//    none
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    none
+// -----------------------------------------------------------------------------
+static void I2C_tgt_fill_tx_fifo(void)
+{
+  const uint8_t *bank = g_i2c_tgt_tx_regs[g_i2c_tgt_tx_bank];
+  uint8_t index;
+
+  while ((I2C_TGT_INST->SLAVE.SFIFOSR & I2C_SFIFOSR_TXFIFOCNT_MASK) != 0)
+  {
+    index = (g_i2c_tgt_pointer + g_i2c_tgt_tx_index) & I2C_TGT_REG_MAP_MASK;
+    I2C_TGT_INST->SLAVE.STXDATA = bank[index];
+    g_i2c_tgt_tx_index++;
+  } /* while */
+
+} /* I2C_tgt_fill_tx_fifo */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function empties the RX FIFO. The first byte of a controller
+//    write is the register pointer, the bytes that follow are stored in the
+//    receive registers.
+//
+// INPUT PARAMETERS:
+//    none
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    none
+// -----------------------------------------------------------------------------
+static void I2C_tgt_drain_rx_fifo(void)
+{
+  uint8_t data;
+
+  while ((I2C_TGT_INST->SLAVE.SFIFOSR & I2C_SFIFOSR_RXFIFOCNT_MASK) != 0)
+  {
+    data = (uint8_t)I2C_TGT_INST->SLAVE.SRXDATA;
+
+    if (g_i2c_tgt_rx_count == 0)
+    {
+      g_i2c_tgt_pointer = data & I2C_TGT_REG_MAP_MASK;
+    }
+    else
+    {
+      g_i2c_tgt_rx_regs[(g_i2c_tgt_pointer + g_i2c_tgt_rx_count - 1) &
+                        I2C_TGT_REG_MAP_MASK] = data;
+    } /* if */
+
+    if (g_i2c_tgt_rx_count < 0xFF)
+    {
+      g_i2c_tgt_rx_count++;
+    } /* if */
+  } /* while */
+
+} /* I2C_tgt_drain_rx_fifo */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function ends the write part of a transaction. If registers were
+//    written the application callback is told which ones.
+//
+// INPUT PARAMETERS:
+//    none
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    none
+// -----------------------------------------------------------------------------
+static void I2C_tgt_end_write(void)
+{
+  uint8_t length;
+
+  I2C_tgt_drain_rx_fifo();
+
+  if ((g_i2c_tgt_rx_count > 1) && (g_i2c_tgt_callback != NULL))
+  {
+    length = g_i2c_tgt_rx_count - 1;
+    if (length > I2C_TGT_REG_MAP_SIZE)
+    {
+      length = I2C_TGT_REG_MAP_SIZE;
+    } /* if */
+
+    g_i2c_tgt_callback(g_i2c_tgt_pointer, length);
+  } /* if */
+
+  g_i2c_tgt_rx_count = 0;
+
+} /* I2C_tgt_end_write */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    I2C target interrupt service routine. On a START (or repeated START)
+//    any pointer write is finished first, then the front buffer is latched
+//    and the TX FIFO is preloaded from the register pointer so a read can
+//    start without waiting for the CPU.
+//
+// INPUT PARAMETERS:
+//    none
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    none
+// -----------------------------------------------------------------------------
+void I2C_TGT_INST_IRQHandler(void)
+{
+  uint32_t int_idx;
+
+  while ((int_idx = I2C_TGT_INST->CPU_INT.IIDX) !=
+          I2C_CPU_INT_IIDX_STAT_NO_INTR)
+  {
+    switch (int_idx)
+    {
+      case I2C_CPU_INT_IIDX_STAT_SSTARTFG:
+        I2C_tgt_end_write();
+        g_i2c_tgt_in_xfer  = true;
+        g_i2c_tgt_tx_bank  = g_i2c_tgt_front;
+        g_i2c_tgt_tx_index = 0;
+
+        I2C_TGT_INST->SLAVE.SFIFOCTL |= I2C_SFIFOCTL_TXFLUSH_FLUSH;
+        while ((I2C_TGT_INST->SLAVE.SFIFOSR & I2C_SFIFOSR_TXFIFOCNT_MASK) !=
+                I2C_SFIFOSR_TXFIFOCNT_MAXIMUM);
+        I2C_TGT_INST->SLAVE.SFIFOCTL &= ~I2C_SFIFOCTL_TXFLUSH_MASK;
+
+        I2C_tgt_fill_tx_fifo();
+        break;
+
+      case I2C_CPU_INT_IIDX_STAT_STXFIFOTRG:
+        I2C_tgt_fill_tx_fifo();
+        break;
+
+      case I2C_CPU_INT_IIDX_STAT_SRXFIFOTRG:
+        I2C_tgt_drain_rx_fifo();
+        break;
+
+      case I2C_CPU_INT_IIDX_STAT_SSTOPFG:
+        I2C_tgt_end_write();
+        g_i2c_tgt_in_xfer = false;
+        g_i2c_tgt_xfer_count++;
+
+        if (g_i2c_tgt_pending)
+        {
+          I2C_tgt_swap_banks();
+        } /* if */
+        break;
+
+      default:
+        break;
+    } /* switch */
+  } /* while */
+
+} /* I2C_TGT_INST_IRQHandler */
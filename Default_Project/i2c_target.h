@@ -0,0 +1,108 @@
+// *****************************************************************************
+// ***************************    C Source Code     ****************************
+// *****************************************************************************
+//   DESIGNER NAME:  Bruce Link
+//
+//         VERSION:  1.0
+//
+//       FILE NAME:  i2c_target.h
+//
+//-----------------------------------------------------------------------------
+// DESCRIPTION
+//    This module turns the second I2C peripheral (I2C0) into an interrupt
+//    driven I2C target (slave) so several LaunchPads can be chained on one
+//    bus and a controller board can poll data from the others.
+//
+//    The target exposes a register map of I2C_TGT_REG_MAP_SIZE bytes:
+//      - A controller write starts with a one byte register pointer. Any
+//        bytes that follow are stored in the receive registers starting at
+//        the pointer and the application is told at the STOP.
+//      - A controller read returns the transmit registers starting at the
+//        last register pointer written. The pointer wraps at the end of the
+//        map.
+//
+//    The transmit registers are double-buffered. The application updates
+//    the back buffer with I2C_tgt_write_regs() and makes all of its changes
+//    visible at once with I2C_tgt_publish(). A controller read always
+//    returns one consistent snapshot because the buffer is only swapped
+//    when no read is in progress.
+//
+//    NOTE: I2C0 uses PA0 (SDA) and PA1 (SCL) which are the open-drain pins
+//          on the LaunchPad header. Remove the jumper for the red LaunchPad
+//          LED (LED1 on PA0) and fit pull-up resistors on the bus.
+//
+//    I2C_tgt_loopback_test() checks the target on one board. Wire PA0/PA1
+//    to PB3/PB2 (I2C1, the controller) and run:
+//
+//      I2C_mstr_init();
+//      I2C_tgt_init(0x42);
+//      status = I2C_tgt_loopback_test(0x42);   // I2C_SUCCESS if it works
+//
+//-----------------------------------------------------------------------------
+// DISCLAIMER
+//    This code was developed for educational purposes as part of the CSC202
+//    course at Monroe Community Collage and is provided "as is" without
+//    warranties of any kind, whether express, implied, or statutory.
+//
+//    The author and organization do not warrant the accuracy, completeness, or
+//    reliability of the code. The author and organization shall not be liable
+//    for any direct, indirect, incidental, special, exemplary, or consequential
+//    damages arising out of the use of or inability to use the code, even if
+//    advised of the possibility of such damages.
+//
+//    Use of this code is at your own risk, and it is recommended to validate
+//    and adapt the code for your specific application and hardware
+//    requirements.
+//
+// Copyright (c) 2026 by Bruce Link
+//    You may use, edit, run or distribute this file as long as the above
+//    copyright notice remains
+// *****************************************************************************
+//******************************************************************************
+
+#ifndef __I2C_TARGET_H__
+#define __I2C_TARGET_H__
+
+//-----------------------------------------------------------------------------
+// Load standard C include files
+//-----------------------------------------------------------------------------
+#include <stdint.h>
+#include <stdbool.h>
+
+//-----------------------------------------------------------------------------
+// Define symbolic constants used by the module
+//-----------------------------------------------------------------------------
+#define I2C_TGT_INST                                                        I2C0
+#define I2C_TGT_INST_IRQHandler                                  I2C0_IRQHandler
+#define I2C_TGT_INST_INT_IRQN                                      I2C0_INT_IRQn
+#define I2C_TGT_SDA_IOMUX                                         (IOMUX_PINCM1)
+#define I2C_TGT_SDA_PINCM_IOMUX_FUNC                  (IOMUX_PINCM1_PF_I2C0_SDA)
+#define I2C_TGT_SCL_IOMUX                                         (IOMUX_PINCM2)
+#define I2C_TGT_SCL_PINCM_IOMUX_FUNC                  (IOMUX_PINCM2_PF_I2C0_SCL)
+
+// Size of the transmit and receive register maps (must be a power of 2)
+#define I2C_TGT_REG_MAP_SIZE                                                (32)
+#define I2C_TGT_REG_MAP_MASK                          (I2C_TGT_REG_MAP_SIZE - 1)
+
+// Loopback test result when a byte read back differs (follows the I2C_*
+// status codes in LaunchPad.h)
+#define I2C_TGT_ERR_DATA                                                     (6)
+
+// Function prototype for the controller write callback
+typedef void (*i2c_tgt_callback_t)(uint8_t offset, uint8_t length);
+
+
+// ----------------------------------------------------------------------------
+// Prototype for support functions
+// ----------------------------------------------------------------------------
+void I2C_tgt_init(uint8_t own_addr);
+void I2C_tgt_set_callback(i2c_tgt_callback_t callback);
+uint32_t I2C_tgt_write_regs(uint8_t offset, const uint8_t data[],
+         uint8_t length);
+void I2C_tgt_publish(void);
+bool I2C_tgt_publish_pending(void);
+void I2C_tgt_read_regs(uint8_t offset, uint8_t data[], uint8_t length);
+uint32_t I2C_tgt_get_xfer_count(void);
+uint32_t I2C_tgt_loopback_test(uint8_t own_addr);
+
+#endif /* __I2C_TARGET_H__ */
@@ -0,0 +1,464 @@
+// *****************************************************************************
+// ***************************    C Source Code     ****************************
+// *****************************************************************************
+//   DESIGNER NAME:  Bruce Link
+//
+//         VERSION:  1.0
+//
+//       FILE NAME:  input_service.c
+//
+//-----------------------------------------------------------------------------
+// DESCRIPTION
+//    This file contains the switch and pushbutton input service. See
+//    input_service.h for the events it makes.
+//
+//-----------------------------------------------------------------------------
+// DISCLAIMER
+//    This code was developed for educational purposes as part of the CSC202
+//    course at Monroe Community Collage and is provided "as is" without
+//    warranties of any kind, whether express, implied, or statutory.
+//
+//    The author and organization do not warrant the accuracy, completeness, or
+//    reliability of the code. The author and organization shall not be liable
+//    for any direct, indirect, incidental, special, exemplary, or consequential
+//    damages arising out of the use of or inability to use the code, even if
+//    advised of the possibility of such damages.
+//
+//    Use of this code is at your own risk, and it is recommended to validate
+//    and adapt the code for your specific application and hardware
+//    requirements.
+//
+// Copyright (c) 2026 by Bruce Link
+//    You may use, edit, run or distribute this file as long as the above
+//    copyright notice remains
+// *****************************************************************************
+//******************************************************************************
+
+//-----------------------------------------------------------------------------
+// Load standard C include files
+//-----------------------------------------------------------------------------
+#include <stdint.h>
+#include <stdbool.h>
+
+//-----------------------------------------------------------------------------
+// Loads MSP launchpad board support macros and definitions
+//-----------------------------------------------------------------------------
+#include <ti/devices/msp/msp.h>
+#include "LaunchPad.h"
+#include "clock.h"
+#include "input_service.h"
+
+
+//-----------------------------------------------------------------------------
+// Define symbolic constants used by the module
+//-----------------------------------------------------------------------------
+#define INPUT_SERVICE_FIFO_MASK                    (INPUT_SERVICE_FIFO_SIZE - 1)
+
+
+//-----------------------------------------------------------------------------
+// Define function prototypes used by the module
+//-----------------------------------------------------------------------------
+static uint8_t input_service_sample(void);
+static void input_service_events(uint8_t changed, uint32_t now);
+static void input_service_push(uint8_t input, uint8_t type, uint32_t now);
+
+
+//-----------------------------------------------------------------------------
+// Define global variables and structures here.
+// NOTE: when possible avoid using global variables
+//-----------------------------------------------------------------------------
+
+// Port and pin of each input, from LaunchPad.c. The IOMUX inverts all of
+// them, so a pin reads 1 when the switch is on or the button is down.
+static uint8_t  g_in_svc_port[INPUT_SERVICE_NUM_INPUTS];
+static uint32_t g_in_svc_mask[INPUT_SERVICE_NUM_INPUTS];
+
+// Debounced state and the two bits of the vertical counters, bit n for
+// input n
+static volatile uint8_t g_in_svc_state = 0;
+static uint8_t          g_in_svc_count0 = 0;
+static uint8_t          g_in_svc_count1 = 0;
+
+// Sample period and the time in ms
+static uint16_t g_in_svc_period_msec = INPUT_SERVICE_MIN_PERIOD_MSEC;
+static uint32_t g_in_svc_now = 0;
+
+// Press and release times of each input, the inputs whose long press has
+// been sent and the inputs released after a short press that can still
+// become a double click
+static uint32_t g_in_svc_press_msec[INPUT_SERVICE_NUM_INPUTS];
+static uint32_t g_in_svc_release_msec[INPUT_SERVICE_NUM_INPUTS];
+static uint8_t  g_in_svc_long_sent = 0;
+static uint8_t  g_in_svc_click = 0;
+
+// Event queue, written by the interrupt and read by the application
+static input_event_t     g_in_svc_fifo[INPUT_SERVICE_FIFO_SIZE];
+static volatile uint8_t  g_in_svc_head = 0;
+static volatile uint8_t  g_in_svc_tail = 0;
+static volatile uint32_t g_in_svc_dropped = 0;
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function starts the input service. The switch pins are set up
+//    with dipsw_init() and lpsw_init(), the current state of the inputs is
+//    taken as the debounced state (no events for switches that are already
+//    on) and TIMG8 is started to sample them.
+//
+// INPUT PARAMETERS:
+//    period_msec - time between samples in ms (INPUT_SERVICE_MIN_PERIOD_MSEC
+//                  to INPUT_SERVICE_MAX_PERIOD_MSEC), 5 is a good choice
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    none
+// -----------------------------------------------------------------------------
+void input_service_init(uint16_t period_msec)
+{
+  uint32_t timer_clock = get_bus_clock_freq() / 8 /
+                         INPUT_SERVICE_TIMER_PRESCALE;
+
+  if (period_msec < INPUT_SERVICE_MIN_PERIOD_MSEC)
+  {
+    period_msec = INPUT_SERVICE_MIN_PERIOD_MSEC;
+  }
+  else if (period_msec > INPUT_SERVICE_MAX_PERIOD_MSEC)
+  {
+    period_msec = INPUT_SERVICE_MAX_PERIOD_MSEC;
+  } /* if */
+
+  dipsw_init();
+  lpsw_init();
+
+  // The DIP switches and pushbuttons come first, in DIP_SWn_IDX order
+  for (uint8_t input = 0; input < MAX_NUM_DIPSW; input++)
+  {
+    g_in_svc_mask[input] = dipsw_port_mask(input, &g_in_svc_port[input]);
+  } /* for */
+  g_in_svc_mask[INPUT_LP_SW2] = lpsw_port_mask(LP_SW2_IDX,
+                                               &g_in_svc_port[INPUT_LP_SW2]);
+
+  g_in_svc_period_msec = period_msec;
+  g_in_svc_now         = 0;
+  g_in_svc_count0      = 0;
+  g_in_svc_count1      = 0;
+  g_in_svc_click       = 0;
+  g_in_svc_head        = 0;
+  g_in_svc_tail        = 0;
+  g_in_svc_dropped     = 0;
+  g_in_svc_state       = input_service_sample();
+
+  // Inputs already on count as pressed long ago
+  g_in_svc_long_sent = g_in_svc_state;
+
+  // Reset the timer
+  INPUT_SERVICE_TIMER_INST->GPRCM.RSTCTL = (GPTIMER_RSTCTL_KEY_UNLOCK_W |
+        GPTIMER_RSTCTL_RESETSTKYCLR_CLR | GPTIMER_RSTCTL_RESETASSERT_ASSERT);
+
+  // Enable power to the timer
+  INPUT_SERVICE_TIMER_INST->GPRCM.PWREN = (GPTIMER_PWREN_KEY_UNLOCK_W |
+        GPTIMER_PWREN_ENABLE_ENABLE);
+
+  clock_delay(PERIPHERAL_PWR_UP_DELAY);
+
+  // Timer clock = BUSCLK / 8 / INPUT_SERVICE_TIMER_PRESCALE
+  INPUT_SERVICE_TIMER_INST->CLKSEL = (GPTIMER_CLKSEL_BUSCLK_SEL_ENABLE |
+        GPTIMER_CLKSEL_MFCLK_SEL_DISABLE | GPTIMER_CLKSEL_LFCLK_SEL_DISABLE);
+  INPUT_SERVICE_TIMER_INST->CLKDIV = GPTIMER_CLKDIV_RATIO_DIV_BY_8;
+  INPUT_SERVICE_TIMER_INST->COMMONREGS.CPS = GPTIMER_CPS_PCNT_MASK &
+        (INPUT_SERVICE_TIMER_PRESCALE - 1);
+
+  // Count down from LOAD and reload, one zero event per sample
+  INPUT_SERVICE_TIMER_INST->COUNTERREGS.CTRCTL = (GPTIMER_CTRCTL_CVAE_LDVAL |
+        GPTIMER_CTRCTL_CM_DOWN | GPTIMER_CTRCTL_REPEAT_REPEAT_1);
+  INPUT_SERVICE_TIMER_INST->COUNTERREGS.LOAD = GPTIMER_LOAD_LD_MASK &
+        (((timer_clock * period_msec) / MSEC_PER_SECOND) - 1);
+
+  INPUT_SERVICE_TIMER_INST->CPU_INT.ICLR = GPTIMER_CPU_INT_ICLR_Z_CLR;
+  INPUT_SERVICE_TIMER_INST->CPU_INT.IMASK = GPTIMER_CPU_INT_IMASK_Z_SET;
+
+  NVIC_ClearPendingIRQ(INPUT_SERVICE_TIMER_INT_IRQN);
+  NVIC_EnableIRQ(INPUT_SERVICE_TIMER_INT_IRQN);
+
+  // Enable the clock and start counting
+  INPUT_SERVICE_TIMER_INST->COMMONREGS.CCLKCTL = GPTIMER_CCLKCTL_CLKEN_ENABLED;
+  INPUT_SERVICE_TIMER_INST->COUNTERREGS.CTRCTL |= GPTIMER_CTRCTL_EN_ENABLED;
+
+} /* input_service_init */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function stops sampling. Events already queued can still be
+//    read.
+//
+// INPUT PARAMETERS:
+//    none
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    none
+// -----------------------------------------------------------------------------
+void input_service_stop(void)
+{
+  NVIC_DisableIRQ(INPUT_SERVICE_TIMER_INT_IRQN);
+  INPUT_SERVICE_TIMER_INST->COUNTERREGS.CTRCTL &= ~GPTIMER_CTRCTL_EN_MASK;
+  INPUT_SERVICE_TIMER_INST->CPU_INT.IMASK = 0;
+
+} /* input_service_stop */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function takes the oldest event from the queue.
+//
+// INPUT PARAMETERS:
+//    none
+//
+// OUTPUT PARAMETERS:
+//    event - the event, when there is one
+//
+// RETURN:
+//    true if an event was taken, false if the queue is empty
+// -----------------------------------------------------------------------------
+bool input_service_get(input_event_t *event)
+{
+  uint8_t tail = g_in_svc_tail;
+
+  if (tail == g_in_svc_head)
+  {
+    return false;
+  } /* if */
+
+  *event = g_in_svc_fifo[tail];
+  g_in_svc_tail = (tail + 1) & INPUT_SERVICE_FIFO_MASK;
+
+  return true;
+
+} /* input_service_get */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function returns the debounced state of all the inputs.
+//
+// INPUT PARAMETERS:
+//    none
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    bit n is set while input n (INPUT_xxx) is on or down
+// -----------------------------------------------------------------------------
+uint8_t input_service_state(void)
+{
+  return (g_in_svc_state);
+} /* input_service_state */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function returns the number of events lost because the queue
+//    was full.
+//
+// INPUT PARAMETERS:
+//    none
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    number of events dropped since input_service_init()
+// -----------------------------------------------------------------------------
+uint32_t input_service_dropped(void)
+{
+  return (g_in_svc_dropped);
+} /* input_service_dropped */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function reads both ports once and packs the inputs into a byte.
+//
+// INPUT PARAMETERS:
+//    none
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    bit n is set when input n reads on or down
+// -----------------------------------------------------------------------------
+static uint8_t input_service_sample(void)
+{
+  uint32_t din[MAX_NUM_GPIO_PORTS];
+  uint8_t  sample = 0;
+
+  for (uint8_t port = 0; port < MAX_NUM_GPIO_PORTS; port++)
+  {
+    din[port] = gpio_port_regs(port)->DIN31_0;
+  } /* for */
+
+  for (uint8_t input = 0; input < INPUT_SERVICE_NUM_INPUTS; input++)
+  {
+    if ((din[g_in_svc_port[input]] & g_in_svc_mask[input]) != 0)
+    {
+      sample |= (1U << input);
+    } /* if */
+  } /* for */
+
+  return (sample);
+
+} /* input_service_sample */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function makes the events of one sample: the edges in changed
+//    and the long presses that are due.
+//
+// INPUT PARAMETERS:
+//    changed - inputs whose debounced state just changed
+//    now     - time of the sample in ms
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    none
+// -----------------------------------------------------------------------------
+static void input_service_events(uint8_t changed, uint32_t now)
+{
+  uint8_t state = g_in_svc_state;
+  uint8_t mask;
+
+  for (uint8_t input = 0; input < INPUT_SERVICE_NUM_INPUTS; input++)
+  {
+    mask = 1U << input;
+
+    if ((changed & mask) != 0)
+    {
+      if ((state & mask) != 0)
+      {
+        g_in_svc_press_msec[input] = now;
+        g_in_svc_long_sent &= ~mask;
+
+        if (((g_in_svc_click & mask) != 0) &&
+            ((now - g_in_svc_release_msec[input]) <=
+             INPUT_SERVICE_DOUBLE_CLICK_MSEC))
+        {
+          g_in_svc_click &= ~mask;
+          input_service_push(input, INPUT_EVENT_DOUBLE_CLICK, now);
+        }
+        else
+        {
+          input_service_push(input, INPUT_EVENT_PRESS, now);
+        } /* if */
+      }
+      else
+      {
+        // Only a short press can start a double click
+        if ((g_in_svc_long_sent & mask) == 0)
+        {
+          g_in_svc_click |= mask;
+          g_in_svc_release_msec[input] = now;
+        } /* if */
+
+        input_service_push(input, INPUT_EVENT_RELEASE, now);
+      } /* if */
+    }
+    else if (((state & ~g_in_svc_long_sent & mask) != 0) &&
+             ((now - g_in_svc_press_msec[input]) >=
+              INPUT_SERVICE_LONG_PRESS_MSEC))
+    {
+      g_in_svc_long_sent |= mask;
+      g_in_svc_click     &= ~mask;
+      input_service_push(input, INPUT_EVENT_LONG_PRESS, now);
+    } /* if */
+  } /* for */
+
+} /* input_service_events */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function adds an event to the queue. When the queue is full the
+//    event is dropped and counted.
+//
+// INPUT PARAMETERS:
+//    input - INPUT_xxx
+//    type  - INPUT_EVENT_x
+//    now   - time of the event in ms
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    none
+// -----------------------------------------------------------------------------
+static void input_service_push(uint8_t input, uint8_t type, uint32_t now)
+{
+  uint8_t head = g_in_svc_head;
+  uint8_t next = (head + 1) & INPUT_SERVICE_FIFO_MASK;
+
+  if (next == g_in_svc_tail)
+  {
+    g_in_svc_dropped++;
+    return;
+  } /* if */
+
+  g_in_svc_fifo[head].time_msec = now;
+  g_in_svc_fifo[head].input     = input;
+  g_in_svc_fifo[head].type      = type;
+  g_in_svc_head = next;
+
+} /* input_service_push */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    Sample interrupt service routine. The inputs that differ from the
+//    debounced state count up their vertical counter, the others are
+//    reset to 0. An input whose counter wraps back to 0 has differed for
+//    INPUT_SERVICE_DEBOUNCE_SAMPLES samples and changes state. The event
+//    code only runs when an input changed or one is held waiting for its
+//    long press.
+//
+// INPUT PARAMETERS:
+//    none
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    none
+// -----------------------------------------------------------------------------
+void INPUT_SERVICE_TIMER_IRQHandler(void)
+{
+  uint8_t delta;
+  uint8_t changed;
+
+  if (INPUT_SERVICE_TIMER_INST->CPU_INT.IIDX != GPTIMER_CPU_INT_IIDX_STAT_Z)
+  {
+    return;
+  } /* if */
+
+  g_in_svc_now += g_in_svc_period_msec;
+
+  delta = input_service_sample() ^ g_in_svc_state;
+  g_in_svc_count1 = (g_in_svc_count1 ^ g_in_svc_count0) & delta;
+  g_in_svc_count0 = ~g_in_svc_count0 & delta;
+  changed = delta & ~(g_in_svc_count0 | g_in_svc_count1);
+  g_in_svc_state ^= changed;
+
+  if ((changed | (g_in_svc_state & ~g_in_svc_long_sent)) != 0)
+  {
+    input_service_events(changed, g_in_svc_now);
+  } /* if */
+
+} /* INPUT_SERVICE_TIMER_IRQHandler */
@@ -0,0 +1,122 @@
+// *****************************************************************************
+// ***************************    C Source Code     ****************************
+// *****************************************************************************
+//   DESIGNER NAME:  Bruce Link
+//
+//         VERSION:  1.0
+//
+//       FILE NAME:  input_service.h
+//
+//-----------------------------------------------------------------------------
+// DESCRIPTION
+//    This module debounces the switches and pushbuttons in the background
+//    and turns them into a queue of events. A TIMG8 interrupt samples all
+//    the inputs every period. Each input has a 2-bit vertical counter, the
+//    bits of all the counters are held in two bytes and all the inputs are
+//    counted at once with a few bitwise operations. An input changes state
+//    after INPUT_SERVICE_DEBOUNCE_SAMPLES samples that differ from it in a
+//    row.
+//
+//    Every change is queued with the time it was accepted:
+//      - INPUT_EVENT_PRESS and INPUT_EVENT_RELEASE on each edge (a DIP
+//        switch turned on is a press)
+//      - INPUT_EVENT_LONG_PRESS once an input has been held for
+//        INPUT_SERVICE_LONG_PRESS_MSEC
+//      - INPUT_EVENT_DOUBLE_CLICK, instead of the second press, when an
+//        input is pressed again within INPUT_SERVICE_DOUBLE_CLICK_MSEC of
+//        a short press being released
+//
+//    Inputs are numbered by INPUT_xxx below, the bits of
+//    input_service_state() use the same numbers.
+//
+//    NOTE: LaunchPad SW1 (PA18) is also the LED bar enable, so it is not
+//          sampled.
+//
+//-----------------------------------------------------------------------------
+// DISCLAIMER
+//    This code was developed for educational purposes as part of the CSC202
+//    course at Monroe Community Collage and is provided "as is" without
+//    warranties of any kind, whether express, implied, or statutory.
+//
+//    The author and organization do not warrant the accuracy, completeness, or
+//    reliability of the code. The author and organization shall not be liable
+//    for any direct, indirect, incidental, special, exemplary, or consequential
+//    damages arising out of the use of or inability to use the code, even if
+//    advised of the possibility of such damages.
+//
+//    Use of this code is at your own risk, and it is recommended to validate
+//    and adapt the code for your specific application and hardware
+//    requirements.
+//
+// Copyright (c) 2026 by Bruce Link
+//    You may use, edit, run or distribute this file as long as the above
+//    copyright notice remains
+// *****************************************************************************
+//******************************************************************************
+
+#ifndef __INPUT_SERVICE_H__
+#define __INPUT_SERVICE_H__
+
+//-----------------------------------------------------------------------------
+// Load standard C include files
+//-----------------------------------------------------------------------------
+#include <stdint.h>
+#include <stdbool.h>
+
+//-----------------------------------------------------------------------------
+// Define symbolic constants used by the module
+//-----------------------------------------------------------------------------
+#define INPUT_SERVICE_TIMER_INST                                           TIMG8
+#define INPUT_SERVICE_TIMER_IRQHandler                          TIMG8_IRQHandler
+#define INPUT_SERVICE_TIMER_INT_IRQN                              TIMG8_INT_IRQn
+
+// Timer clock is BUSCLK / 8 / INPUT_SERVICE_TIMER_PRESCALE (50kHz at 40MHz)
+#define INPUT_SERVICE_TIMER_PRESCALE                                       (100)
+
+// Sample period limits in ms
+#define INPUT_SERVICE_MIN_PERIOD_MSEC                                        (1)
+#define INPUT_SERVICE_MAX_PERIOD_MSEC                                       (50)
+
+// Samples in a row needed to change state (set by the 2-bit counters)
+#define INPUT_SERVICE_DEBOUNCE_SAMPLES                                       (4)
+
+// Long press and double click times
+#define INPUT_SERVICE_LONG_PRESS_MSEC                                      (800)
+#define INPUT_SERVICE_DOUBLE_CLICK_MSEC                                    (300)
+
+// Number of events the queue holds (must be a power of 2)
+#define INPUT_SERVICE_FIFO_SIZE                                             (16)
+
+// Inputs sampled by the service
+#define INPUT_DIP_SW1                                                        (0)
+#define INPUT_DIP_SW2                                                        (1)
+#define INPUT_PB1                                                            (2)
+#define INPUT_PB2                                                            (3)
+#define INPUT_LP_SW2                                                         (4)
+#define INPUT_SERVICE_NUM_INPUTS                                             (5)
+
+// Event types
+#define INPUT_EVENT_PRESS                                                    (0)
+#define INPUT_EVENT_RELEASE                                                  (1)
+#define INPUT_EVENT_LONG_PRESS                                               (2)
+#define INPUT_EVENT_DOUBLE_CLICK                                             (3)
+
+// Define a structure to hold one input event
+typedef struct
+{
+  uint32_t time_msec;         // time since input_service_init, in ms
+  uint8_t  input;             // INPUT_xxx
+  uint8_t  type;              // INPUT_EVENT_x
+} input_event_t;
+
+
+// ----------------------------------------------------------------------------
+// Prototype for support functions
+// ----------------------------------------------------------------------------
+void input_service_init(uint16_t period_msec);
+void input_service_stop(void);
+bool input_service_get(input_event_t *event);
+uint8_t input_service_state(void);
+uint32_t input_service_dropped(void);
+
+#endif /* __INPUT_SERVICE_H__ */
@@ -0,0 +1,398 @@
+// *****************************************************************************
+// ***************************    C Source Code     ****************************
+// *****************************************************************************
+//   DESIGNER NAME:  Bruce Link
+//
+//         VERSION:  1.0
+//
+//       FILE NAME:  keypad_events.c
+//
+//-----------------------------------------------------------------------------
+// DESCRIPTION
+//    This file contains the keypad event queue. See keypad_events.h for
+//    how keys are debounced and queued.
+//
+//-----------------------------------------------------------------------------
+// DISCLAIMER
+//    This code was developed for educational purposes as part of the CSC202
+//    course at Monroe Community Collage and is provided "as is" without
+//    warranties of any kind, whether express, implied, or statutory.
+//
+//    The author and organization do not warrant the accuracy, completeness, or
+//    reliability of the code. The author and organization shall not be liable
+//    for any direct, indirect, incidental, special, exemplary, or consequential
+//    damages arising out of the use of or inability to use the code, even if
+//    advised of the possibility of such damages.
+//
+//    Use of this code is at your own risk, and it is recommended to validate
+//    and adapt the code for your specific application and hardware
+//    requirements.
+//
+// Copyright (c) 2026 by Bruce Link
+//    You may use, edit, run or distribute this file as long as the above
+//    copyright notice remains
+// *****************************************************************************
+//******************************************************************************
+
+//-----------------------------------------------------------------------------
+// Load standard C include files
+//-----------------------------------------------------------------------------
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+//-----------------------------------------------------------------------------
+// Loads MSP launchpad board support macros and definitions
+//-----------------------------------------------------------------------------
+#include "LaunchPad.h"
+#include "keypad_events.h"
+
+
+//-----------------------------------------------------------------------------
+// Define symbolic constants used by the module
+//-----------------------------------------------------------------------------
+#define KEYPAD_EVENTS_FIFO_MASK                    (KEYPAD_EVENTS_FIFO_SIZE - 1)
+
+// Matrix bit of the repeating key when no key repeats
+#define KEYPAD_EVENTS_NO_REPEAT                                           (0xFF)
+
+// Rows of one column in the matrix
+#define KEYPAD_EVENTS_COL_MASK                                             (0xF)
+
+
+//-----------------------------------------------------------------------------
+// Define function prototypes used by the module
+//-----------------------------------------------------------------------------
+static bool keypad_events_ghost(uint16_t matrix);
+static void keypad_events_push(uint8_t bit, uint8_t type, uint32_t now);
+
+
+//-----------------------------------------------------------------------------
+// Define global variables and structures here.
+// NOTE: when possible avoid using global variables
+//-----------------------------------------------------------------------------
+
+// Event queue, written by the tick and read by the application
+static keypad_event_t    g_kp_ev_fifo[KEYPAD_EVENTS_FIFO_SIZE];
+static volatile uint8_t  g_kp_ev_head = 0;
+static volatile uint8_t  g_kp_ev_tail = 0;
+static volatile uint32_t g_kp_ev_dropped = 0;
+
+// Tick length, ticks since init and the debounce length in ticks
+static uint16_t g_kp_ev_tick_msec = 1;
+static uint32_t g_kp_ev_ticks = 0;
+static uint8_t  g_kp_ev_debounce_ticks = 1;
+
+// Integrating counter of each matrix bit, the bits with a non-zero
+// counter, and the debounced state by matrix bit and by key index
+static uint8_t           g_kp_ev_count[MAX_NUM_KEYPAD_KEYS];
+static uint16_t          g_kp_ev_counting = 0;
+static uint16_t          g_kp_ev_state = 0;
+static volatile uint16_t g_kp_ev_keys = 0;
+
+// Matrix bit of the key that repeats and the time of its next repeat
+static uint8_t  g_kp_ev_repeat_bit = KEYPAD_EVENTS_NO_REPEAT;
+static uint32_t g_kp_ev_repeat_msec = 0;
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function sets up the keypad with keypad_init() and empties the
+//    event queue. keypad_events_tick() must then be called every tick_msec.
+//
+// INPUT PARAMETERS:
+//    tick_msec - time between calls of keypad_events_tick() in ms (at
+//                least 1)
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    none
+// -----------------------------------------------------------------------------
+void keypad_events_init(uint16_t tick_msec)
+{
+  uint16_t debounce_ticks;
+
+  keypad_init();
+
+  g_kp_ev_tick_msec = (tick_msec > 0) ? tick_msec : 1;
+  debounce_ticks = KEYPAD_EVENTS_DEBOUNCE_MSEC / g_kp_ev_tick_msec;
+  g_kp_ev_debounce_ticks = (debounce_ticks > 0) ? debounce_ticks : 1;
+
+  memset(g_kp_ev_count, 0, sizeof(g_kp_ev_count));
+  g_kp_ev_ticks      = 0;
+  g_kp_ev_counting   = 0;
+  g_kp_ev_state      = 0;
+  g_kp_ev_keys       = 0;
+  g_kp_ev_repeat_bit = KEYPAD_EVENTS_NO_REPEAT;
+  g_kp_ev_head       = 0;
+  g_kp_ev_tail       = 0;
+  g_kp_ev_dropped    = 0;
+
+} /* keypad_events_init */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function is the periodic tick. It reads the key matrix, moves
+//    the counter of each key that reads pressed up and of each key that
+//    reads released down, and queues an event when a counter reaches its
+//    end. Only the keys that are pressed or still counting are looked at.
+//
+// INPUT PARAMETERS:
+//    none
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    none
+// -----------------------------------------------------------------------------
+void keypad_events_tick(void)
+{
+  uint16_t raw = keypad_read_matrix();
+  uint16_t active;
+  uint16_t mask;
+  uint32_t now;
+
+  g_kp_ev_ticks++;
+  now = g_kp_ev_ticks * g_kp_ev_tick_msec;
+
+  if (keypad_events_ghost(raw))
+  {
+    raw = g_kp_ev_state;
+  } /* if */
+
+  active = raw | g_kp_ev_counting;
+  for (uint8_t bit = 0; active != 0; bit++, active >>= 1)
+  {
+    if ((active & 1) == 0)
+    {
+      continue;
+    } /* if */
+
+    mask = 1U << bit;
+    if ((raw & mask) != 0)
+    {
+      if (g_kp_ev_count[bit] < g_kp_ev_debounce_ticks)
+      {
+        g_kp_ev_count[bit]++;
+      } /* if */
+
+      if ((g_kp_ev_count[bit] == g_kp_ev_debounce_ticks) &&
+          ((g_kp_ev_state & mask) == 0))
+      {
+        g_kp_ev_state |= mask;
+        keypad_events_push(bit, KEYPAD_EVENT_PRESS, now);
+        g_kp_ev_repeat_bit  = bit;
+        g_kp_ev_repeat_msec = now + KEYPAD_EVENTS_REPEAT_DELAY_MSEC;
+      } /* if */
+    }
+    else
+    {
+      if (g_kp_ev_count[bit] > 0)
+      {
+        g_kp_ev_count[bit]--;
+      } /* if */
+
+      if ((g_kp_ev_count[bit] == 0) && ((g_kp_ev_state & mask) != 0))
+      {
+        g_kp_ev_state &= ~mask;
+        keypad_events_push(bit, KEYPAD_EVENT_RELEASE, now);
+        if (g_kp_ev_repeat_bit == bit)
+        {
+          g_kp_ev_repeat_bit = KEYPAD_EVENTS_NO_REPEAT;
+        } /* if */
+      } /* if */
+    } /* if */
+
+    if (g_kp_ev_count[bit] != 0)
+    {
+      g_kp_ev_counting |= mask;
+    }
+    else
+    {
+      g_kp_ev_counting &= ~mask;
+    } /* if */
+  } /* for */
+
+  if ((g_kp_ev_repeat_bit != KEYPAD_EVENTS_NO_REPEAT) &&
+      ((int32_t)(now - g_kp_ev_repeat_msec) >= 0))
+  {
+    keypad_events_push(g_kp_ev_repeat_bit, KEYPAD_EVENT_REPEAT, now);
+    g_kp_ev_repeat_msec += KEYPAD_EVENTS_REPEAT_RATE_MSEC;
+  } /* if */
+
+} /* keypad_events_tick */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function takes the oldest event from the queue.
+//
+// INPUT PARAMETERS:
+//    none
+//
+// OUTPUT PARAMETERS:
+//    event - the event, when there is one
+//
+// RETURN:
+//    true if an event was taken, false if the queue is empty
+// -----------------------------------------------------------------------------
+bool keypad_events_get(keypad_event_t *event)
+{
+  uint8_t tail = g_kp_ev_tail;
+
+  if (tail == g_kp_ev_head)
+  {
+    return false;
+  } /* if */
+
+  *event = g_kp_ev_fifo[tail];
+  g_kp_ev_tail = (tail + 1) & KEYPAD_EVENTS_FIFO_MASK;
+
+  return true;
+
+} /* keypad_events_get */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function returns the number of events in the queue.
+//
+// INPUT PARAMETERS:
+//    none
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    number of events waiting
+// -----------------------------------------------------------------------------
+uint8_t keypad_events_count(void)
+{
+  return ((g_kp_ev_head - g_kp_ev_tail) & KEYPAD_EVENTS_FIFO_MASK);
+} /* keypad_events_count */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function returns the debounced state of all the keys.
+//
+// INPUT PARAMETERS:
+//    none
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    bit n is set while the key with keycodes index n is pressed
+// -----------------------------------------------------------------------------
+uint16_t keypad_events_state(void)
+{
+  return (g_kp_ev_keys);
+} /* keypad_events_state */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function returns the number of events lost because the queue
+//    was full.
+//
+// INPUT PARAMETERS:
+//    none
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    number of events dropped since keypad_events_init()
+// -----------------------------------------------------------------------------
+uint32_t keypad_events_dropped(void)
+{
+  return (g_kp_ev_dropped);
+} /* keypad_events_dropped */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function checks a matrix read for a possible ghost key, two
+//    columns that share two or more pressed rows.
+//
+// INPUT PARAMETERS:
+//    matrix - value from keypad_read_matrix()
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    true if the read cannot be trusted
+// -----------------------------------------------------------------------------
+static bool keypad_events_ghost(uint16_t matrix)
+{
+  uint8_t common;
+
+  for (uint8_t col = 0; col < MAX_NUM_KP_COLS - 1; col++)
+  {
+    for (uint8_t other = col + 1; other < MAX_NUM_KP_COLS; other++)
+    {
+      common = (matrix >> (col * MAX_NUM_KP_ROWS)) &
+               (matrix >> (other * MAX_NUM_KP_ROWS)) & KEYPAD_EVENTS_COL_MASK;
+
+      // More than one bit set
+      if ((common & (common - 1)) != 0)
+      {
+        return true;
+      } /* if */
+    } /* for */
+  } /* for */
+
+  return false;
+
+} /* keypad_events_ghost */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function adds an event to the queue and updates the key state.
+//    When the queue is full the event is dropped and counted.
+//
+// INPUT PARAMETERS:
+//    bit  - matrix bit of the key
+//    type - KEYPAD_EVENT_x
+//    now  - time of the event in ms
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    none
+// -----------------------------------------------------------------------------
+static void keypad_events_push(uint8_t bit, uint8_t type, uint32_t now)
+{
+  uint8_t key  = keypad_matrix_key(bit);
+  uint8_t head = g_kp_ev_head;
+  uint8_t next = (head + 1) & KEYPAD_EVENTS_FIFO_MASK;
+
+  if (type == KEYPAD_EVENT_PRESS)
+  {
+    g_kp_ev_keys |= (1U << key);
+  }
+  else if (type == KEYPAD_EVENT_RELEASE)
+  {
+    g_kp_ev_keys &= ~(1U << key);
+  } /* if */
+
+  if (next == g_kp_ev_tail)
+  {
+    g_kp_ev_dropped++;
+    return;
+  } /* if */
+
+  g_kp_ev_fifo[head].time_msec = now;
+  g_kp_ev_fifo[head].key       = key;
+  g_kp_ev_fifo[head].type      = type;
+  g_kp_ev_head = next;
+
+} /* keypad_events_push */
@@ -0,0 +1,108 @@
+// *****************************************************************************
+// ***************************    C Source Code     ****************************
+// *****************************************************************************
+//   DESIGNER NAME:  Bruce Link
+//
+//         VERSION:  1.0
+//
+//       FILE NAME:  keypad_events.h
+//
+//-----------------------------------------------------------------------------
+// DESCRIPTION
+//    This module turns the 4x4 keypad into a queue of key events. Every
+//    tick the whole key matrix is read with keypad_read_matrix() and each
+//    key is debounced on its own with an integrating counter: a key has to
+//    read pressed (or released) for KEYPAD_EVENTS_DEBOUNCE_MSEC in total
+//    before its state changes, so short glitches are ignored.
+//
+//    Every change is queued as a press or release event with the time it
+//    was accepted. Several keys can be held at once and each one gets its
+//    own events. The last key pressed also repeats while it is held. If
+//    the queue fills up the events are counted as dropped.
+//
+//    Ticks come from a periodic interrupt, for example:
+//
+//      sys_tick_init(get_bus_clock_freq() / 200);       // 5ms tick
+//      keypad_events_init(5);
+//
+//      void SysTick_Handler(void)
+//      {
+//        keypad_events_tick();
+//      }
+//
+//      while (keypad_events_get(&event)) { ... }
+//
+//    NOTE: The keypad has no diodes. A scan where two columns share two or
+//          more pressed rows cannot tell the real keys from a ghost key,
+//          so it is ignored and the keys keep their last state.
+//
+//-----------------------------------------------------------------------------
+// DISCLAIMER
+//    This code was developed for educational purposes as part of the CSC202
+//    course at Monroe Community Collage and is provided "as is" without
+//    warranties of any kind, whether express, implied, or statutory.
+//
+//    The author and organization do not warrant the accuracy, completeness, or
+//    reliability of the code. The author and organization shall not be liable
+//    for any direct, indirect, incidental, special, exemplary, or consequential
+//    damages arising out of the use of or inability to use the code, even if
+//    advised of the possibility of such damages.
+//
+//    Use of this code is at your own risk, and it is recommended to validate
+//    and adapt the code for your specific application and hardware
+//    requirements.
+//
+// Copyright (c) 2026 by Bruce Link
+//    You may use, edit, run or distribute this file as long as the above
+//    copyright notice remains
+// *****************************************************************************
+//******************************************************************************
+
+#ifndef __KEYPAD_EVENTS_H__
+#define __KEYPAD_EVENTS_H__
+
+//-----------------------------------------------------------------------------
+// Load standard C include files
+//-----------------------------------------------------------------------------
+#include <stdint.h>
+#include <stdbool.h>
+
+//-----------------------------------------------------------------------------
+// Define symbolic constants used by the module
+//-----------------------------------------------------------------------------
+
+// Number of events the queue holds (must be a power of 2)
+#define KEYPAD_EVENTS_FIFO_SIZE                                             (16)
+
+// Time a key must read the same before its state changes
+#define KEYPAD_EVENTS_DEBOUNCE_MSEC                                         (20)
+
+// Time a key is held before it repeats, and the time between repeats
+#define KEYPAD_EVENTS_REPEAT_DELAY_MSEC                                    (500)
+#define KEYPAD_EVENTS_REPEAT_RATE_MSEC                                     (100)
+
+// Event types
+#define KEYPAD_EVENT_PRESS                                                   (0)
+#define KEYPAD_EVENT_RELEASE                                                 (1)
+#define KEYPAD_EVENT_REPEAT                                                  (2)
+
+// Define a structure to hold one key event
+typedef struct
+{
+  uint32_t time_msec;         // ticks since keypad_events_init, in ms
+  uint8_t  key;               // index of the key in keycodes
+  uint8_t  type;              // KEYPAD_EVENT_x
+} keypad_event_t;
+
+
+// ----------------------------------------------------------------------------
+// Prototype for support functions
+// ----------------------------------------------------------------------------
+void keypad_events_init(uint16_t tick_msec);
+void keypad_events_tick(void);
+bool keypad_events_get(keypad_event_t *event);
+uint8_t keypad_events_count(void);
+uint16_t keypad_events_state(void);
+uint32_t keypad_events_dropped(void);
+
+#endif /* __KEYPAD_EVENTS_H__ */
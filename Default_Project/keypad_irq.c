@@ -0,0 +1,411 @@
+// *****************************************************************************
+// ***************************    C Source Code     ****************************
+// *****************************************************************************
+//   DESIGNER NAME:  Bruce Link
+//
+//         VERSION:  1.0
+//
+//       FILE NAME:  keypad_irq.c
+//
+//-----------------------------------------------------------------------------
+// DESCRIPTION
+//    This file contains the interrupt driven keypad. See keypad_irq.h for
+//    how it works.
+//
+//-----------------------------------------------------------------------------
+// DISCLAIMER
+//    This code was developed for educational purposes as part of the CSC202
+//    course at Monroe Community Collage and is provided "as is" without
+//    warranties of any kind, whether express, implied, or statutory.
+//
+//    The author and organization do not warrant the accuracy, completeness, or
+//    reliability of the code. The author and organization shall not be liable
+//    for any direct, indirect, incidental, special, exemplary, or consequential
+//    damages arising out of the use of or inability to use the code, even if
+//    advised of the possibility of such damages.
+//
+//    Use of this code is at your own risk, and it is recommended to validate
+//    and adapt the code for your specific application and hardware
+//    requirements.
+//
+// Copyright (c) 2026 by Bruce Link
+//    You may use, edit, run or distribute this file as long as the above
+//    copyright notice remains
+// *****************************************************************************
+//******************************************************************************
+
+//-----------------------------------------------------------------------------
+// Load standard C include files
+//-----------------------------------------------------------------------------
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+//-----------------------------------------------------------------------------
+// Loads MSP launchpad board support macros and definitions
+//-----------------------------------------------------------------------------
+#include <ti/devices/msp/msp.h>
+#include "LaunchPad.h"
+#include "clock.h"
+#include "gpio_irq.h"
+#include "keypad_irq.h"
+
+
+//-----------------------------------------------------------------------------
+// Define symbolic constants used by the module
+//-----------------------------------------------------------------------------
+
+// Column value that drives all the columns low, and the rows read with no
+// key pressed
+#define KEYPAD_IRQ_ALL_COLS_LOW                                           (0x00)
+#define KEYPAD_IRQ_ROWS_IDLE                                              (0x0F)
+
+// Scans to try before giving up on a row state that matches no key (two
+// keys in one column)
+#define KEYPAD_IRQ_MAX_SCANS                                                 (4)
+
+
+//-----------------------------------------------------------------------------
+// Define function prototypes used by the module
+//-----------------------------------------------------------------------------
+static uint8_t keypad_irq_scan(void);
+static void keypad_irq_sleep(bool pressed);
+static void keypad_irq_row_edge(uint8_t port_id, uint8_t pin);
+
+
+//-----------------------------------------------------------------------------
+// Define global variables and structures here.
+// NOTE: when possible avoid using global variables
+//-----------------------------------------------------------------------------
+
+// All the row pins of each port, from keypad_row_masks()
+static uint32_t g_kp_irq_row_pins[MAX_NUM_GPIO_PORTS];
+
+// Key found by the last scan (NO_KEY_PRESSED if none) and the cycle count
+// at the start of the interrupt that scanned it
+static volatile uint8_t  g_kp_irq_key = NO_KEY_PRESSED;
+static volatile uint32_t g_kp_irq_start = 0;
+
+static keypad_irq_stats_t g_kp_irq_stats;
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function sets up the keypad for interrupt driven reading. The
+//    keypad pins are set up with keypad_init(), all the columns are driven
+//    low and every row is registered with the GPIO interrupt service to
+//    interrupt on both edges. The cycle counter is started for the
+//    statistics.
+//
+// INPUT PARAMETERS:
+//    none
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    none
+// -----------------------------------------------------------------------------
+void keypad_irq_init(void)
+{
+  keypad_init();
+  gpio_irq_init();
+
+  keypad_row_masks(g_kp_irq_row_pins);
+
+  write_keycol_data(KEYPAD_IRQ_ALL_COLS_LOW);
+
+  g_kp_irq_key = keypad_irq_scan();
+  keypad_irq_clear_stats();
+
+  for (uint8_t port = 0; port < MAX_NUM_GPIO_PORTS; port++)
+  {
+    if (g_kp_irq_row_pins[port] != 0)
+    {
+      (void)gpio_irq_register(port, g_kp_irq_row_pins[port],
+                              GPIO_IRQ_EDGE_BOTH, keypad_irq_row_edge);
+    } /* if */
+  } /* for */
+
+} /* keypad_irq_init */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function unregisters the row interrupts and de-configures the
+//    keypad with keypad_deinit().
+//
+// INPUT PARAMETERS:
+//    none
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    none
+// -----------------------------------------------------------------------------
+void keypad_irq_deinit(void)
+{
+  for (uint8_t port = 0; port < MAX_NUM_GPIO_PORTS; port++)
+  {
+    gpio_irq_unregister(port, g_kp_irq_row_pins[port]);
+  } /* for */
+
+  keypad_deinit();
+
+} /* keypad_irq_deinit */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function returns the key that is pressed now, without waiting
+//    and without debouncing.
+//
+// INPUT PARAMETERS:
+//    none
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    index of the key in keycodes, or NO_KEY_PRESSED
+// -----------------------------------------------------------------------------
+uint8_t keypad_irq_key(void)
+{
+  return (g_kp_irq_key);
+} /* keypad_irq_key */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function waits in STOP mode for a key to be pressed. The key must
+//    be the same KEYPAD_IRQ_DEBOUNCE_MSEC after the press, otherwise the
+//    wait starts again.
+//
+// INPUT PARAMETERS:
+//    none
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    index of the key in keycodes
+// -----------------------------------------------------------------------------
+uint8_t keypad_irq_getkey(void)
+{
+  uint8_t key;
+
+  do
+  {
+    keypad_irq_sleep(true);
+    key = g_kp_irq_key;
+    msec_delay(KEYPAD_IRQ_DEBOUNCE_MSEC);
+  } while (g_kp_irq_key != key);
+
+  return (key);
+
+} /* keypad_irq_getkey */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function waits in STOP mode until no key is pressed, and has
+//    stayed released for KEYPAD_IRQ_DEBOUNCE_MSEC.
+//
+// INPUT PARAMETERS:
+//    none
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    none
+// -----------------------------------------------------------------------------
+void keypad_irq_wait_release(void)
+{
+  do
+  {
+    keypad_irq_sleep(false);
+    msec_delay(KEYPAD_IRQ_DEBOUNCE_MSEC);
+  } while (g_kp_irq_key != NO_KEY_PRESSED);
+
+} /* keypad_irq_wait_release */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    These functions read and clear the keypad interrupt statistics.
+//
+// INPUT PARAMETERS:
+//    none
+//
+// OUTPUT PARAMETERS:
+//    stats - copy of the statistics (keypad_irq_get_stats)
+//
+// RETURN:
+//    none
+// -----------------------------------------------------------------------------
+void keypad_irq_get_stats(keypad_irq_stats_t *stats)
+{
+  uint32_t primask = __get_PRIMASK();
+
+  __disable_irq();
+  *stats = g_kp_irq_stats;
+  __set_PRIMASK(primask);
+
+} /* keypad_irq_get_stats */
+
+void keypad_irq_clear_stats(void)
+{
+  uint32_t primask = __get_PRIMASK();
+
+  __disable_irq();
+  memset(&g_kp_irq_stats, 0, sizeof(g_kp_irq_stats));
+  __set_PRIMASK(primask);
+
+} /* keypad_irq_clear_stats */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function scans the keypad and drives all the columns low again.
+//    While a key is held the scan itself changes the rows, so the row
+//    interrupts are cleared after it. The scan is repeated if the rows
+//    changed during it (the rows do not match the key found), up to
+//    KEYPAD_IRQ_MAX_SCANS times.
+//
+// INPUT PARAMETERS:
+//    none
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    index of the key in keycodes, or NO_KEY_PRESSED
+// -----------------------------------------------------------------------------
+static uint8_t keypad_irq_scan(void)
+{
+  uint8_t key;
+  uint8_t rows;
+  uint8_t scans = 0;
+
+  do
+  {
+    key = keypad_scan();
+    write_keycol_data(KEYPAD_IRQ_ALL_COLS_LOW);
+
+    for (uint8_t port = 0; port < MAX_NUM_GPIO_PORTS; port++)
+    {
+      gpio_port_regs(port)->CPU_INT.ICLR = g_kp_irq_row_pins[port];
+    } /* for */
+
+    rows = read_keyrow_data();
+    scans++;
+  } while (((key == NO_KEY_PRESSED) != (rows == KEYPAD_IRQ_ROWS_IDLE)) &&
+           (scans < KEYPAD_IRQ_MAX_SCANS));
+
+  return (key);
+
+} /* keypad_irq_scan */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function puts the core in STOP mode until a key is pressed, or
+//    released. The interrupts are off while the key is checked, so a key
+//    interrupt between the check and the WFI still wakes the core; they
+//    are turned on briefly after each wake up to let the handler run.
+//    Wake ups caused by other interrupts go back to sleep.
+//
+// INPUT PARAMETERS:
+//    pressed - true to wait for a key press, false for a release
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    none
+// -----------------------------------------------------------------------------
+static void keypad_irq_sleep(bool pressed)
+{
+  uint32_t primask = __get_PRIMASK();
+  uint32_t irqs;
+  uint32_t cycles;
+
+  __disable_irq();
+
+  while ((g_kp_irq_key != NO_KEY_PRESSED) != pressed)
+  {
+    irqs = g_kp_irq_stats.irqs;
+
+    SYSCTL->SOCLOCK.PMODECFG = SYSCTL_PMODECFG_DSLEEP_STOP;
+    SCB->SCR |= SCB_SCR_SLEEPDEEP_Msk;
+    __WFI();
+    SCB->SCR &= ~SCB_SCR_SLEEPDEEP_Msk;
+
+    __enable_irq();
+    __disable_irq();
+
+    if (g_kp_irq_stats.irqs != irqs)
+    {
+      cycles = cycle_counter_get() - g_kp_irq_start;
+      g_kp_irq_stats.wakes++;
+      g_kp_irq_stats.wake_cycles = cycles;
+      if (cycles > g_kp_irq_stats.max_wake_cycles)
+      {
+        g_kp_irq_stats.max_wake_cycles = cycles;
+      } /* if */
+    } /* if */
+  } /* while */
+
+  __set_PRIMASK(primask);
+
+} /* keypad_irq_sleep */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function is called by the GPIO interrupt service when a row
+//    changed. The keypad is scanned and the key is updated. The time from
+//    the start of the interrupt to the end of the scan is recorded.
+//
+//    When more than one row changed before the interrupt was taken it is
+//    called for each of them, and the key is scanned again each time.
+//
+// INPUT PARAMETERS:
+//    port_id - port of the row
+//    pin     - pin of the row
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    none
+// -----------------------------------------------------------------------------
+static void keypad_irq_row_edge(uint8_t port_id, uint8_t pin)
+{
+  uint32_t start = gpio_irq_entry_cycles();
+  uint32_t cycles;
+  uint8_t  key;
+
+  (void)port_id;
+  (void)pin;
+
+  g_kp_irq_start = start;
+  g_kp_irq_stats.irqs++;
+
+  key = keypad_irq_scan();
+  if (key != g_kp_irq_key)
+  {
+    g_kp_irq_key = key;
+    g_kp_irq_stats.changes++;
+  } /* if */
+
+  cycles = cycle_counter_get() - start;
+  g_kp_irq_stats.scan_cycles = cycles;
+  if (cycles > g_kp_irq_stats.max_scan_cycles)
+  {
+    g_kp_irq_stats.max_scan_cycles = cycles;
+  } /* if */
+
+} /* keypad_irq_row_edge */
@@ -0,0 +1,96 @@
+// *****************************************************************************
+// ***************************    C Source Code     ****************************
+// *****************************************************************************
+//   DESIGNER NAME:  Bruce Link
+//
+//         VERSION:  1.0
+//
+//       FILE NAME:  keypad_irq.h
+//
+//-----------------------------------------------------------------------------
+// DESCRIPTION
+//    This module reads the 4x4 keypad on the CSC202 board without polling.
+//    All the columns are driven low and the rows (which have pull ups)
+//    raise a GPIO interrupt on either edge, through the GPIO interrupt
+//    service (gpio_irq). A press or a release changes a row, and only then
+//    is the keypad scanned, from the interrupt. The rest of the time the
+//    core is in STOP mode.
+//
+//    keypad_irq_getkey() and keypad_irq_wait_release() replace
+//    getkey_pressed() and wait_no_key_pressed(). Each time they wake, the
+//    key is checked again after KEYPAD_IRQ_DEBOUNCE_MSEC.
+//
+//    The statistics count the wake ups and measure, with the cycle counter,
+//    the time from the start of the interrupt to the key being scanned and
+//    to the main code running again. The time the core takes to leave STOP
+//    mode, before the interrupt starts, is not included; it has to be
+//    measured from the key edge with a scope.
+//
+//    NOTE: STOP mode stops the PD1 peripherals (TIMA, TIMG6/7/12, SPI,
+//          ...) and the 40MHz crystal, so do not wait for a key while
+//          another service needs them. Until the crystal restarts after a
+//          wake up the core runs from SYSOSC, so cycle counts taken then
+//          are not exact.
+//
+//-----------------------------------------------------------------------------
+// DISCLAIMER
+//    This code was developed for educational purposes as part of the CSC202
+//    course at Monroe Community Collage and is provided "as is" without
+//    warranties of any kind, whether express, implied, or statutory.
+//
+//    The author and organization do not warrant the accuracy, completeness, or
+//    reliability of the code. The author and organization shall not be liable
+//    for any direct, indirect, incidental, special, exemplary, or consequential
+//    damages arising out of the use of or inability to use the code, even if
+//    advised of the possibility of such damages.
+//
+//    Use of this code is at your own risk, and it is recommended to validate
+//    and adapt the code for your specific application and hardware
+//    requirements.
+//
+// Copyright (c) 2026 by Bruce Link
+//    You may use, edit, run or distribute this file as long as the above
+//    copyright notice remains
+// *****************************************************************************
+//******************************************************************************
+
+#ifndef __KEYPAD_IRQ_H__
+#define __KEYPAD_IRQ_H__
+
+//-----------------------------------------------------------------------------
+// Load standard C include files
+//-----------------------------------------------------------------------------
+#include <stdint.h>
+
+//-----------------------------------------------------------------------------
+// Define symbolic constants used by the module
+//-----------------------------------------------------------------------------
+
+// Time a key must stay the same before it is accepted
+#define KEYPAD_IRQ_DEBOUNCE_MSEC                                            (10)
+
+// Define a structure to hold the keypad interrupt statistics
+typedef struct
+{
+  uint32_t wakes;             // times the core left STOP mode
+  uint32_t irqs;              // row interrupts serviced
+  uint32_t changes;           // scans that found a different key
+  uint32_t scan_cycles;       // last interrupt start to key scanned
+  uint32_t max_scan_cycles;   // longest of scan_cycles
+  uint32_t wake_cycles;       // last interrupt start to main code running
+  uint32_t max_wake_cycles;   // longest of wake_cycles
+} keypad_irq_stats_t;
+
+
+// ----------------------------------------------------------------------------
+// Prototype for support functions
+// ----------------------------------------------------------------------------
+void keypad_irq_init(void);
+void keypad_irq_deinit(void);
+uint8_t keypad_irq_key(void);
+uint8_t keypad_irq_getkey(void);
+void keypad_irq_wait_release(void);
+void keypad_irq_get_stats(keypad_irq_stats_t *stats);
+void keypad_irq_clear_stats(void);
+
+#endif /* __KEYPAD_IRQ_H__ */
@@ -15,6 +15,10 @@
 //    setting the cursor, writing characters and strings, and clearing the
 //    display.
 //
+//    This file is the HD44780 protocol layer. The bytes are moved to the LCD
+//    by a transport (see lcd1602_transport.h), the PCF8574 I2C backpack by
+//    default or GPIO pins after lcd1602_set_transport().
+//
 //    NOTE: This code assumes that the IIC address is 0x27.
 //
 //-----------------------------------------------------------------------------
@@ -43,6 +47,8 @@
 // Load standard C include files
 //-----------------------------------------------------------------------------
 #include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
 
 //-----------------------------------------------------------------------------
 // Loads MSP launchpad board support macros and definitions
@@ -50,11 +56,28 @@
 #include "clock.h"
 #include "lcd1602.h"
 #include "LaunchPad.h"
+#include "num_ascii.h"
 
 //-----------------------------------------------------------------------------
-// global signal to track status of backlight of LCD module
+// Define global variables and structures here.
+// NOTE: when possible avoid using global variables
 //-----------------------------------------------------------------------------
-static uint8_t g_lcd_backlight_mode = 0;
+
+// Transport that reaches the LCD, the I2C backpack unless changed with
+// lcd1602_set_transport()
+static const lcd1602_transport_t *g_lcd_transport = NULL;
+
+// Bytes sent and time spent by the protocol layer
+static lcd1602_stats_t g_lcd_stats;
+
+// Set while a background user (lcd_service) owns the display
+static volatile bool g_lcd_locked = false;
+
+//-----------------------------------------------------------------------------
+// Define function prototypes used by the module
+//-----------------------------------------------------------------------------
+static uint32_t lcd1602_send(uint8_t command, const char *data,
+                uint8_t length, bool slow_cmd);
 
 
 //-----------------------------------------------------------------------------
@@ -81,7 +104,8 @@ static uint8_t g_lcd_backlight_mode = 0;
 // RETURN:
 //   uint32_t - Status code indicating success or failure of the operation.
 //        0 if successful
-//        1 if failure
+//        otherwise the status codes of the transport writes (I2C status
+//        codes for the PCF8574 backpack) OR'd together
 // -----------------------------------------------------------------------------
 uint32_t lcd1602_init(void)
 {
@@ -99,24 +123,26 @@ uint32_t lcd1602_init(void)
     LCD_ENTRY_MODE_SET_CMD | LCD_ADDR_INC_ENABLE | LCD_SHIFT_DISABLE,
     LCD_CLEAR_DISPLAY_CMD};
 
-  // send the first 4 commands as a single I2C (nibble) transfer
-  for (uint8_t index = 0; index < 4; index++)
+  if (g_lcd_transport == NULL)
   {
-    status |= I2C_mstr_send1(LCD_IIC_ADDRESS, lcd_init_code[index] |
-                      LATCH_ENABLE | WRITE_ENABLE | LCD_INSTR_REG);
-    msec_delay(IIC_TIME_DELAY_2MS);
+    g_lcd_transport = lcd1602_i2c_transport();
+  } /* if */
 
-    status |= I2C_mstr_send1(LCD_IIC_ADDRESS, lcd_init_code[index] |
-                        WRITE_ENABLE | LCD_INSTR_REG);
-    msec_delay(IIC_TIME_DELAY_2MS);
+  cycle_counter_init();
+  status = g_lcd_transport->init();
+
+  // send the first 4 commands as single nibbles (reset to 4-bit mode)
+  for (uint8_t index = 0; index < 4; index++)
+  {
+    status |= g_lcd_transport->write_nibble(lcd_init_code[index]);
+    msec_delay(IIC_TIME_DELAY_4MS);
   } /* for */
 
-  // Send the first 4 commands as a two I2C transfer
+  // Send the rest of the commands as full bytes (two nibbles)
   for (uint8_t index = 4; index < MAX_NUM_CMDS; index++)
   {
-    status |= lcd1602_write(LCD_IIC_ADDRESS, lcd_init_code[index], 
+    status |= lcd1602_write(LCD_IIC_ADDRESS, lcd_init_code[index],
                           LCD_INSTR_REG);
-    msec_delay(IIC_TIME_DELAY_2MS);
   } /* for */
 
   lcd_set_backlight_on();
@@ -125,25 +151,129 @@ uint32_t lcd1602_init(void)
 
 } /* lcd1602_init */
 
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function selects the transport used to reach the LCD. Call it
+//    before lcd1602_init(), which sets up the transport. If it is never
+//    called the I2C backpack transport is used.
+//
+//    NOTE: The background LCD service and the marquee build PCF8574
+//          sequences themselves and only work with the I2C transport.
+//
+// INPUT PARAMETERS:
+//    transport - lcd1602_i2c_transport() or lcd1602_gpio_transport()
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    none
+// -----------------------------------------------------------------------------
+void lcd1602_set_transport(const lcd1602_transport_t *transport)
+{
+  g_lcd_transport = transport;
+} /* lcd1602_set_transport */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function returns the transport in use, NULL before lcd1602_init()
+//    if none was selected.
+//
+// INPUT PARAMETERS:
+//    none
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    pointer to the transport
+// -----------------------------------------------------------------------------
+const lcd1602_transport_t *lcd1602_get_transport(void)
+{
+  return (g_lcd_transport);
+} /* lcd1602_get_transport */
+
+
 //-----------------------------------------------------------------------------
 // DESCRIPTION:
-//    This function sends byte (command or data) to the LCD1602 display over 
-//    I2C, using the 4-bit interface protocol. The byte is split into upper 
-//    and lower 4-bit nibbles, each transmitted separately. The Enable (E) 
+//    These functions read and clear the transfer statistics. Every write
+//    through the protocol layer counts the bytes sent to the LCD and the
+//    bus clock cycles spent sending them and waiting for the LCD, so
+//    bytes / cycles gives the throughput of the transport in use.
+//
+// INPUT PARAMETERS:
+//    none
+//
+// OUTPUT PARAMETERS:
+//    stats - copy of the statistics (lcd1602_get_stats)
+//
+// RETURN:
+//    none
+// -----------------------------------------------------------------------------
+void lcd1602_get_stats(lcd1602_stats_t *stats)
+{
+  *stats = g_lcd_stats;
+} /* lcd1602_get_stats */
+
+void lcd1602_clear_stats(void)
+{
+  memset(&g_lcd_stats, 0, sizeof(g_lcd_stats));
+} /* lcd1602_clear_stats */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function locks or unlocks the blocking LCD writes. A background
+//    user of the display, such as lcd_service, locks it while it sends its
+//    own transfers. While it is locked every blocking write (characters,
+//    commands and CGRAM glyph loads) returns I2C_ERR_BUSY and the backlight
+//    functions do nothing, so nothing collides with the background
+//    transfers or moves the LCD address counter behind their back.
+//
+// INPUT PARAMETERS:
+//    locked - true to lock the blocking writes, false to allow them again
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    none
+// -----------------------------------------------------------------------------
+void lcd1602_set_locked(bool locked)
+{
+  g_lcd_locked = locked;
+} /* lcd1602_set_locked */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function sends byte (command or data) to the LCD1602 display
+//    through the transport, using the 4-bit interface protocol. The byte
+//    is split into upper and lower 4-bit nibbles, each transmitted
+//    separately. The Enable (E) 
 //    line is pulsed for each nibble to latch the data. The RS (Register Select) 
 //    bit determines whether the byte is a command (0) or display data (1). 
 //    The current backlight setting is included with each transmission.
 //
+//    With the I2C transport the PCF8574 latches every byte it receives, so
+//    the whole sequence (RS/RW setup, E high, E low for each nibble, then
+//    R/W de-asserted) is sent as one I2C burst. Each byte takes 90us at
+//    100kHz which is far more than the setup, hold and pulse width times
+//    the LCD needs. The GPIO transport times those in bus clock cycles.
+//
 //    NOTE:
 //        The HD44780-based LCD1602 specifies nanosecond-scale timing for 
 //        control signal setup and hold (e.g., Enable pulse width ~450 ns),
 //        but command execution times are much longer — up to 1.53 ms for 
 //        commands like Clear Display or Return Home.
 //
-//        In a parallel interface, the busy flag (BF) can be polled to know 
-//        when the LCD is ready for the next command. However, with I2C (like 
-//        we are using) reading from the LCD is not feasible, so we use 
-//        fixed delays instead.
+//        The busy flag (BF) can be polled to know when the LCD is ready for
+//        the next command. Through the PCF8574 this takes three short I2C
+//        transactions, so it is only done when lcd_busy_poll_enable() has
+//        been called. Otherwise a fixed delay is used. The GPIO transport
+//        has no busy flag and waits for the execution time instead.
 //
 //        These delays (typically 1–2 ms) are intentionally conservative to 
 //        ensure correct operation, especially after slow commands. Without 
@@ -151,7 +281,9 @@ uint32_t lcd1602_init(void)
 //        leading to display glitches or lockups.
 //
 // INPUT PARAMETERS:
-//    iic_addr   - the 8-bit I2C address of the LCD1602 display.
+//    iic_addr   - ignored. The transport selected by lcd1602_set_transport()
+//                 holds the I2C address. The parameter is only kept so
+//                 existing callers still compile.
 //    data       - the byte of data to be sent to the LCD.
 //    reg_select - an 8-bit value to indicate whether the data is to be written 
 //                 to the instruction registers (0) or data registers (1).
@@ -162,50 +294,164 @@ uint32_t lcd1602_init(void)
 // RETURN:
 //    uint32_t - Status code indicating success or failure of the operation.
 //        0 if successful
-//        1 if failure
+//        otherwise the status code of the transport write (an I2C status
+//        code for the PCF8574 backpack)
 // -----------------------------------------------------------------------------
 uint32_t lcd1602_write(uint8_t iic_addr, uint8_t data, uint8_t reg_select)
 {
-  uint32_t status = 0;
-  uint8_t  upper_nibble = (data & UPPER_NIBBLE_MASK);
-  uint8_t  lower_nibble = (data & LOWER_NIBBLE_MASK) << NIBBLE_SHIFT;
+  // The transport owns the bus address, iic_addr is kept for old callers
+  (void)iic_addr;
 
-  upper_nibble |= g_lcd_backlight_mode | WRITE_ENABLE | reg_select;
-  lower_nibble |= g_lcd_backlight_mode | WRITE_ENABLE | reg_select;
+  if (reg_select == LCD_INSTR_REG)
+  {
+    // Give LCD module time to complete command (clear and home are slow)
+    return (lcd1602_send(data, NULL, 0, (data != 0) &&
+                         (data < LCD_ENTRY_MODE_SET_CMD)));
+  } /* if */
 
-  // Send upper nibble
-  // Set RS and R/W with data
-  status |= I2C_mstr_send1(iic_addr, upper_nibble);
-  usec_delay(LCD1602_E_SETUP_DELAY);
-  
-  // Set Enable high
-  status |= I2C_mstr_send1(iic_addr, upper_nibble | LATCH_ENABLE);
-  usec_delay(LCD1602_E_PULSE_WIDTH);
-  
-  // Set Enable low
-  status |= I2C_mstr_send1(iic_addr, upper_nibble);
-  usec_delay(LCD1602_HOLD_DELAY);
+  return (lcd1602_send(LCD_NO_COMMAND, (const char *)&data, 1, false));
 
-  // send lower nibble
-  // Set RS and R/W with data
-  status |= I2C_mstr_send1(iic_addr, lower_nibble);
-  usec_delay(LCD1602_E_SETUP_DELAY);
+} /* lcd1602_write */
 
-  // Set Enable high
-  status |= I2C_mstr_send1(iic_addr, lower_nibble | LATCH_ENABLE);
-  usec_delay(LCD1602_E_PULSE_WIDTH);
 
-  status |= I2C_mstr_send1(iic_addr, lower_nibble);
-  usec_delay(LCD1602_HOLD_DELAY);
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function writes a block of characters to the DDRAM starting at
+//    the current address. With the I2C transport up to LCD_MAX_BURST_CHARS
+//    characters are packed into a single I2C burst, longer blocks use one
+//    burst per LCD_MAX_BURST_CHARS characters.
+//
+// INPUT PARAMETERS:
+//    data   - pointer to the characters to write
+//    length - number of characters to write
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    uint32_t - Status code indicating success or failure of the operation.
+//        0 if successful
+//        otherwise the status code of the transport write (an I2C status
+//        code for the PCF8574 backpack)
+// -----------------------------------------------------------------------------
+uint32_t lcd_write_chars(const char *data, uint8_t length)
+{
+  return (lcd1602_send(LCD_NO_COMMAND, data, length, false));
+} /* lcd_write_chars */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function sets the DDRAM address and writes a block of characters
+//    starting at that address. The address command and the characters are
+//    sent in one transport write (the same I2C burst for the backpack).
+//
+// INPUT PARAMETERS:
+//    address - DDRAM address of the first character
+//    data    - pointer to the characters to write
+//    length  - number of characters to write
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    uint32_t - Status code indicating success or failure of the operation.
+//        0 if successful
+//        otherwise the status code of the transport write (an I2C status
+//        code for the PCF8574 backpack)
+// -----------------------------------------------------------------------------
+uint32_t lcd_write_at(uint8_t address, const char *data, uint8_t length)
+{
+  return (lcd1602_send(address | LCD_SET_DDRAM_ADDR_CMD, data, length,
+          false));
+} /* lcd_write_at */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function loads one user defined character into the CGRAM. The
+//    CGRAM address command and the 8 rows of the character are sent in one
+//    transport write (a single I2C burst for the backpack). Character
+//    codes slot and slot + 8 both display the new pattern.
+//
+//    Note: The LCD address counter is left pointing into the CGRAM. The
+//          next write to the display must set a DDRAM address first
+//          (lcd_set_ddram_addr or lcd_write_at).
+//
+// INPUT PARAMETERS:
+//    slot - CGRAM character number (0 to LCD_CGRAM_SLOTS - 1)
+//    rows - LCD_GLYPH_ROWS row patterns, top row first, bits 4-0 are the
+//           pixels from left to right
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    uint32_t - Status code indicating success or failure of the operation.
+//        0 if successful
+//        otherwise the status code of the transport write (an I2C status
+//        code for the PCF8574 backpack)
+// -----------------------------------------------------------------------------
+uint32_t lcd_set_cgram_glyph(uint8_t slot, const uint8_t rows[])
+{
+  char    pixels[LCD_GLYPH_ROWS];
+  uint8_t address = (slot & (LCD_CGRAM_SLOTS - 1)) * LCD_GLYPH_ROWS;
+
+  for (uint8_t row = 0; row < LCD_GLYPH_ROWS; row++)
+  {
+    pixels[row] = (char)(rows[row] & LCD_GLYPH_ROW_MASK);
+  } /* for */
+
+  return (lcd1602_send(address | LCD_SET_CGRAM_ADDR_CMD, pixels,
+          LCD_GLYPH_ROWS, false));
 
-  // De-assert R/W
-  status |= I2C_mstr_send1(iic_addr, g_lcd_backlight_mode | READ_ENABLE);
+} /* lcd_set_cgram_glyph */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function sends an optional instruction and a block of data bytes
+//    through the transport, waits until the LCD has executed them and
+//    updates the statistics. Nothing is sent while the display is locked
+//    by lcd1602_set_locked().
+//
+// INPUT PARAMETERS:
+//    command  - instruction to send first, or LCD_NO_COMMAND
+//    data     - pointer to the data bytes
+//    length   - number of data bytes
+//    slow_cmd - true if the instruction is clear display or return home
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    uint32_t - Status code indicating success or failure of the operation.
+//        0 if successful
+//        I2C_ERR_BUSY if the display is locked
+//        otherwise the status code of the transport write (an I2C status
+//        code for the PCF8574 backpack)
+// -----------------------------------------------------------------------------
+static uint32_t lcd1602_send(uint8_t command, const char *data,
+                uint8_t length, bool slow_cmd)
+{
+  uint32_t status;
+  uint32_t start = cycle_counter_get();
+
+  if (g_lcd_locked)
+  {
+    return (I2C_ERR_BUSY);
+  } /* if */
 
-  // Give LCD module time to complete command
-  msec_delay(IIC_TIME_DELAY_2MS);
+  status = g_lcd_transport->write(command, data, length);
+  g_lcd_transport->wait_ready(slow_cmd);
+
+  g_lcd_stats.writes++;
+  g_lcd_stats.bytes  += length + (command != LCD_NO_COMMAND);
+  g_lcd_stats.cycles += cycle_counter_get() - start;
 
   return (status);
-} /* lcd1602_write */
+
+} /* lcd1602_send */
 
 
 //-----------------------------------------------------------------------------
@@ -214,7 +460,9 @@ uint32_t lcd1602_write(uint8_t iic_addr, uint8_t data, uint8_t reg_select)
 //    the backlight mode state and sending the updated state over the I2C 
 //    interface. It ensures that the display backlight is turned off. This 
 //    function does not affect the display content or LCD controller state,
-//    only the backlight illumination
+//    only the backlight illumination. It is ignored before lcd1602_init(),
+//    by transports without a switched backlight and while the display is
+//    locked by lcd1602_set_locked().
 //
 // INPUT PARAMETERS:
 //    none
@@ -227,10 +475,12 @@ uint32_t lcd1602_write(uint8_t iic_addr, uint8_t data, uint8_t reg_select)
 // -----------------------------------------------------------------------------
 void lcd_set_backlight_off(void)
 {
-  g_lcd_backlight_mode &= ~LCD_BACKLIGHT_BIT_MASK;
-
-  (void)I2C_mstr_send1(LCD_IIC_ADDRESS, g_lcd_backlight_mode);
-  msec_delay(IIC_TIME_DELAY_1MS);
+  if (!g_lcd_locked && (g_lcd_transport != NULL) &&
+      (g_lcd_transport->set_backlight != NULL))
+  {
+    g_lcd_transport->set_backlight(false);
+    msec_delay(IIC_TIME_DELAY_1MS);
+  } /* if */
 
 } /* lcd_set_backlight_off */
 
@@ -239,7 +489,9 @@ void lcd_set_backlight_off(void)
 // DESCRIPTION:
 //    This function enables the backlight on the LCD module. It updates the 
 //    backlight mode state to turn on the backlight and sends the updated 
-//    state over the I2C interface.
+//    state over the I2C interface. It is ignored before lcd1602_init(), by
+//    transports without a switched backlight and while the display is
+//    locked by lcd1602_set_locked().
 //
 // INPUT PARAMETERS:
 //    none
@@ -252,10 +504,12 @@ void lcd_set_backlight_off(void)
 // -----------------------------------------------------------------------------
 void lcd_set_backlight_on(void)
 {
-  g_lcd_backlight_mode |= LCD_BACKLIGHT_BIT_MASK;
-
-  (void)I2C_mstr_send1(LCD_IIC_ADDRESS, g_lcd_backlight_mode);
-  msec_delay(IIC_TIME_DELAY_1MS);
+  if (!g_lcd_locked && (g_lcd_transport != NULL) &&
+      (g_lcd_transport->set_backlight != NULL))
+  {
+    g_lcd_transport->set_backlight(true);
+    msec_delay(IIC_TIME_DELAY_1MS);
+  } /* if */
 
 } /* lcd_set_backlight_on */
 
@@ -315,9 +569,10 @@ void lcd_write_char(uint8_t character)
 
 // -----------------------------------------------------------------------------
 // DESCRIPTION
-//    This function writes a string to the DDRAM on LCD module. Each character 
-//    of the string is written to the LCD one by one. This function performs
-//    no error checking to ensure the string is displayed properly on the LCD.
+//    This function writes a string to the DDRAM on LCD module. The characters
+//    of the string are packed into as few I2C bursts as possible, in blocks
+//    of up to 255 characters. This function performs no error checking to
+//    ensure the string is displayed properly on the LCD.
 //
 //    Note: No error checking is performed to verify if the string fits the
 //    display or if line wrapping is handled.
@@ -334,11 +589,17 @@ void lcd_write_char(uint8_t character)
 // -----------------------------------------------------------------------------
 void lcd_write_string(const char *string)
 {
-    // for each character in string, write it to the LCD module
-    while (*string != '\0')
-    {
-        lcd_write_char(*string++);
-    } /* while */
+  size_t  length = strlen(string);
+  uint8_t block;
+
+  // the string is packed into as few I2C bursts as possible
+  while (length > 0)
+  {
+    block = (length > UINT8_MAX) ? UINT8_MAX : (uint8_t)length;
+    (void)lcd_write_chars(string, block);
+    string += block;
+    length -= block;
+  } /* while */
 
 } /* lcd_write_string */
 
@@ -449,24 +710,7 @@ void hex_to_lcd(uint8_t hex_value)
 // -----------------------------------------------------------------------------
 void byte_to_ascii(uint8_t byte, char* string) 
 {
-  // Extract each digit of the byte and convert it to ASCII
-  for (uint8_t digit_idx = 0; (digit_idx < 3); digit_idx++) 
-  {
-    // Always convert first digit even if it is byte is 0
-    if ((byte != 0) || (digit_idx == 0))
-    {
-      // Convert digit to ASCII
-      string[2-digit_idx] = '0' + (byte % BASE_TEN);
-    
-      // Move to the next digit
-      byte /= BASE_TEN;
-    } /* if */
-    else
-    {
-      string[2-digit_idx] = ' ';
-    } /* else */
-  } /* for */
-  
+  u8_to_ascii(byte, string);
 } /* byte_to_ascii */
 
 
@@ -492,24 +736,7 @@ void byte_to_ascii(uint8_t byte, char* string)
 // -----------------------------------------------------------------------------
 void doublebyte_to_ascii(uint16_t doublebyte, char* string) 
 {
-  // Extract each digit of the double byte and convert it to ASCII
-  for (uint8_t digit_idx = 0; (digit_idx < 5); digit_idx++) 
-  {
-    // Always convert first digit even if it is doublebyte is 0
-    if ((doublebyte != 0) || (digit_idx == 0))
-    {
-      // Convert digit to ASCII
-      string[4-digit_idx] = '0' + (doublebyte % BASE_TEN);
-    
-      // Move to the next digit
-      doublebyte /= BASE_TEN;
-    } /* if */
-    else
-    {
-      string[4-digit_idx] = ' ';
-    } /* else */
-  } /* for */
-  
+  u16_to_ascii(doublebyte, string);
 } /* doublebyte_to_ascii */
 
 
@@ -535,24 +762,7 @@ void doublebyte_to_ascii(uint16_t doublebyte, char* string)
 // -----------------------------------------------------------------------------
 void quadbyte_to_ascii(uint32_t quadbyte, char* string) 
 {
-  // Extract each digit of the double byte and convert it to ASCII
-  for (uint8_t digit_idx = 0; (digit_idx < 10); digit_idx++) 
-  {
-    // Always convert first digit even if it is quadbyte is 0
-    if ((quadbyte != 0) || (digit_idx == 0))
-    {
-      // Convert digit to ASCII
-      string[9-digit_idx] = '0' + (quadbyte % BASE_TEN);
-    
-      // Move to the next digit
-      quadbyte /= BASE_TEN;
-    } /* if */
-    else
-    {
-      string[9-digit_idx] = ' ';
-    } /* else */
-  } /* for */
-  
+  u32_to_ascii(quadbyte, string);
 } /* quadbyte_to_ascii */
 
 
@@ -15,6 +15,9 @@
 //    setting the cursor, writing characters and strings, and clearing the
 //    display.
 //
+//    The LCD can be reached through the PCF8574 I2C backpack (the default)
+//    or wired straight to GPIO pins, see lcd1602_set_transport().
+//
 //    NOTE: This code assumes that the IIC address is 0x27.
 //
 //-----------------------------------------------------------------------------
@@ -46,12 +49,15 @@
 // Load standard C include files
 //-----------------------------------------------------------------------------
 #include <stdint.h>
+#include <stdbool.h>
 #include <stdio.h>
 
 //-----------------------------------------------------------------------------
 // Loads MSP launchpad board support macros and definitions
 //-----------------------------------------------------------------------------
-
+#include "lcd1602_transport.h"
+#include "lcd1602_i2c.h"
+#include "lcd1602_gpio.h"
 
 //-----------------------------------------------------------------------------
 // I2C Bus address for the LCD1602 module
@@ -65,6 +71,7 @@
 #define TOTAL_CHARACTERS_PER_LCD         (LINES_PER_LCD*CHARACTERS_PER_LCD_LINE)
 #define LCD_LINE1_ADDR                                                    (0x00)
 #define LCD_LINE2_ADDR                                                    (0x40)
+#define LCD_DDRAM_LINE_LENGTH                                               (40)
 #define BASE_TEN                                                            (10)
 
 //# Define LCD line numbers
@@ -165,14 +172,35 @@
 #define LCD1602_E_PULSE_WIDTH                                               (50)
 #define LCD1602_E_CYCLE_DELAY                                               (50)
 
+// User defined characters: 8 CGRAM slots of 8 rows, 5 pixels per row
+#define LCD_CGRAM_SLOTS                                                      (8)
+#define LCD_GLYPH_ROWS                                                       (8)
+#define LCD_GLYPH_ROW_MASK                                                (0x1F)
+
+// Define a structure to hold the transfer statistics of the protocol layer
+typedef struct
+{
+  uint32_t writes;            // transport writes (one per API call)
+  uint32_t bytes;             // instruction and data bytes sent
+  uint32_t cycles;            // bus clock cycles spent writing and waiting
+} lcd1602_stats_t;
+
 // ----------------------------------------------------------------------------
 // Prototype for support functions
 // ----------------------------------------------------------------------------
 uint32_t lcd1602_init(void);
+void lcd1602_set_transport(const lcd1602_transport_t *transport);
+const lcd1602_transport_t *lcd1602_get_transport(void);
+void lcd1602_get_stats(lcd1602_stats_t *stats);
+void lcd1602_clear_stats(void);
+void lcd1602_set_locked(bool locked);
 void lcd_clear(void);
 void lcd_set_ddram_addr(uint8_t address);
 void lcd_write_char(uint8_t character);
 void lcd_write_string(const char *string);
+uint32_t lcd_write_chars(const char *data, uint8_t length);
+uint32_t lcd_write_at(uint8_t address, const char *data, uint8_t length);
+uint32_t lcd_set_cgram_glyph(uint8_t slot, const uint8_t rows[]);
 uint32_t lcd1602_write(uint8_t iic_addr, uint8_t data, uint8_t reg_select);
 void lcd_set_backlight_on(void);
 void lcd_set_backlight_off(void);
@@ -0,0 +1,332 @@
+// *****************************************************************************
+// ***************************    C Source Code     ****************************
+// *****************************************************************************
+//   DESIGNER NAME:  Bruce Link
+//
+//         VERSION:  1.0
+//
+//       FILE NAME:  lcd1602_gpio.c
+//
+//-----------------------------------------------------------------------------
+// DESCRIPTION
+//    This file contains the LCD1602 transport for an HD44780 wired to GPIO
+//    pins. See lcd1602_gpio.h for the wiring.
+//
+//-----------------------------------------------------------------------------
+// DISCLAIMER
+//    This code was developed for educational purposes as part of the CSC202
+//    course at Monroe Community Collage and is provided "as is" without
+//    warranties of any kind, whether express, implied, or statutory.
+//
+//    The author and organization do not warrant the accuracy, completeness, or
+//    reliability of the code. The author and organization shall not be liable
+//    for any direct, indirect, incidental, special, exemplary, or consequential
+//    damages arising out of the use of or inability to use the code, even if
+//    advised of the possibility of such damages.
+//
+//    Use of this code is at your own risk, and it is recommended to validate
+//    and adapt the code for your specific application and hardware
+//    requirements.
+//
+// Copyright (c) 2026 by Bruce Link
+//    You may use, edit, run or distribute this file as long as the above
+//    copyright notice remains
+// *****************************************************************************
+//******************************************************************************
+
+//-----------------------------------------------------------------------------
+// Load standard C include files
+//-----------------------------------------------------------------------------
+#include <stdint.h>
+#include <stdbool.h>
+
+//-----------------------------------------------------------------------------
+// Loads MSP launchpad board support macros and definitions
+//-----------------------------------------------------------------------------
+#include <ti/devices/msp/msp.h>
+#include "clock.h"
+#include "lcd1602.h"
+#include "lcd1602_gpio.h"
+#include "LaunchPad.h"
+
+
+//-----------------------------------------------------------------------------
+// Define symbolic constants used by the module
+//-----------------------------------------------------------------------------
+#define LCD_GPIO_NSEC_PER_USEC                                            (1000)
+#define LCD_GPIO_USEC_PER_SECOND                                       (1000000)
+#define LCD_GPIO_NUM_PINS                                                    (6)
+
+
+//-----------------------------------------------------------------------------
+// Define function prototypes used by the module
+//-----------------------------------------------------------------------------
+static uint32_t lcd1602_gpio_init(void);
+static uint32_t lcd1602_gpio_write_nibble(uint8_t nibble);
+static uint32_t lcd1602_gpio_write(uint8_t command, const char *data,
+                uint8_t length);
+static void lcd1602_gpio_wait_ready(bool slow_cmd);
+static void lcd1602_gpio_put_nibble(uint8_t nibble, uint32_t rs_mask);
+static void lcd1602_gpio_put_byte(uint8_t data, uint32_t rs_mask);
+
+
+//-----------------------------------------------------------------------------
+// Define global variables and structures here.
+// NOTE: when possible avoid using global variables
+//-----------------------------------------------------------------------------
+
+// Port pins to set for each nibble value, built from the pin macros
+static uint32_t g_lcd_gpio_nibble[LCD_GPIO_NIBBLE_VALUES];
+
+// Bus timing in clock cycles, computed from the bus clock at init
+static uint32_t g_lcd_gpio_setup_cycles;
+static uint32_t g_lcd_gpio_pulse_cycles;
+static uint32_t g_lcd_gpio_low_cycles;
+static uint32_t g_lcd_gpio_exec_cycles;
+
+// Cycle counter value when the last byte was latched
+static uint32_t g_lcd_gpio_last_write;
+
+static const lcd1602_transport_t g_lcd_gpio_transport =
+{
+  "gpio",
+  lcd1602_gpio_init,
+  lcd1602_gpio_write_nibble,
+  lcd1602_gpio_write,
+  lcd1602_gpio_wait_ready,
+  NULL
+};
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function returns the GPIO transport, to be passed to
+//    lcd1602_set_transport().
+//
+// INPUT PARAMETERS:
+//    none
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    pointer to the transport
+// -----------------------------------------------------------------------------
+const lcd1602_transport_t *lcd1602_gpio_transport(void)
+{
+  return (&g_lcd_gpio_transport);
+} /* lcd1602_gpio_transport */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function configures the LCD pins as outputs driven low, builds
+//    the nibble to port pin table and converts the bus timing to clock
+//    cycles. The cycle counter is started to time the execution delay.
+//
+// INPUT PARAMETERS:
+//    none
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    uint32_t - Status code indicating success or failure of the operation.
+//        0 if successful
+// -----------------------------------------------------------------------------
+static uint32_t lcd1602_gpio_init(void)
+{
+  uint32_t gpio_pincm = IOMUX_PINCM_PC_CONNECTED | PINCM_GPIO_PIN_FUNC;
+  uint32_t pin_mask = LCD_GPIO_DATA_MASK | LCD_GPIO_RS_MASK | LCD_GPIO_E_MASK;
+  uint32_t cycles_per_usec = get_bus_clock_freq() / LCD_GPIO_USEC_PER_SECOND;
+  const uint32_t pin_cm[LCD_GPIO_NUM_PINS] = {
+    LCD_GPIO_RS_IOMUX, LCD_GPIO_E_IOMUX,  LCD_GPIO_D4_IOMUX,
+    LCD_GPIO_D5_IOMUX, LCD_GPIO_D6_IOMUX, LCD_GPIO_D7_IOMUX};
+
+  for (uint8_t pin_idx = 0; pin_idx < LCD_GPIO_NUM_PINS; pin_idx++)
+  {
+    IOMUX->SECCFG.PINCM[pin_cm[pin_idx]] = gpio_pincm;
+  } /* for */
+
+  LCD_GPIO_PORT->DOUTCLR31_0 = pin_mask;
+  LCD_GPIO_PORT->DOE31_0 |= pin_mask;
+
+  for (uint8_t nibble = 0; nibble < LCD_GPIO_NIBBLE_VALUES; nibble++)
+  {
+    g_lcd_gpio_nibble[nibble] = ((nibble & 0x1) ? LCD_GPIO_D4_MASK : 0) |
+                                ((nibble & 0x2) ? LCD_GPIO_D5_MASK : 0) |
+                                ((nibble & 0x4) ? LCD_GPIO_D6_MASK : 0) |
+                                ((nibble & 0x8) ? LCD_GPIO_D7_MASK : 0);
+  } /* for */
+
+  // Round the bus timing up to whole cycles, done once so no divide is
+  // needed while writing
+  g_lcd_gpio_setup_cycles = (LCD_GPIO_SETUP_NS * cycles_per_usec +
+                             LCD_GPIO_NSEC_PER_USEC - 1) /
+                            LCD_GPIO_NSEC_PER_USEC;
+  g_lcd_gpio_pulse_cycles = (LCD_GPIO_E_PULSE_NS * cycles_per_usec +
+                             LCD_GPIO_NSEC_PER_USEC - 1) /
+                            LCD_GPIO_NSEC_PER_USEC;
+  g_lcd_gpio_low_cycles   = (LCD_GPIO_E_LOW_NS * cycles_per_usec +
+                             LCD_GPIO_NSEC_PER_USEC - 1) /
+                            LCD_GPIO_NSEC_PER_USEC;
+  g_lcd_gpio_exec_cycles  = LCD_GPIO_EXEC_USEC * cycles_per_usec;
+
+  cycle_counter_init();
+  g_lcd_gpio_last_write = cycle_counter_get();
+
+  return (0);
+
+} /* lcd1602_gpio_init */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function latches a single nibble into the LCD as an instruction.
+//
+// INPUT PARAMETERS:
+//    nibble - bits 7-4 are sent, bits 3-0 are ignored
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    uint32_t - Status code indicating success or failure of the operation.
+//        0 if successful
+// -----------------------------------------------------------------------------
+static uint32_t lcd1602_gpio_write_nibble(uint8_t nibble)
+{
+  lcd1602_gpio_put_nibble(nibble >> NIBBLE_SHIFT, 0);
+  g_lcd_gpio_last_write = cycle_counter_get();
+
+  return (0);
+
+} /* lcd1602_gpio_write_nibble */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function writes an optional instruction followed by a block of
+//    characters. Before each byte it waits until the LCD has executed the
+//    previous one, so the block goes out at the rate the LCD can accept.
+//
+// INPUT PARAMETERS:
+//    command - instruction to send first, or LCD_NO_COMMAND
+//    data    - pointer to the characters to write
+//    length  - number of characters to write
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    uint32_t - Status code indicating success or failure of the operation.
+//        0 if successful
+// -----------------------------------------------------------------------------
+static uint32_t lcd1602_gpio_write(uint8_t command, const char *data,
+                uint8_t length)
+{
+  if (command != LCD_NO_COMMAND)
+  {
+    lcd1602_gpio_wait_ready(false);
+    lcd1602_gpio_put_byte(command, 0);
+  } /* if */
+
+  while (length-- > 0)
+  {
+    lcd1602_gpio_wait_ready(false);
+    lcd1602_gpio_put_byte((uint8_t)*data++, LCD_GPIO_RS_MASK);
+  } /* while */
+
+  return (0);
+
+} /* lcd1602_gpio_write */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function waits until the LCD has finished the last byte. Without
+//    a busy flag the execution time is timed: clear display and return
+//    home (slow_cmd) use the fixed 2ms delay, everything else waits until
+//    LCD_GPIO_EXEC_USEC have passed since the byte was latched.
+//
+// INPUT PARAMETERS:
+//    slow_cmd - true if the last instruction was clear display or home
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    none
+// -----------------------------------------------------------------------------
+static void lcd1602_gpio_wait_ready(bool slow_cmd)
+{
+  if (slow_cmd)
+  {
+    msec_delay(IIC_TIME_DELAY_2MS);
+    return;
+  } /* if */
+
+  while ((cycle_counter_get() - g_lcd_gpio_last_write) <
+         g_lcd_gpio_exec_cycles)
+  {
+    // wait for the LCD to execute the last byte
+  } /* while */
+
+} /* lcd1602_gpio_wait_ready */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function puts a nibble and RS on the pins and pulses E to latch
+//    them. Pins that must go low are cleared with one write and pins that
+//    must go high are set with a second write, so no pin glitches.
+//
+// INPUT PARAMETERS:
+//    nibble  - value for D7-D4 in bits 3-0
+//    rs_mask - LCD_GPIO_RS_MASK for data, 0 for an instruction
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    none
+// -----------------------------------------------------------------------------
+static void lcd1602_gpio_put_nibble(uint8_t nibble, uint32_t rs_mask)
+{
+  uint32_t set_mask = g_lcd_gpio_nibble[nibble & LOWER_NIBBLE_MASK] | rs_mask;
+
+  LCD_GPIO_PORT->DOUTCLR31_0 = (LCD_GPIO_DATA_MASK | LCD_GPIO_RS_MASK) &
+                               ~set_mask;
+  LCD_GPIO_PORT->DOUTSET31_0 = set_mask;
+  clock_delay(g_lcd_gpio_setup_cycles);
+
+  LCD_GPIO_PORT->DOUTSET31_0 = LCD_GPIO_E_MASK;
+  clock_delay(g_lcd_gpio_pulse_cycles);
+  LCD_GPIO_PORT->DOUTCLR31_0 = LCD_GPIO_E_MASK;
+  clock_delay(g_lcd_gpio_low_cycles);
+
+} /* lcd1602_gpio_put_nibble */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function sends a byte as two nibbles, upper nibble first, and
+//    records when it was latched.
+//
+// INPUT PARAMETERS:
+//    data    - the byte to send
+//    rs_mask - LCD_GPIO_RS_MASK for data, 0 for an instruction
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    none
+// -----------------------------------------------------------------------------
+static void lcd1602_gpio_put_byte(uint8_t data, uint32_t rs_mask)
+{
+  lcd1602_gpio_put_nibble(data >> NIBBLE_SHIFT, rs_mask);
+  lcd1602_gpio_put_nibble(data, rs_mask);
+  g_lcd_gpio_last_write = cycle_counter_get();
+
+} /* lcd1602_gpio_put_byte */
@@ -0,0 +1,102 @@
+// *****************************************************************************
+// ***************************    C Source Code     ****************************
+// *****************************************************************************
+//   DESIGNER NAME:  Bruce Link
+//
+//         VERSION:  1.0
+//
+//       FILE NAME:  lcd1602_gpio.h
+//
+//-----------------------------------------------------------------------------
+// DESCRIPTION
+//    This module is the LCD1602 transport for an HD44780 wired straight to
+//    GPIO pins in 4-bit mode. R/W is tied to ground (write only, no busy
+//    flag) and the backlight is not switched. The pins are on port B:
+//
+//        LCD pin    LaunchPad pin
+//        RS         PB14
+//        E          PB24
+//        D4-D7      PB0, PB5, PB10, PB11
+//
+//    The data pins and RS are changed with one DOUTCLR and one DOUTSET
+//    write, so every pin moves once and the others are not touched. The E
+//    pulse, setup and cycle times are counted in bus clock cycles and the
+//    37us execution time is taken from the cycle counter, so the next byte
+//    goes out as soon as the LCD can take it instead of after a fixed 2ms.
+//
+//    NOTE: Change the pin macros below to match the wiring. The pins must
+//          all be on LCD_GPIO_PORT.
+//
+//-----------------------------------------------------------------------------
+// DISCLAIMER
+//    This code was developed for educational purposes as part of the CSC202
+//    course at Monroe Community Collage and is provided "as is" without
+//    warranties of any kind, whether express, implied, or statutory.
+//
+//    The author and organization do not warrant the accuracy, completeness, or
+//    reliability of the code. The author and organization shall not be liable
+//    for any direct, indirect, incidental, special, exemplary, or consequential
+//    damages arising out of the use of or inability to use the code, even if
+//    advised of the possibility of such damages.
+//
+//    Use of this code is at your own risk, and it is recommended to validate
+//    and adapt the code for your specific application and hardware
+//    requirements.
+//
+// Copyright (c) 2026 by Bruce Link
+//    You may use, edit, run or distribute this file as long as the above
+//    copyright notice remains
+// *****************************************************************************
+//******************************************************************************
+
+#ifndef __LCD1602_GPIO_H__
+#define __LCD1602_GPIO_H__
+
+//-----------------------------------------------------------------------------
+// Load standard C include files
+//-----------------------------------------------------------------------------
+#include <stdint.h>
+#include <stdbool.h>
+
+//-----------------------------------------------------------------------------
+// Loads MSP launchpad board support macros and definitions
+//-----------------------------------------------------------------------------
+#include "lcd1602_transport.h"
+
+//-----------------------------------------------------------------------------
+// Define symbolic constants used by the module
+//-----------------------------------------------------------------------------
+
+// LCD pins, all on the same port
+#define LCD_GPIO_PORT                                                    (GPIOB)
+#define LCD_GPIO_RS_MASK                                              (1U << 14)
+#define LCD_GPIO_RS_IOMUX                                        (IOMUX_PINCM31)
+#define LCD_GPIO_E_MASK                                               (1U << 24)
+#define LCD_GPIO_E_IOMUX                                         (IOMUX_PINCM52)
+#define LCD_GPIO_D4_MASK                                               (1U << 0)
+#define LCD_GPIO_D4_IOMUX                                        (IOMUX_PINCM12)
+#define LCD_GPIO_D5_MASK                                               (1U << 5)
+#define LCD_GPIO_D5_IOMUX                                        (IOMUX_PINCM18)
+#define LCD_GPIO_D6_MASK                                              (1U << 10)
+#define LCD_GPIO_D6_IOMUX                                        (IOMUX_PINCM27)
+#define LCD_GPIO_D7_MASK                                              (1U << 11)
+#define LCD_GPIO_D7_IOMUX                                        (IOMUX_PINCM28)
+#define LCD_GPIO_DATA_MASK   (LCD_GPIO_D4_MASK | LCD_GPIO_D5_MASK | \
+                              LCD_GPIO_D6_MASK | LCD_GPIO_D7_MASK)
+
+// HD44780 bus timing in ns (datasheet minimums with some margin) and the
+// execution time of a fast instruction or data write in us
+#define LCD_GPIO_SETUP_NS                                                   (60)
+#define LCD_GPIO_E_PULSE_NS                                                (500)
+#define LCD_GPIO_E_LOW_NS                                                  (550)
+#define LCD_GPIO_EXEC_USEC                                                  (40)
+
+#define LCD_GPIO_NIBBLE_VALUES                                              (16)
+
+
+// ----------------------------------------------------------------------------
+// Prototype for support functions
+// ----------------------------------------------------------------------------
+const lcd1602_transport_t *lcd1602_gpio_transport(void);
+
+#endif /* __LCD1602_GPIO_H__ */
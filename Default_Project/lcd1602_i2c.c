@@ -0,0 +1,519 @@
+// *****************************************************************************
+// ***************************    C Source Code     ****************************
+// *****************************************************************************
+//   DESIGNER NAME:  Bruce Link
+//
+//         VERSION:  1.0
+//
+//       FILE NAME:  lcd1602_i2c.c
+//
+//-----------------------------------------------------------------------------
+// DESCRIPTION
+//    This file contains the LCD1602 transport for the PCF8574 I2C backpack.
+//    See lcd1602_i2c.h for the wiring of the backpack.
+//
+//-----------------------------------------------------------------------------
+// DISCLAIMER
+//    This code was developed for educational purposes as part of the CSC202
+//    course at Monroe Community Collage and is provided "as is" without
+//    warranties of any kind, whether express, implied, or statutory.
+//
+//    The author and organization do not warrant the accuracy, completeness, or
+//    reliability of the code. The author and organization shall not be liable
+//    for any direct, indirect, incidental, special, exemplary, or consequential
+//    damages arising out of the use of or inability to use the code, even if
+//    advised of the possibility of such damages.
+//
+//    Use of this code is at your own risk, and it is recommended to validate
+//    and adapt the code for your specific application and hardware
+//    requirements.
+//
+// Copyright (c) 2026 by Bruce Link
+//    You may use, edit, run or distribute this file as long as the above
+//    copyright notice remains
+// *****************************************************************************
+//******************************************************************************
+
+//-----------------------------------------------------------------------------
+// Load standard C include files
+//-----------------------------------------------------------------------------
+#include <stdint.h>
+#include <stdbool.h>
+
+//-----------------------------------------------------------------------------
+// Loads MSP launchpad board support macros and definitions
+//-----------------------------------------------------------------------------
+#include "clock.h"
+#include "lcd1602.h"
+#include "lcd1602_i2c.h"
+#include "LaunchPad.h"
+
+
+//-----------------------------------------------------------------------------
+// Define function prototypes used by the module
+//-----------------------------------------------------------------------------
+static uint32_t lcd1602_i2c_init(void);
+static uint32_t lcd1602_i2c_write_nibble(uint8_t nibble);
+static uint32_t lcd1602_i2c_write(uint8_t command, const char *data,
+                uint8_t length);
+static void lcd1602_i2c_wait_ready(bool slow_cmd);
+static void lcd1602_i2c_set_backlight(bool on);
+static void lcd1602_seq_byte(pcf8574_seq_struct *seq, uint8_t data,
+            uint8_t reg_select);
+static void lcd1602_seq_end(pcf8574_seq_struct *seq);
+static bool lcd1602_read_busy(void);
+
+
+//-----------------------------------------------------------------------------
+// Define global variables and structures here.
+// NOTE: when possible avoid using global variables
+//-----------------------------------------------------------------------------
+
+// Output shadow of the PCF8574 on the LCD module. The backlight bit of the
+// shadow tracks the status of the backlight.
+static pcf8574_struct g_lcd_port = {LCD_IIC_ADDRESS, 0, 0, 0};
+
+// Busy flag polling mode and the number of times the busy flag timed out
+static bool     g_lcd_busy_poll     = false;
+static uint32_t g_lcd_busy_timeouts = 0;
+
+static const lcd1602_transport_t g_lcd_i2c_transport =
+{
+  "i2c",
+  lcd1602_i2c_init,
+  lcd1602_i2c_write_nibble,
+  lcd1602_i2c_write,
+  lcd1602_i2c_wait_ready,
+  lcd1602_i2c_set_backlight
+};
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function returns the I2C backpack transport, to be passed to
+//    lcd1602_set_transport().
+//
+// INPUT PARAMETERS:
+//    none
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    pointer to the transport
+// -----------------------------------------------------------------------------
+const lcd1602_transport_t *lcd1602_i2c_transport(void)
+{
+  return (&g_lcd_i2c_transport);
+} /* lcd1602_i2c_transport */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function encodes an optional DDRAM address command and a block of
+//    characters into a PCF8574 sequence without sending it. It is used by
+//    code that sends the sequence itself, without blocking, such as the
+//    background LCD service. Call pcf8574_seq_complete() once the sequence
+//    has been sent.
+//
+// INPUT PARAMETERS:
+//    seq     - pointer to the sequence to fill
+//    address - DDRAM address, or LCD_NO_ADDRESS to keep the current one
+//    data    - pointer to the characters to write
+//    length  - number of characters (up to LCD_MAX_BURST_CHARS)
+//
+// OUTPUT PARAMETERS:
+//    seq     - holds the PCF8574 port states to send
+//
+// RETURN:
+//    none
+// -----------------------------------------------------------------------------
+void lcd1602_encode_run(pcf8574_seq_struct *seq, uint8_t address,
+     const char *data, uint8_t length)
+{
+  pcf8574_seq_begin(seq, &g_lcd_port);
+
+  if (address != LCD_NO_ADDRESS)
+  {
+    lcd1602_seq_byte(seq, address | LCD_SET_DDRAM_ADDR_CMD, LCD_INSTR_REG);
+  } /* if */
+
+  for (uint8_t idx = 0; (idx < length) && (idx < LCD_MAX_BURST_CHARS); idx++)
+  {
+    lcd1602_seq_byte(seq, (uint8_t)data[idx], LCD_DATA_REG);
+  } /* for */
+
+  lcd1602_seq_end(seq);
+
+} /* lcd1602_encode_run */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function encodes one LCD instruction into a PCF8574 sequence
+//    without sending it. Only use it for instructions that complete in
+//    37us (not clear display or return home), the bus time of the next
+//    transfer covers that.
+//
+// INPUT PARAMETERS:
+//    seq     - pointer to the sequence to fill
+//    command - the instruction byte
+//
+// OUTPUT PARAMETERS:
+//    seq     - holds the PCF8574 port states to send
+//
+// RETURN:
+//    none
+// -----------------------------------------------------------------------------
+void lcd1602_encode_cmd(pcf8574_seq_struct *seq, uint8_t command)
+{
+  pcf8574_seq_begin(seq, &g_lcd_port);
+  lcd1602_seq_byte(seq, command, LCD_INSTR_REG);
+  lcd1602_seq_end(seq);
+} /* lcd1602_encode_cmd */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    These functions enable or disable busy flag polling. When polling is
+//    enabled the driver reads the busy flag back through the PCF8574 after
+//    each write and continues as soon as the LCD is ready. When it is
+//    disabled (the default) a fixed 2ms delay is used, which also works
+//    with backpacks that can not read from the LCD. Clear display and
+//    return home always use the fixed delay.
+//
+// INPUT PARAMETERS:
+//    none
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    none
+// -----------------------------------------------------------------------------
+void lcd_busy_poll_enable(void)
+{
+  g_lcd_busy_poll = true;
+} /* lcd_busy_poll_enable */
+
+void lcd_busy_poll_disable(void)
+{
+  g_lcd_busy_poll = false;
+} /* lcd_busy_poll_disable */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function returns the number of times the busy flag did not clear
+//    within LCD_BUSY_POLL_MAX reads and the fixed delay was used instead. A
+//    growing count means the backpack can not read the LCD and busy flag
+//    polling should be disabled.
+//
+// INPUT PARAMETERS:
+//    none
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    number of busy flag timeouts
+// -----------------------------------------------------------------------------
+uint32_t lcd_get_busy_timeout_count(void)
+{
+  return (g_lcd_busy_timeouts);
+} /* lcd_get_busy_timeout_count */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function prepares the backpack. The I2C bus is set up by the
+//    application, so only the port shadow is reset here (all outputs low,
+//    backlight off).
+//
+// INPUT PARAMETERS:
+//    none
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    uint32_t - Status code indicating success or failure of the operation.
+//        0 if successful
+// -----------------------------------------------------------------------------
+static uint32_t lcd1602_i2c_init(void)
+{
+  return (pcf8574_init(&g_lcd_port, LCD_IIC_ADDRESS, 0, 0));
+
+} /* lcd1602_i2c_init */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function latches a single nibble into the LCD as an instruction.
+//    The nibble is put on D7-D4 with E high then E is taken low, in one
+//    I2C burst.
+//
+// INPUT PARAMETERS:
+//    nibble - bits 7-4 are sent, bits 3-0 are ignored
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    uint32_t - Status code indicating success or failure of the operation.
+//        0 if successful
+// -----------------------------------------------------------------------------
+static uint32_t lcd1602_i2c_write_nibble(uint8_t nibble)
+{
+  pcf8574_seq_struct seq;
+  uint8_t  port;
+
+  pcf8574_seq_begin(&seq, &g_lcd_port);
+  port = (nibble & UPPER_NIBBLE_MASK) | (seq.state & LCD_BACKLIGHT_BIT_MASK) |
+         WRITE_ENABLE | LCD_INSTR_REG;
+
+  (void)pcf8574_seq_put(&seq, port | LATCH_ENABLE);
+  (void)pcf8574_seq_put(&seq, port);
+
+  return (pcf8574_seq_send(&seq));
+
+} /* lcd1602_i2c_write_nibble */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function writes an optional instruction followed by a block of
+//    characters, packing as many as fit into each I2C burst. The LCD only
+//    needs 37us per character, which is covered by the four bytes (360us)
+//    the next character takes on the bus. Between bursts the LCD is given
+//    time to complete the last character, after the final burst that is
+//    left to the caller (wait_ready).
+//
+// INPUT PARAMETERS:
+//    command - instruction to send first, or LCD_NO_COMMAND
+//    data    - pointer to the characters to write
+//    length  - number of characters to write
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    uint32_t - Status code indicating success or failure of the operation.
+//        0 if successful
+// -----------------------------------------------------------------------------
+static uint32_t lcd1602_i2c_write(uint8_t command, const char *data,
+                uint8_t length)
+{
+  pcf8574_seq_struct seq;
+  uint32_t status = 0;
+  uint8_t  count;
+
+  pcf8574_seq_begin(&seq, &g_lcd_port);
+  if (command != LCD_NO_COMMAND)
+  {
+    lcd1602_seq_byte(&seq, command, LCD_INSTR_REG);
+  } /* if */
+
+  do
+  {
+    count = 0;
+    while ((length > 0) && (count < LCD_MAX_BURST_CHARS))
+    {
+      lcd1602_seq_byte(&seq, (uint8_t)*data++, LCD_DATA_REG);
+      length--;
+      count++;
+    } /* while */
+
+    lcd1602_seq_end(&seq);
+    status |= pcf8574_seq_send(&seq);
+
+    // Give LCD module time to complete the last character
+    if (length > 0)
+    {
+      lcd1602_i2c_wait_ready(false);
+    } /* if */
+
+  } while (length > 0);
+
+  return (status);
+
+} /* lcd1602_i2c_write */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function waits until the LCD has finished the last instruction.
+//    Clear display and return home (slow_cmd) and writes made while busy
+//    flag polling is disabled use the fixed 2ms delay. Otherwise the busy
+//    flag is polled and the fixed delay is only used if it does not clear.
+//
+// INPUT PARAMETERS:
+//    slow_cmd - true if the last instruction was clear display or home
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    none
+// -----------------------------------------------------------------------------
+static void lcd1602_i2c_wait_ready(bool slow_cmd)
+{
+  uint8_t polls = 0;
+
+  if (slow_cmd || !g_lcd_busy_poll)
+  {
+    msec_delay(IIC_TIME_DELAY_2MS);
+    return;
+  } /* if */
+
+  while (lcd1602_read_busy())
+  {
+    if (++polls >= LCD_BUSY_POLL_MAX)
+    {
+      g_lcd_busy_timeouts++;
+      msec_delay(IIC_TIME_DELAY_2MS);
+      break;
+    } /* if */
+  } /* while */
+
+} /* lcd1602_i2c_wait_ready */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function turns the backlight on or off by updating the backlight
+//    bit of the port shadow and sending it. The display content and the
+//    LCD controller state are not affected.
+//
+// INPUT PARAMETERS:
+//    on - true to turn the backlight on, false to turn it off
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    none
+// -----------------------------------------------------------------------------
+static void lcd1602_i2c_set_backlight(bool on)
+{
+  if (on)
+  {
+    pcf8574_set_bits(&g_lcd_port, LCD_BACKLIGHT_BIT_MASK);
+  }
+  else
+  {
+    pcf8574_clear_bits(&g_lcd_port, LCD_BACKLIGHT_BIT_MASK);
+  } /* else */
+
+  (void)pcf8574_update(&g_lcd_port);
+
+} /* lcd1602_i2c_set_backlight */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function adds the PCF8574 port states needed to write one byte to
+//    the LCD to a sequence. RS and R/W are first set with E low if they
+//    differ from the last state, then each nibble is put on D7-D4 with E
+//    high and latched by taking E low.
+//
+// INPUT PARAMETERS:
+//    seq        - pointer to the sequence
+//    data       - the byte of data to be sent to the LCD
+//    reg_select - LCD_INSTR_REG or LCD_DATA_REG
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    none
+// -----------------------------------------------------------------------------
+static void lcd1602_seq_byte(pcf8574_seq_struct *seq, uint8_t data,
+            uint8_t reg_select)
+{
+  uint8_t control = (seq->state & LCD_BACKLIGHT_BIT_MASK) | WRITE_ENABLE |
+                    reg_select;
+  uint8_t upper_nibble = (data & UPPER_NIBBLE_MASK) | control;
+  uint8_t lower_nibble = ((data & LOWER_NIBBLE_MASK) << NIBBLE_SHIFT) |
+                         control;
+
+  // RS and R/W must be stable before E goes high
+  if ((seq->state & (LCD_RS_BIT_MASK | LCD_RW_BIT_MASK)) !=
+      (WRITE_ENABLE | reg_select))
+  {
+    (void)pcf8574_seq_put(seq, upper_nibble);
+  } /* if */
+
+  (void)pcf8574_seq_put(seq, upper_nibble | LATCH_ENABLE);
+  (void)pcf8574_seq_put(seq, upper_nibble);
+  (void)pcf8574_seq_put(seq, lower_nibble | LATCH_ENABLE);
+  (void)pcf8574_seq_put(seq, lower_nibble);
+
+} /* lcd1602_seq_byte */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function ends a sequence by de-asserting R/W with E low.
+//
+// INPUT PARAMETERS:
+//    seq - pointer to the sequence
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    none
+// -----------------------------------------------------------------------------
+static void lcd1602_seq_end(pcf8574_seq_struct *seq)
+{
+  (void)pcf8574_seq_put(seq, (seq->state & LCD_BACKLIGHT_BIT_MASK) |
+                        READ_ENABLE);
+} /* lcd1602_seq_end */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function reads the busy flag of the LCD. D7-D4 of the PCF8574 are
+//    written high so the LCD can drive them, RS is set to 0 and R/W to 1.
+//    While E is high the LCD puts the busy flag on D7, which is read back
+//    with a PCF8574 read. In 4-bit mode the second nibble (low bits of the
+//    address counter) must also be clocked out with another E pulse.
+//
+// INPUT PARAMETERS:
+//    none
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    true if the LCD is busy or could not be read, false if it is ready
+// -----------------------------------------------------------------------------
+static bool lcd1602_read_busy(void)
+{
+  pcf8574_seq_struct seq;
+  uint32_t status;
+  uint8_t  port = LCD_BUSY_FLAG_MASK;
+  uint8_t  control = (g_lcd_port.pending & LCD_BACKLIGHT_BIT_MASK) |
+                     LCD_DATA_PINS_MASK | READ_ENABLE | LCD_INSTR_REG;
+
+  // Release the data pins then raise E to read the upper nibble
+  pcf8574_seq_begin(&seq, &g_lcd_port);
+  (void)pcf8574_seq_put(&seq, control);
+  (void)pcf8574_seq_put(&seq, control | LATCH_ENABLE);
+  status = pcf8574_seq_send(&seq);
+
+  if (status == I2C_SUCCESS)
+  {
+    status = pcf8574_read(&g_lcd_port, &port);
+  } /* if */
+
+  // Pulse E for the lower nibble and leave E low
+  (void)pcf8574_seq_put(&seq, control);
+  (void)pcf8574_seq_put(&seq, control | LATCH_ENABLE);
+  (void)pcf8574_seq_put(&seq, control);
+  status |= pcf8574_seq_send(&seq);
+
+  return ((status != I2C_SUCCESS) || ((port & LCD_BUSY_FLAG_MASK) != 0));
+
+} /* lcd1602_read_busy */
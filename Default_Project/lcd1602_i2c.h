@@ -0,0 +1,86 @@
+// *****************************************************************************
+// ***************************    C Source Code     ****************************
+// *****************************************************************************
+//   DESIGNER NAME:  Bruce Link
+//
+//         VERSION:  1.0
+//
+//       FILE NAME:  lcd1602_i2c.h
+//
+//-----------------------------------------------------------------------------
+// DESCRIPTION
+//    This module is the LCD1602 transport for the PCF8574 I2C backpack. The
+//    PCF8574 port is wired to the LCD as:
+//        P7-P4 = D7-D4, P3 = backlight, P2 = E, P1 = R/W, P0 = RS
+//
+//    Every E edge is a byte on the I2C bus, so a whole LCD write (RS/RW
+//    setup, E high and low for each nibble) is packed into one burst. The
+//    module also provides the sequence encoders used by the background LCD
+//    service and the marquee, and optional busy flag polling.
+//
+//    NOTE: The I2C bus must be set up with I2C_mstr_init() first.
+//
+//-----------------------------------------------------------------------------
+// DISCLAIMER
+//    This code was developed for educational purposes as part of the CSC202
+//    course at Monroe Community Collage and is provided "as is" without
+//    warranties of any kind, whether express, implied, or statutory.
+//
+//    The author and organization do not warrant the accuracy, completeness, or
+//    reliability of the code. The author and organization shall not be liable
+//    for any direct, indirect, incidental, special, exemplary, or consequential
+//    damages arising out of the use of or inability to use the code, even if
+//    advised of the possibility of such damages.
+//
+//    Use of this code is at your own risk, and it is recommended to validate
+//    and adapt the code for your specific application and hardware
+//    requirements.
+//
+// Copyright (c) 2026 by Bruce Link
+//    You may use, edit, run or distribute this file as long as the above
+//    copyright notice remains
+// *****************************************************************************
+//******************************************************************************
+
+#ifndef __LCD1602_I2C_H__
+#define __LCD1602_I2C_H__
+
+//-----------------------------------------------------------------------------
+// Load standard C include files
+//-----------------------------------------------------------------------------
+#include <stdint.h>
+#include <stdbool.h>
+
+//-----------------------------------------------------------------------------
+// Loads MSP launchpad board support macros and definitions
+//-----------------------------------------------------------------------------
+#include "pcf8574.h"
+#include "lcd1602_transport.h"
+
+//-----------------------------------------------------------------------------
+// Define symbolic constants used by the module
+//-----------------------------------------------------------------------------
+
+// Burst writes: 4 PCF8574 bytes per character plus the DDRAM address
+// command, setup and end bytes must fit in PCF8574_MAX_SEQ_LENGTH
+#define LCD_MAX_BURST_CHARS                                                 (20)
+#define LCD_NO_ADDRESS                                                    (0xFF)
+
+// Busy flag polling: BF is read on D7, give up after this many reads
+#define LCD_BUSY_FLAG_MASK                                                (0x80)
+#define LCD_DATA_PINS_MASK                                                (0xF0)
+#define LCD_BUSY_POLL_MAX                                                   (10)
+
+
+// ----------------------------------------------------------------------------
+// Prototype for support functions
+// ----------------------------------------------------------------------------
+const lcd1602_transport_t *lcd1602_i2c_transport(void);
+void lcd1602_encode_run(pcf8574_seq_struct *seq, uint8_t address,
+     const char *data, uint8_t length);
+void lcd1602_encode_cmd(pcf8574_seq_struct *seq, uint8_t command);
+void lcd_busy_poll_enable(void);
+void lcd_busy_poll_disable(void);
+uint32_t lcd_get_busy_timeout_count(void);
+
+#endif /* __LCD1602_I2C_H__ */
@@ -0,0 +1,81 @@
+// *****************************************************************************
+// ***************************    C Source Code     ****************************
+// *****************************************************************************
+//   DESIGNER NAME:  Bruce Link
+//
+//         VERSION:  1.0
+//
+//       FILE NAME:  lcd1602_transport.h
+//
+//-----------------------------------------------------------------------------
+// DESCRIPTION
+//    This file defines the interface between the HD44780 protocol layer
+//    (lcd1602.c) and the hardware that moves bytes to the LCD. The protocol
+//    layer knows the instructions, the reset sequence and the execution
+//    times. A transport only knows how to put nibbles and bytes on the LCD
+//    pins. Two transports are provided:
+//      - lcd1602_i2c  - PCF8574 I2C backpack (the default)
+//      - lcd1602_gpio - HD44780 4-bit bus wired straight to GPIO pins
+//
+//    Select one with lcd1602_set_transport() before lcd1602_init().
+//
+//-----------------------------------------------------------------------------
+// DISCLAIMER
+//    This code was developed for educational purposes as part of the CSC202
+//    course at Monroe Community Collage and is provided "as is" without
+//    warranties of any kind, whether express, implied, or statutory.
+//
+//    The author and organization do not warrant the accuracy, completeness, or
+//    reliability of the code. The author and organization shall not be liable
+//    for any direct, indirect, incidental, special, exemplary, or consequential
+//    damages arising out of the use of or inability to use the code, even if
+//    advised of the possibility of such damages.
+//
+//    Use of this code is at your own risk, and it is recommended to validate
+//    and adapt the code for your specific application and hardware
+//    requirements.
+//
+// Copyright (c) 2026 by Bruce Link
+//    You may use, edit, run or distribute this file as long as the above
+//    copyright notice remains
+// *****************************************************************************
+//******************************************************************************
+
+#ifndef __LCD1602_TRANSPORT_H__
+#define __LCD1602_TRANSPORT_H__
+
+//-----------------------------------------------------------------------------
+// Load standard C include files
+//-----------------------------------------------------------------------------
+#include <stdint.h>
+#include <stdbool.h>
+
+//-----------------------------------------------------------------------------
+// Define symbolic constants used by the module
+//-----------------------------------------------------------------------------
+
+// Passed as the command of a transport write that only sends data
+#define LCD_NO_COMMAND                                                    (0x00)
+
+// Define the functions a transport provides. All return 0 on success.
+//    init          - set up the pins or bus (the I2C bus itself is set up
+//                    by the application)
+//    write_nibble  - latch bits 7-4 of nibble with RS = 0, used for the
+//                    8-bit to 4-bit reset sequence
+//    write         - send an optional instruction (LCD_NO_COMMAND for none)
+//                    followed by length data bytes. Long blocks may be
+//                    split, the transport waits between the parts
+//    wait_ready    - return once the LCD has executed the last byte,
+//                    slow_cmd is true after clear display or return home
+//    set_backlight - turn the backlight on or off, NULL if not wired
+typedef struct
+{
+  const char *name;
+  uint32_t (*init)(void);
+  uint32_t (*write_nibble)(uint8_t nibble);
+  uint32_t (*write)(uint8_t command, const char *data, uint8_t length);
+  void     (*wait_ready)(bool slow_cmd);
+  void     (*set_backlight)(bool on);
+} lcd1602_transport_t;
+
+#endif /* __LCD1602_TRANSPORT_H__ */
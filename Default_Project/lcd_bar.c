@@ -0,0 +1,237 @@
+// *****************************************************************************
+// ***************************    C Source Code     ****************************
+// *****************************************************************************
+//   DESIGNER NAME:  Bruce Link
+//
+//         VERSION:  1.0
+//
+//       FILE NAME:  lcd_bar.c
+//
+//-----------------------------------------------------------------------------
+// DESCRIPTION
+//    This file contains the bar graph and sparkline renderer. See lcd_bar.h
+//    for details.
+//
+//-----------------------------------------------------------------------------
+// DISCLAIMER
+//    This code was developed for educational purposes as part of the CSC202
+//    course at Monroe Community Collage and is provided "as is" without
+//    warranties of any kind, whether express, implied, or statutory.
+//
+//    The author and organization do not warrant the accuracy, completeness, or
+//    reliability of the code. The author and organization shall not be liable
+//    for any direct, indirect, incidental, special, exemplary, or consequential
+//    damages arising out of the use of or inability to use the code, even if
+//    advised of the possibility of such damages.
+//
+//    Use of this code is at your own risk, and it is recommended to validate
+//    and adapt the code for your specific application and hardware
+//    requirements.
+//
+// Copyright (c) 2026 by Bruce Link
+//    You may use, edit, run or distribute this file as long as the above
+//    copyright notice remains
+// *****************************************************************************
+//******************************************************************************
+
+//-----------------------------------------------------------------------------
+// Load standard C include files
+//-----------------------------------------------------------------------------
+#include <stdint.h>
+
+//-----------------------------------------------------------------------------
+// Loads MSP launchpad board support macros and definitions
+//-----------------------------------------------------------------------------
+#include "lcd1602.h"
+#include "lcd_fb.h"
+#include "lcd_glyph.h"
+#include "lcd_bar.h"
+
+
+//-----------------------------------------------------------------------------
+// Define function prototypes used by the module
+//-----------------------------------------------------------------------------
+static char lcd_bar_hbar_char(uint8_t pixels);
+static char lcd_bar_vbar_char(uint8_t pixels);
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function draws a horizontal bar graph, filled from the left, into
+//    the frame buffer. The bar is width characters long and has a
+//    resolution of LCD_BAR_CELL_WIDTH pixels per character.
+//
+// INPUT PARAMETERS:
+//    row   - line number
+//    col   - position of the left end of the bar
+//    width - length of the bar in characters
+//    value - value to show (values above max show a full bar)
+//    max   - value of a full bar
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    none
+// -----------------------------------------------------------------------------
+void lcd_bar_draw(uint8_t row, uint8_t col, uint8_t width, uint16_t value,
+     uint16_t max)
+{
+  uint32_t pixels;
+
+  if (max == 0)
+  {
+    return;
+  } /* if */
+
+  if (value > max)
+  {
+    value = max;
+  } /* if */
+
+  pixels = ((uint32_t)value * width * LCD_BAR_CELL_WIDTH) / max;
+
+  for (uint8_t cell = 0; cell < width; cell++)
+  {
+    if (pixels >= LCD_BAR_CELL_WIDTH)
+    {
+      lcd_fb_put_char(row, col + cell, (char)LCD_BAR_FULL_CHAR);
+      pixels -= LCD_BAR_CELL_WIDTH;
+    }
+    else
+    {
+      lcd_fb_put_char(row, col + cell, lcd_bar_hbar_char((uint8_t)pixels));
+      pixels = 0;
+    } /* if */
+  } /* for */
+
+} /* lcd_bar_draw */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function draws a sparkline into the frame buffer: one character
+//    per sample, each showing a column of 0 to LCD_BAR_CELL_HEIGHT pixels,
+//    rounded to the nearest pixel.
+//
+// INPUT PARAMETERS:
+//    row     - line number
+//    col     - position of the first (oldest) sample
+//    samples - array of samples
+//    count   - number of samples to draw
+//    max     - value of a full column
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    none
+// -----------------------------------------------------------------------------
+void lcd_sparkline_draw(uint8_t row, uint8_t col, const uint16_t samples[],
+     uint8_t count, uint16_t max)
+{
+  uint32_t pixels;
+
+  if (max == 0)
+  {
+    return;
+  } /* if */
+
+  for (uint8_t idx = 0; idx < count; idx++)
+  {
+    pixels = ((uint32_t)samples[idx] * LCD_BAR_CELL_HEIGHT + (max >> 1)) / max;
+    if (pixels > LCD_BAR_CELL_HEIGHT)
+    {
+      pixels = LCD_BAR_CELL_HEIGHT;
+    } /* if */
+
+    lcd_fb_put_char(row, col + idx, lcd_bar_vbar_char((uint8_t)pixels));
+  } /* for */
+
+} /* lcd_sparkline_draw */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function returns the character for a cell of a horizontal bar
+//    with 0 to LCD_BAR_CELL_WIDTH - 1 pixels filled from the left. Partial
+//    cells use a glyph, or an empty cell if no CGRAM slot is free.
+//
+// INPUT PARAMETERS:
+//    pixels - number of filled pixel columns
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    character code of the cell
+// -----------------------------------------------------------------------------
+static char lcd_bar_hbar_char(uint8_t pixels)
+{
+  uint8_t rows[LCD_GLYPH_ROWS];
+  char    glyph;
+
+  if (pixels == 0)
+  {
+    return (LCD_BAR_EMPTY_CHAR);
+  } /* if */
+
+  // Left most pixel is bit 4
+  for (uint8_t idx = 0; idx < LCD_GLYPH_ROWS; idx++)
+  {
+    rows[idx] = LCD_GLYPH_ROW_MASK & ~(LCD_GLYPH_ROW_MASK >> pixels);
+  } /* for */
+
+  glyph = lcd_glyph_get(LCD_BAR_HBAR_ID + pixels, rows);
+
+  return ((glyph == LCD_GLYPH_NONE) ? LCD_BAR_EMPTY_CHAR : glyph);
+
+} /* lcd_bar_hbar_char */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function returns the character for a sparkline cell with 0 to
+//    LCD_BAR_CELL_HEIGHT pixels filled from the bottom. Partial cells use a
+//    glyph. If no CGRAM slot is free, low columns are shown as '_' and high
+//    columns as a full block.
+//
+// INPUT PARAMETERS:
+//    pixels - number of filled pixel rows
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    character code of the cell
+// -----------------------------------------------------------------------------
+static char lcd_bar_vbar_char(uint8_t pixels)
+{
+  uint8_t rows[LCD_GLYPH_ROWS];
+  char    glyph;
+
+  if (pixels == 0)
+  {
+    return (LCD_BAR_EMPTY_CHAR);
+  } /* if */
+
+  if (pixels >= LCD_BAR_CELL_HEIGHT)
+  {
+    return ((char)LCD_BAR_FULL_CHAR);
+  } /* if */
+
+  for (uint8_t idx = 0; idx < LCD_GLYPH_ROWS; idx++)
+  {
+    rows[idx] = (idx >= (LCD_GLYPH_ROWS - pixels)) ? LCD_GLYPH_ROW_MASK : 0;
+  } /* for */
+
+  glyph = lcd_glyph_get(LCD_BAR_VBAR_ID + pixels, rows);
+  if (glyph == LCD_GLYPH_NONE)
+  {
+    glyph = (pixels < (LCD_BAR_CELL_HEIGHT / 2)) ? LCD_BAR_LOW_CHAR :
+            (char)LCD_BAR_FULL_CHAR;
+  } /* if */
+
+  return (glyph);
+
+} /* lcd_bar_vbar_char */
@@ -0,0 +1,84 @@
+// *****************************************************************************
+// ***************************    C Source Code     ****************************
+// *****************************************************************************
+//   DESIGNER NAME:  Bruce Link
+//
+//         VERSION:  1.0
+//
+//       FILE NAME:  lcd_bar.h
+//
+//-----------------------------------------------------------------------------
+// DESCRIPTION
+//    This module draws bar graphs and sparklines into the LCD frame buffer
+//    (lcd_fb). The partial blocks are user defined characters that are
+//    built when they are first needed and cached by lcd_glyph:
+//      - a horizontal bar has a resolution of 5 pixels per character and
+//        uses at most one partial block glyph (4 possible)
+//      - a sparkline shows one sample per character as a column of 0 to 8
+//        pixels and uses up to 7 partial block glyphs
+//
+//    Call lcd_glyph_begin_frame() before drawing each frame, then
+//    lcd_fb_flush().
+//
+//-----------------------------------------------------------------------------
+// DISCLAIMER
+//    This code was developed for educational purposes as part of the CSC202
+//    course at Monroe Community Collage and is provided "as is" without
+//    warranties of any kind, whether express, implied, or statutory.
+//
+//    The author and organization do not warrant the accuracy, completeness, or
+//    reliability of the code. The author and organization shall not be liable
+//    for any direct, indirect, incidental, special, exemplary, or consequential
+//    damages arising out of the use of or inability to use the code, even if
+//    advised of the possibility of such damages.
+//
+//    Use of this code is at your own risk, and it is recommended to validate
+//    and adapt the code for your specific application and hardware
+//    requirements.
+//
+// Copyright (c) 2026 by Bruce Link
+//    You may use, edit, run or distribute this file as long as the above
+//    copyright notice remains
+// *****************************************************************************
+//******************************************************************************
+
+#ifndef __LCD_BAR_H__
+#define __LCD_BAR_H__
+
+//-----------------------------------------------------------------------------
+// Load standard C include files
+//-----------------------------------------------------------------------------
+#include <stdint.h>
+
+//-----------------------------------------------------------------------------
+// Loads MSP launchpad board support macros and definitions
+//-----------------------------------------------------------------------------
+#include "lcd_glyph.h"
+
+//-----------------------------------------------------------------------------
+// Define symbolic constants used by the module
+//-----------------------------------------------------------------------------
+
+// Pixels per character cell
+#define LCD_BAR_CELL_WIDTH                                                   (5)
+#define LCD_BAR_CELL_HEIGHT                                                  (8)
+
+// HD44780 ROM (A00) characters used for empty, full and low cells
+#define LCD_BAR_EMPTY_CHAR                                                 (' ')
+#define LCD_BAR_FULL_CHAR                                                 (0xFF)
+#define LCD_BAR_LOW_CHAR                                                   ('_')
+
+// Glyph ids of the partial blocks (in the lcd_glyph reserved range)
+#define LCD_BAR_HBAR_ID                                  (LCD_GLYPH_ID_RESERVED)
+#define LCD_BAR_VBAR_ID                           (LCD_GLYPH_ID_RESERVED + 0x10)
+
+
+// ----------------------------------------------------------------------------
+// Prototype for support functions
+// ----------------------------------------------------------------------------
+void lcd_bar_draw(uint8_t row, uint8_t col, uint8_t width, uint16_t value,
+     uint16_t max);
+void lcd_sparkline_draw(uint8_t row, uint8_t col, const uint16_t samples[],
+     uint8_t count, uint16_t max);
+
+#endif /* __LCD_BAR_H__ */
@@ -0,0 +1,351 @@
+// *****************************************************************************
+// ***************************    C Source Code     ****************************
+// *****************************************************************************
+//   DESIGNER NAME:  Bruce Link
+//
+//         VERSION:  1.0
+//
+//       FILE NAME:  lcd_bench.c
+//
+//-----------------------------------------------------------------------------
+// DESCRIPTION
+//    This file contains the LCD1602 benchmark. See lcd_bench.h for the
+//    report format.
+//
+//-----------------------------------------------------------------------------
+// DISCLAIMER
+//    This code was developed for educational purposes as part of the CSC202
+//    course at Monroe Community Collage and is provided "as is" without
+//    warranties of any kind, whether express, implied, or statutory.
+//
+//    The author and organization do not warrant the accuracy, completeness, or
+//    reliability of the code. The author and organization shall not be liable
+//    for any direct, indirect, incidental, special, exemplary, or consequential
+//    damages arising out of the use of or inability to use the code, even if
+//    advised of the possibility of such damages.
+//
+//    Use of this code is at your own risk, and it is recommended to validate
+//    and adapt the code for your specific application and hardware
+//    requirements.
+//
+// Copyright (c) 2026 by Bruce Link
+//    You may use, edit, run or distribute this file as long as the above
+//    copyright notice remains
+// *****************************************************************************
+//******************************************************************************
+
+//-----------------------------------------------------------------------------
+// Load standard C include files
+//-----------------------------------------------------------------------------
+#include <stdint.h>
+#include <stdbool.h>
+
+//-----------------------------------------------------------------------------
+// Loads MSP launchpad board support macros and definitions
+//-----------------------------------------------------------------------------
+#include "clock.h"
+#include "lcd1602.h"
+#include "lcd_bench.h"
+#include "lcd_fb.h"
+#include "lcd_glyph.h"
+#include "num_ascii.h"
+#include "uart.h"
+
+
+//-----------------------------------------------------------------------------
+// Define function prototypes used by the module
+//-----------------------------------------------------------------------------
+static uint8_t lcd_bench_init(uint16_t run);
+static uint8_t lcd_bench_clear(uint16_t run);
+static uint8_t lcd_bench_set_addr(uint16_t run);
+static uint8_t lcd_bench_write_char(uint16_t run);
+static uint8_t lcd_bench_write_string(uint16_t run);
+static uint8_t lcd_bench_full_screen(uint16_t run);
+static uint8_t lcd_bench_fb_full(uint16_t run);
+static uint8_t lcd_bench_fb_one(uint16_t run);
+static uint8_t lcd_bench_glyph(uint16_t run);
+static void lcd_bench_out_string(const char *string);
+static void lcd_bench_out_u32(uint32_t value);
+
+
+//-----------------------------------------------------------------------------
+// Define global variables and structures here.
+// NOTE: when possible avoid using global variables
+//-----------------------------------------------------------------------------
+
+// Define a structure to hold one benchmark test. The test function does
+// one call of the API and returns the number of characters it wrote.
+typedef struct
+{
+  const char *name;
+  uint8_t   (*test)(uint16_t run);
+  uint16_t    runs;
+} lcd_bench_test_t;
+
+static const lcd_bench_test_t g_lcd_bench_tests[LCD_BENCH_NUM_TESTS] =
+{
+  {"init",           lcd_bench_init,         LCD_BENCH_INIT_RUNS},
+  {"clear",          lcd_bench_clear,        LCD_BENCH_RUNS},
+  {"set_ddram_addr", lcd_bench_set_addr,     LCD_BENCH_RUNS},
+  {"write_char",     lcd_bench_write_char,   LCD_BENCH_RUNS},
+  {"write_string",   lcd_bench_write_string, LCD_BENCH_RUNS},
+  {"full_screen",    lcd_bench_full_screen,  LCD_BENCH_RUNS},
+  {"fb_flush_all",   lcd_bench_fb_full,      LCD_BENCH_RUNS},
+  {"fb_flush_one",   lcd_bench_fb_one,       LCD_BENCH_RUNS},
+  {"cgram_glyph",    lcd_bench_glyph,        LCD_BENCH_RUNS}
+};
+
+// Two lines of text, odd runs use the second one so every write changes
+// the display
+static const char g_lcd_bench_text[2][CHARACTERS_PER_LCD_LINE + 1] =
+{
+  "0123456789ABCDEF",
+  "abcdefghijklmnop"
+};
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function calls each LCD API the number of times given in the
+//    test table and records the time of every call with the cycle counter.
+//    lcd1602_init() is the first test, so the LCD does not need to be set
+//    up, but the transport and its bus must be. The lcd_glyph cache is
+//    emptied afterwards since the CGRAM no longer matches it.
+//
+// INPUT PARAMETERS:
+//    none
+//
+// OUTPUT PARAMETERS:
+//    results - timing of each API, LCD_BENCH_NUM_TESTS entries
+//
+// RETURN:
+//    number of entries written to results
+// -----------------------------------------------------------------------------
+uint8_t lcd_bench_run(lcd_bench_result_t results[])
+{
+  uint32_t start;
+  uint32_t cycles;
+
+  cycle_counter_init();
+
+  for (uint8_t test_idx = 0; test_idx < LCD_BENCH_NUM_TESTS; test_idx++)
+  {
+    results[test_idx].name         = g_lcd_bench_tests[test_idx].name;
+    results[test_idx].runs         = g_lcd_bench_tests[test_idx].runs;
+    results[test_idx].chars        = 0;
+    results[test_idx].total_cycles = 0;
+    results[test_idx].max_cycles   = 0;
+
+    for (uint16_t run = 0; run < g_lcd_bench_tests[test_idx].runs; run++)
+    {
+      start = cycle_counter_get();
+      results[test_idx].chars += g_lcd_bench_tests[test_idx].test(run);
+      cycles = cycle_counter_get() - start;
+
+      results[test_idx].total_cycles += cycles;
+      if (cycles > results[test_idx].max_cycles)
+      {
+        results[test_idx].max_cycles = cycles;
+      } /* if */
+    } /* for */
+  } /* for */
+
+  // The glyph test wrote CGRAM slot 0 behind the glyph cache
+  lcd_glyph_init();
+
+  return (LCD_BENCH_NUM_TESTS);
+
+} /* lcd_bench_run */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function sends the benchmark results over the UART as CSV, a
+//    header line followed by one line per API. The UART must be set up
+//    with UART_init().
+//
+// INPUT PARAMETERS:
+//    results - timing of each API from lcd_bench_run()
+//    count   - number of entries in results
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    none
+// -----------------------------------------------------------------------------
+void lcd_bench_print_csv(const lcd_bench_result_t results[], uint8_t count)
+{
+  const lcd1602_transport_t *transport = lcd1602_get_transport();
+  uint64_t chars_per_sec;
+
+  lcd_bench_out_string("transport,api,runs,chars,avg_us,max_us,"
+                       "chars_per_sec\r\n");
+
+  for (uint8_t test_idx = 0; test_idx < count; test_idx++)
+  {
+    chars_per_sec = 0;
+    if (results[test_idx].total_cycles != 0)
+    {
+      chars_per_sec = ((uint64_t)results[test_idx].chars *
+                       get_bus_clock_freq()) / results[test_idx].total_cycles;
+    } /* if */
+
+    lcd_bench_out_string((transport != NULL) ? transport->name : "none");
+    UART_out_char(',');
+    lcd_bench_out_string(results[test_idx].name);
+    UART_out_char(',');
+    lcd_bench_out_u32(results[test_idx].runs);
+    UART_out_char(',');
+    lcd_bench_out_u32(results[test_idx].chars);
+    UART_out_char(',');
+    lcd_bench_out_u32(cycles_to_usec(results[test_idx].total_cycles /
+                                     results[test_idx].runs));
+    UART_out_char(',');
+    lcd_bench_out_u32(cycles_to_usec(results[test_idx].max_cycles));
+    UART_out_char(',');
+    lcd_bench_out_u32((uint32_t)chars_per_sec);
+    lcd_bench_out_string("\r\n");
+  } /* for */
+
+} /* lcd_bench_print_csv */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    These functions are the benchmark tests. Each one makes a single call
+//    to the API it measures (a full screen is two line writes, the flush
+//    tests include the frame buffer updates) and returns the number of
+//    characters written. Any set up needed by a test is done in its first
+//    run, which is then included in the timing.
+//
+// INPUT PARAMETERS:
+//    run - number of the run, from 0
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    number of characters written to the LCD
+// -----------------------------------------------------------------------------
+static uint8_t lcd_bench_init(uint16_t run)
+{
+  (void)run;
+  (void)lcd1602_init();
+  return (0);
+} /* lcd_bench_init */
+
+static uint8_t lcd_bench_clear(uint16_t run)
+{
+  (void)run;
+  lcd_clear();
+  return (0);
+} /* lcd_bench_clear */
+
+static uint8_t lcd_bench_set_addr(uint16_t run)
+{
+  lcd_set_ddram_addr((run & 1) ? LCD_LINE2_ADDR : LCD_LINE1_ADDR);
+  return (0);
+} /* lcd_bench_set_addr */
+
+static uint8_t lcd_bench_write_char(uint16_t run)
+{
+  lcd_write_char((uint8_t)g_lcd_bench_text[0][run & LOWER_NIBBLE_MASK]);
+  return (1);
+} /* lcd_bench_write_char */
+
+static uint8_t lcd_bench_write_string(uint16_t run)
+{
+  lcd_set_ddram_addr(LCD_LINE1_ADDR);
+  lcd_write_string(g_lcd_bench_text[run & 1]);
+  return (CHARACTERS_PER_LCD_LINE);
+} /* lcd_bench_write_string */
+
+static uint8_t lcd_bench_full_screen(uint16_t run)
+{
+  (void)lcd_write_at(LCD_LINE1_ADDR, g_lcd_bench_text[run & 1],
+                     CHARACTERS_PER_LCD_LINE);
+  (void)lcd_write_at(LCD_LINE2_ADDR, g_lcd_bench_text[(run + 1) & 1],
+                     CHARACTERS_PER_LCD_LINE);
+  return (TOTAL_CHARACTERS_PER_LCD);
+} /* lcd_bench_full_screen */
+
+static uint8_t lcd_bench_fb_full(uint16_t run)
+{
+  uint8_t sent;
+
+  if (run == 0)
+  {
+    lcd_fb_init();
+  } /* if */
+
+  lcd_fb_put_string(LCD_LINE_NUM_1, 0, g_lcd_bench_text[run & 1]);
+  lcd_fb_put_string(LCD_LINE_NUM_2, 0, g_lcd_bench_text[(run + 1) & 1]);
+  lcd_fb_invalidate();
+  (void)lcd_fb_flush(&sent);
+  return (sent);
+} /* lcd_bench_fb_full */
+
+static uint8_t lcd_bench_fb_one(uint16_t run)
+{
+  uint8_t sent;
+
+  lcd_fb_put_char(LCD_LINE_NUM_2, CHARACTERS_PER_LCD_LINE - 1,
+                  g_lcd_bench_text[0][run & LOWER_NIBBLE_MASK]);
+  (void)lcd_fb_flush(&sent);
+  return (sent);
+} /* lcd_bench_fb_one */
+
+static uint8_t lcd_bench_glyph(uint16_t run)
+{
+  uint8_t rows[LCD_GLYPH_ROWS];
+
+  for (uint8_t row = 0; row < LCD_GLYPH_ROWS; row++)
+  {
+    rows[row] = (uint8_t)(run + row);
+  } /* for */
+
+  // The glyph write leaves the address counter in the CGRAM
+  lcd_fb_forget_address();
+  (void)lcd_set_cgram_glyph(0, rows);
+  return (LCD_GLYPH_ROWS);
+} /* lcd_bench_glyph */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    These functions send a string or an unsigned number (without leading
+//    spaces) over the UART.
+//
+// INPUT PARAMETERS:
+//    string - NULL terminated string to send
+//    value  - number to send
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    none
+// -----------------------------------------------------------------------------
+static void lcd_bench_out_string(const char *string)
+{
+  while (*string != '\0')
+  {
+    UART_out_char(*string++);
+  } /* while */
+} /* lcd_bench_out_string */
+
+static void lcd_bench_out_u32(uint32_t value)
+{
+  char  digits[NUM_ASCII_U32_WIDTH + 1];
+  char *first = digits;
+
+  u32_to_ascii(value, digits);
+  while (*first == ' ')
+  {
+    first++;
+  } /* while */
+
+  lcd_bench_out_string(first);
+
+} /* lcd_bench_out_u32 */
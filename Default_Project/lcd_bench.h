@@ -0,0 +1,93 @@
+// *****************************************************************************
+// ***************************    C Source Code     ****************************
+// *****************************************************************************
+//   DESIGNER NAME:  Bruce Link
+//
+//         VERSION:  1.0
+//
+//       FILE NAME:  lcd_bench.h
+//
+//-----------------------------------------------------------------------------
+// DESCRIPTION
+//    This module times the LCD1602 API against the cycle counter (TIMG12)
+//    and reports the results over the UART as CSV, one line per API:
+//
+//      transport,api,runs,chars,avg_us,max_us,chars_per_sec
+//      i2c,init,3,0,112345,112400,0
+//      i2c,write_string,10,160,4012,4015,3988
+//
+//    avg_us and max_us are per call, max_us is the worst-case latency seen.
+//    chars is the total number of characters written by all runs and
+//    chars_per_sec the rate they were written at (0 for commands).
+//
+//    Typical use, with the transport to measure selected:
+//
+//      UART_init(115200);
+//      I2C_mstr_init();                  // not needed for the GPIO transport
+//      count = lcd_bench_run(results);
+//      lcd_bench_print_csv(results, count);
+//
+//    NOTE: The benchmark calls lcd1602_init() and overwrites the display
+//          and CGRAM slot 0, and empties the lcd_glyph cache so glyphs are
+//          reloaded when next used. Do not run it while the background LCD
+//          service is running.
+//
+//-----------------------------------------------------------------------------
+// DISCLAIMER
+//    This code was developed for educational purposes as part of the CSC202
+//    course at Monroe Community Collage and is provided "as is" without
+//    warranties of any kind, whether express, implied, or statutory.
+//
+//    The author and organization do not warrant the accuracy, completeness, or
+//    reliability of the code. The author and organization shall not be liable
+//    for any direct, indirect, incidental, special, exemplary, or consequential
+//    damages arising out of the use of or inability to use the code, even if
+//    advised of the possibility of such damages.
+//
+//    Use of this code is at your own risk, and it is recommended to validate
+//    and adapt the code for your specific application and hardware
+//    requirements.
+//
+// Copyright (c) 2026 by Bruce Link
+//    You may use, edit, run or distribute this file as long as the above
+//    copyright notice remains
+// *****************************************************************************
+//******************************************************************************
+
+#ifndef __LCD_BENCH_H__
+#define __LCD_BENCH_H__
+
+//-----------------------------------------------------------------------------
+// Load standard C include files
+//-----------------------------------------------------------------------------
+#include <stdint.h>
+
+//-----------------------------------------------------------------------------
+// Define symbolic constants used by the module
+//-----------------------------------------------------------------------------
+
+// Number of APIs timed by lcd_bench_run, size the results array with it
+#define LCD_BENCH_NUM_TESTS                                                  (9)
+
+// Number of times each API is called (lcd1602_init is slow, run it less)
+#define LCD_BENCH_RUNS                                                      (10)
+#define LCD_BENCH_INIT_RUNS                                                  (3)
+
+// Define a structure to hold the timing of one API
+typedef struct
+{
+  const char *name;           // API name used in the CSV
+  uint16_t    runs;           // number of calls timed
+  uint32_t    chars;          // characters written by all calls
+  uint32_t    total_cycles;   // bus clock cycles of all calls
+  uint32_t    max_cycles;     // bus clock cycles of the slowest call
+} lcd_bench_result_t;
+
+
+// ----------------------------------------------------------------------------
+// Prototype for support functions
+// ----------------------------------------------------------------------------
+uint8_t lcd_bench_run(lcd_bench_result_t results[]);
+void lcd_bench_print_csv(const lcd_bench_result_t results[], uint8_t count);
+
+#endif /* __LCD_BENCH_H__ */
@@ -0,0 +1,493 @@
+// *****************************************************************************
+// ***************************    C Source Code     ****************************
+// *****************************************************************************
+//   DESIGNER NAME:  Bruce Link
+//
+//         VERSION:  1.0
+//
+//       FILE NAME:  lcd_fb.c
+//
+//-----------------------------------------------------------------------------
+// DESCRIPTION
+//    This file contains the LCD1602 frame buffer. Two copies of the display
+//    are kept in RAM:
+//      - g_lcd_fb    what the application wants on the display
+//      - g_lcd_glass what is known to be on the display
+//    A flush walks each line, groups changed characters into runs and
+//    sends each run with at most one DDRAM address command.
+//
+//-----------------------------------------------------------------------------
+// DISCLAIMER
+//    This code was developed for educational purposes as part of the CSC202
+//    course at Monroe Community Collage and is provided "as is" without
+//    warranties of any kind, whether express, implied, or statutory.
+//
+//    The author and organization do not warrant the accuracy, completeness, or
+//    reliability of the code. The author and organization shall not be liable
+//    for any direct, indirect, incidental, special, exemplary, or consequential
+//    damages arising out of the use of or inability to use the code, even if
+//    advised of the possibility of such damages.
+//
+//    Use of this code is at your own risk, and it is recommended to validate
+//    and adapt the code for your specific application and hardware
+//    requirements.
+//
+// Copyright (c) 2026 by Bruce Link
+//    You may use, edit, run or distribute this file as long as the above
+//    copyright notice remains
+// *****************************************************************************
+//******************************************************************************
+
+//-----------------------------------------------------------------------------
+// Load standard C include files
+//-----------------------------------------------------------------------------
+#include <stdint.h>
+#include <string.h>
+
+//-----------------------------------------------------------------------------
+// Loads MSP launchpad board support macros and definitions
+//-----------------------------------------------------------------------------
+#include "lcd1602.h"
+#include "lcd_fb.h"
+
+
+//-----------------------------------------------------------------------------
+// Define symbolic constants used by the module
+//-----------------------------------------------------------------------------
+#define LCD_FB_ADDR_UNKNOWN                                               (0xFF)
+
+
+//-----------------------------------------------------------------------------
+// Define global variables and structures here.
+// NOTE: when possible avoid using global variables
+//-----------------------------------------------------------------------------
+static char    g_lcd_fb[LINES_PER_LCD][CHARACTERS_PER_LCD_LINE];
+static char    g_lcd_glass[LINES_PER_LCD][CHARACTERS_PER_LCD_LINE];
+static bool    g_lcd_glass_valid = false;
+static uint8_t g_lcd_fb_addr     = LCD_FB_ADDR_UNKNOWN;
+
+static const uint8_t g_lcd_line_addr[LINES_PER_LCD] = {
+        LCD_LINE1_ADDR, LCD_LINE2_ADDR
+};
+
+
+//-----------------------------------------------------------------------------
+// Define function prototypes used by the module
+//-----------------------------------------------------------------------------
+static bool lcd_fb_cell_dirty(uint8_t row, uint8_t col);
+static uint32_t lcd_fb_send_run(uint8_t row, uint8_t start, uint8_t end);
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function clears the LCD and the frame buffer. After this call the
+//    contents of the display are known, so the first flush only sends the
+//    characters that were written to the frame buffer. The LCD must have
+//    been initialized with lcd1602_init().
+//
+// INPUT PARAMETERS:
+//    none
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    none
+// -----------------------------------------------------------------------------
+void lcd_fb_init(void)
+{
+  memset(g_lcd_fb, ' ', sizeof(g_lcd_fb));
+  memset(g_lcd_glass, ' ', sizeof(g_lcd_glass));
+
+  // Clear display also sets the DDRAM address to 0
+  lcd_clear();
+  g_lcd_glass_valid = true;
+  g_lcd_fb_addr     = LCD_LINE1_ADDR;
+
+} /* lcd_fb_init */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function fills the frame buffer with spaces. The display is not
+//    changed until the next flush.
+//
+// INPUT PARAMETERS:
+//    none
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    none
+// -----------------------------------------------------------------------------
+void lcd_fb_clear(void)
+{
+  memset(g_lcd_fb, ' ', sizeof(g_lcd_fb));
+} /* lcd_fb_clear */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function writes one character into the frame buffer. Positions
+//    outside of the display are ignored.
+//
+// INPUT PARAMETERS:
+//    row       - line number (LCD_LINE_NUM_1 or LCD_LINE_NUM_2)
+//    col       - character position (0 to CHARACTERS_PER_LCD_LINE - 1)
+//    character - character to write
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    none
+// -----------------------------------------------------------------------------
+void lcd_fb_put_char(uint8_t row, uint8_t col, char character)
+{
+  if ((row < LINES_PER_LCD) && (col < CHARACTERS_PER_LCD_LINE))
+  {
+    g_lcd_fb[row][col] = character;
+  } /* if */
+
+} /* lcd_fb_put_char */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function writes a string into the frame buffer starting at the
+//    given position. Characters past the end of the line are dropped.
+//
+// INPUT PARAMETERS:
+//    row    - line number (LCD_LINE_NUM_1 or LCD_LINE_NUM_2)
+//    col    - character position of the first character
+//    string - null-terminated string to write
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    none
+// -----------------------------------------------------------------------------
+void lcd_fb_put_string(uint8_t row, uint8_t col, const char *string)
+{
+  if (row >= LINES_PER_LCD)
+  {
+    return;
+  } /* if */
+
+  while ((*string != '\0') && (col < CHARACTERS_PER_LCD_LINE))
+  {
+    g_lcd_fb[row][col++] = *string++;
+  } /* while */
+
+} /* lcd_fb_put_string */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function returns a character from the frame buffer.
+//
+// INPUT PARAMETERS:
+//    row - line number (LCD_LINE_NUM_1 or LCD_LINE_NUM_2)
+//    col - character position (0 to CHARACTERS_PER_LCD_LINE - 1)
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    the character, or a space if the position is outside of the display
+// -----------------------------------------------------------------------------
+char lcd_fb_get_char(uint8_t row, uint8_t col)
+{
+  char character = ' ';
+
+  if ((row < LINES_PER_LCD) && (col < CHARACTERS_PER_LCD_LINE))
+  {
+    character = g_lcd_fb[row][col];
+  } /* if */
+
+  return (character);
+
+} /* lcd_fb_get_char */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function copies the whole frame buffer, line 1 first, into an
+//    array of TOTAL_CHARACTERS_PER_LCD characters.
+//
+// INPUT PARAMETERS:
+//    none
+//
+// OUTPUT PARAMETERS:
+//    frame - array that receives the frame buffer
+//
+// RETURN:
+//    none
+// -----------------------------------------------------------------------------
+void lcd_fb_copy(char frame[])
+{
+  memcpy(frame, g_lcd_fb, sizeof(g_lcd_fb));
+} /* lcd_fb_copy */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function returns the CGRAM slots that are in use by the frame
+//    buffer or, when it is known, by the display. Slot n is in use if
+//    character code n or 8 + n (the same CGRAM on the HD44780) is found.
+//    Reloading a slot that is in use changes every cell that shows it.
+//
+// INPUT PARAMETERS:
+//    none
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    bit mask with bit n set if CGRAM slot n is in use
+// -----------------------------------------------------------------------------
+uint8_t lcd_fb_cgram_in_use(void)
+{
+  uint8_t in_use = 0;
+  uint8_t code;
+
+  for (uint8_t row = 0; row < LINES_PER_LCD; row++)
+  {
+    for (uint8_t col = 0; col < CHARACTERS_PER_LCD_LINE; col++)
+    {
+      code = (uint8_t)g_lcd_fb[row][col];
+      if (code < (2 * LCD_CGRAM_SLOTS))
+      {
+        in_use |= (uint8_t)(1U << (code % LCD_CGRAM_SLOTS));
+      } /* if */
+
+      code = (uint8_t)g_lcd_glass[row][col];
+      if (g_lcd_glass_valid && (code < (2 * LCD_CGRAM_SLOTS)))
+      {
+        in_use |= (uint8_t)(1U << (code % LCD_CGRAM_SLOTS));
+      } /* if */
+    } /* for */
+  } /* for */
+
+  return (in_use);
+
+} /* lcd_fb_cgram_in_use */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function forgets what is on the display, so the next flush sends
+//    every character. Use it after writing to the LCD without the frame
+//    buffer or after the LCD has been reset.
+//
+// INPUT PARAMETERS:
+//    none
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    none
+// -----------------------------------------------------------------------------
+void lcd_fb_invalidate(void)
+{
+  g_lcd_glass_valid = false;
+  g_lcd_fb_addr     = LCD_FB_ADDR_UNKNOWN;
+} /* lcd_fb_invalidate */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function forgets the LCD address counter but keeps the record of
+//    what is on the display, so the next flush sends a DDRAM address before
+//    its first run. Use it after a CGRAM write.
+//
+// INPUT PARAMETERS:
+//    none
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    none
+// -----------------------------------------------------------------------------
+void lcd_fb_forget_address(void)
+{
+  g_lcd_fb_addr = LCD_FB_ADDR_UNKNOWN;
+} /* lcd_fb_forget_address */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function returns true if a flush would send anything.
+//
+// INPUT PARAMETERS:
+//    none
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    true if the frame buffer differs from the display, false otherwise
+// -----------------------------------------------------------------------------
+bool lcd_fb_is_dirty(void)
+{
+  return (!g_lcd_glass_valid ||
+          (memcmp(g_lcd_fb, g_lcd_glass, sizeof(g_lcd_fb)) != 0));
+} /* lcd_fb_is_dirty */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function sends the changed characters of the frame buffer to the
+//    LCD. Each line is scanned for changed characters. A run starts at a
+//    changed character and is extended over gaps of up to
+//    LCD_FB_MAX_REWRITE_GAP unchanged characters. Each run is sent with one
+//    DDRAM address command, which is skipped when the LCD address counter
+//    already points at the start of the run.
+//
+//    The flush stops at the first run that fails. The characters already
+//    sent stay recorded as being on the display, the failed run stays
+//    dirty and the next flush sends it again.
+//
+// INPUT PARAMETERS:
+//    none
+//
+// OUTPUT PARAMETERS:
+//    sent - number of characters written to the LCD (may be NULL)
+//
+// RETURN:
+//    0 if successful, otherwise the status code of the failed LCD write
+// -----------------------------------------------------------------------------
+uint32_t lcd_fb_flush(uint8_t *sent)
+{
+  uint32_t status = 0;
+  uint8_t  count  = 0;
+  uint8_t  start;
+  uint8_t  end;
+  uint8_t  gap;
+  uint8_t  col;
+
+  for (uint8_t row = 0; (row < LINES_PER_LCD) && (status == 0); row++)
+  {
+    col = 0;
+    while ((col < CHARACTERS_PER_LCD_LINE) && (status == 0))
+    {
+      if (!lcd_fb_cell_dirty(row, col))
+      {
+        col++;
+        continue;
+      } /* if */
+
+      // Extend the run while the gaps are cheaper to rewrite than to skip
+      start = col;
+      end   = col;
+      gap   = 0;
+      for (col = start + 1; col < CHARACTERS_PER_LCD_LINE; col++)
+      {
+        if (lcd_fb_cell_dirty(row, col))
+        {
+          end = col;
+          gap = 0;
+        }
+        else if (++gap > LCD_FB_MAX_REWRITE_GAP)
+        {
+          break;
+        } /* if */
+      } /* for */
+
+      status = lcd_fb_send_run(row, start, end);
+      if (status == 0)
+      {
+        count += end - start + 1;
+      } /* if */
+      col = end + 1;
+    } /* while */
+  } /* for */
+
+  // Only a complete flush makes the whole glass copy trustworthy
+  if (status == 0)
+  {
+    g_lcd_glass_valid = true;
+  } /* if */
+
+  if (sent != NULL)
+  {
+    *sent = count;
+  } /* if */
+
+  return (status);
+
+} /* lcd_fb_flush */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function returns true if a character has to be sent to the LCD.
+//
+// INPUT PARAMETERS:
+//    row - line number
+//    col - character position
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    true if the character on the display is unknown or different
+// -----------------------------------------------------------------------------
+static bool lcd_fb_cell_dirty(uint8_t row, uint8_t col)
+{
+  return (!g_lcd_glass_valid || (g_lcd_fb[row][col] != g_lcd_glass[row][col]));
+} /* lcd_fb_cell_dirty */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function writes a run of characters from the frame buffer to the
+//    LCD. Only when the write succeeds are the characters recorded as being
+//    on the display. After a failed write the LCD address counter is no
+//    longer known, so the next run starts with an address command.
+//
+// INPUT PARAMETERS:
+//    row   - line number
+//    start - position of the first character of the run
+//    end   - position of the last character of the run
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    0 if successful, otherwise the status code of the LCD write
+// -----------------------------------------------------------------------------
+static uint32_t lcd_fb_send_run(uint8_t row, uint8_t start, uint8_t end)
+{
+  uint32_t status;
+  uint8_t  addr   = g_lcd_line_addr[row] + start;
+  uint8_t  length = end - start + 1;
+
+  // The address command is packed into the same burst as the characters
+  if (g_lcd_fb_addr != addr)
+  {
+    status = lcd_write_at(addr, &g_lcd_fb[row][start], length);
+  }
+  else
+  {
+    status = lcd_write_chars(&g_lcd_fb[row][start], length);
+  } /* if */
+
+  if (status != 0)
+  {
+    lcd_fb_forget_address();
+    return (status);
+  } /* if */
+
+  memcpy(&g_lcd_glass[row][start], &g_lcd_fb[row][start], length);
+
+  // The LCD address counter increments after each character
+  g_lcd_fb_addr = addr + length;
+
+  return (status);
+
+} /* lcd_fb_send_run */
@@ -0,0 +1,78 @@
+// *****************************************************************************
+// ***************************    C Source Code     ****************************
+// *****************************************************************************
+//   DESIGNER NAME:  Bruce Link
+//
+//         VERSION:  1.0
+//
+//       FILE NAME:  lcd_fb.h
+//
+//-----------------------------------------------------------------------------
+// DESCRIPTION
+//    This module keeps a RAM frame buffer for the 2x16 LCD1602 display.
+//    The lcd_fb_put_* functions only update RAM. lcd_fb_flush() compares the
+//    frame buffer with a second copy that holds what is known to be on the
+//    LCD and only sends the characters that changed. A new DDRAM address is
+//    only sent where there is a gap between changed characters, so a typical
+//    dashboard update costs a handful of characters instead of 32.
+//
+//    NOTE: The LCD1602 functions that write to the display directly bypass
+//          the frame buffer. Call lcd_fb_invalidate() after using them so
+//          the next flush rewrites the whole display.
+//
+//-----------------------------------------------------------------------------
+// DISCLAIMER
+//    This code was developed for educational purposes as part of the CSC202
+//    course at Monroe Community Collage and is provided "as is" without
+//    warranties of any kind, whether express, implied, or statutory.
+//
+//    The author and organization do not warrant the accuracy, completeness, or
+//    reliability of the code. The author and organization shall not be liable
+//    for any direct, indirect, incidental, special, exemplary, or consequential
+//    damages arising out of the use of or inability to use the code, even if
+//    advised of the possibility of such damages.
+//
+//    Use of this code is at your own risk, and it is recommended to validate
+//    and adapt the code for your specific application and hardware
+//    requirements.
+//
+// Copyright (c) 2026 by Bruce Link
+//    You may use, edit, run or distribute this file as long as the above
+//    copyright notice remains
+// *****************************************************************************
+//******************************************************************************
+
+#ifndef __LCD_FB_H__
+#define __LCD_FB_H__
+
+//-----------------------------------------------------------------------------
+// Load standard C include files
+//-----------------------------------------------------------------------------
+#include <stdint.h>
+#include <stdbool.h>
+
+//-----------------------------------------------------------------------------
+// Define symbolic constants used by the module
+//-----------------------------------------------------------------------------
+
+// Unchanged characters between two changed ones that are rewritten instead
+// of sending a new DDRAM address (an address costs as much as a character)
+#define LCD_FB_MAX_REWRITE_GAP                                               (1)
+
+
+// ----------------------------------------------------------------------------
+// Prototype for support functions
+// ----------------------------------------------------------------------------
+void lcd_fb_init(void);
+void lcd_fb_clear(void);
+void lcd_fb_put_char(uint8_t row, uint8_t col, char character);
+void lcd_fb_put_string(uint8_t row, uint8_t col, const char *string);
+char lcd_fb_get_char(uint8_t row, uint8_t col);
+void lcd_fb_copy(char frame[]);
+uint8_t lcd_fb_cgram_in_use(void);
+void lcd_fb_invalidate(void);
+void lcd_fb_forget_address(void);
+bool lcd_fb_is_dirty(void);
+uint32_t lcd_fb_flush(uint8_t *sent);
+
+#endif /* __LCD_FB_H__ */
@@ -0,0 +1,308 @@
+// *****************************************************************************
+// ***************************    C Source Code     ****************************
+// *****************************************************************************
+//   DESIGNER NAME:  Bruce Link
+//
+//         VERSION:  1.0
+//
+//       FILE NAME:  lcd_glyph.c
+//
+//-----------------------------------------------------------------------------
+// DESCRIPTION
+//    This file contains the CGRAM glyph cache. See lcd_glyph.h for how
+//    glyphs are mapped onto the 8 CGRAM slots.
+//
+//-----------------------------------------------------------------------------
+// DISCLAIMER
+//    This code was developed for educational purposes as part of the CSC202
+//    course at Monroe Community Collage and is provided "as is" without
+//    warranties of any kind, whether express, implied, or statutory.
+//
+//    The author and organization do not warrant the accuracy, completeness, or
+//    reliability of the code. The author and organization shall not be liable
+//    for any direct, indirect, incidental, special, exemplary, or consequential
+//    damages arising out of the use of or inability to use the code, even if
+//    advised of the possibility of such damages.
+//
+//    Use of this code is at your own risk, and it is recommended to validate
+//    and adapt the code for your specific application and hardware
+//    requirements.
+//
+// Copyright (c) 2026 by Bruce Link
+//    You may use, edit, run or distribute this file as long as the above
+//    copyright notice remains
+// *****************************************************************************
+//******************************************************************************
+
+//-----------------------------------------------------------------------------
+// Load standard C include files
+//-----------------------------------------------------------------------------
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+//-----------------------------------------------------------------------------
+// Loads MSP launchpad board support macros and definitions
+//-----------------------------------------------------------------------------
+#include "LaunchPad.h"
+#include "lcd1602.h"
+#include "lcd_fb.h"
+#include "lcd_glyph.h"
+
+
+//-----------------------------------------------------------------------------
+// Define global variables and structures here.
+// NOTE: when possible avoid using global variables
+//-----------------------------------------------------------------------------
+
+// Define a structure to hold the state of one CGRAM slot
+typedef struct
+{
+  uint16_t id;                // glyph in the slot, LCD_GLYPH_ID_EMPTY if none
+  uint32_t last_used;         // value of g_lcd_glyph_clock at the last use
+  uint32_t frame;             // frame number of the last use
+} lcd_glyph_slot_t;
+
+static lcd_glyph_slot_t  g_lcd_glyph_slots[LCD_CGRAM_SLOTS];
+static uint32_t          g_lcd_glyph_clock = 0;
+static uint32_t          g_lcd_glyph_frame = 1;
+static lcd_glyph_stats_t g_lcd_glyph_stats;
+
+
+//-----------------------------------------------------------------------------
+// Define function prototypes used by the module
+//-----------------------------------------------------------------------------
+static int8_t lcd_glyph_find(uint16_t id);
+static int8_t lcd_glyph_victim(void);
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function empties all the slots and clears the statistics. The
+//    CGRAM contents are not changed, they are simply reloaded as needed.
+//
+// INPUT PARAMETERS:
+//    none
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    none
+// -----------------------------------------------------------------------------
+void lcd_glyph_init(void)
+{
+  for (uint8_t slot = 0; slot < LCD_CGRAM_SLOTS; slot++)
+  {
+    g_lcd_glyph_slots[slot].id        = LCD_GLYPH_ID_EMPTY;
+    g_lcd_glyph_slots[slot].last_used = 0;
+    g_lcd_glyph_slots[slot].frame     = 0;
+  } /* for */
+
+  g_lcd_glyph_clock = 0;
+  g_lcd_glyph_frame = 1;
+  lcd_glyph_clear_stats();
+
+} /* lcd_glyph_init */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function starts a new frame. Glyphs used in the previous frame
+//    are unlocked and can be replaced by glyphs of the new frame.
+//
+// INPUT PARAMETERS:
+//    none
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    none
+// -----------------------------------------------------------------------------
+void lcd_glyph_begin_frame(void)
+{
+  g_lcd_glyph_frame++;
+} /* lcd_glyph_begin_frame */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function returns the character code of a glyph, loading it into
+//    the least recently used unlocked CGRAM slot if it is not loaded yet.
+//    The glyph is locked in its slot until the next lcd_glyph_begin_frame.
+//
+// INPUT PARAMETERS:
+//    id   - application chosen id of the glyph (below LCD_GLYPH_ID_RESERVED
+//           unless called by the bar renderer)
+//    rows - LCD_GLYPH_ROWS row patterns of the glyph, top row first
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    character code to display, or LCD_GLYPH_NONE if all slots are locked
+//    or the glyph could not be loaded
+// -----------------------------------------------------------------------------
+char lcd_glyph_get(uint16_t id, const uint8_t rows[])
+{
+  int8_t slot = lcd_glyph_find(id);
+
+  g_lcd_glyph_clock++;
+
+  if (slot >= 0)
+  {
+    g_lcd_glyph_stats.hits++;
+  }
+  else
+  {
+    slot = lcd_glyph_victim();
+    if (slot < 0)
+    {
+      g_lcd_glyph_stats.full++;
+      return (LCD_GLYPH_NONE);
+    } /* if */
+
+    g_lcd_glyph_stats.misses++;
+    if (g_lcd_glyph_slots[slot].id != LCD_GLYPH_ID_EMPTY)
+    {
+      g_lcd_glyph_stats.evictions++;
+    } /* if */
+
+    // The CGRAM write moves the LCD address counter out of the DDRAM
+    lcd_fb_forget_address();
+    if (lcd_set_cgram_glyph((uint8_t)slot, rows) != I2C_SUCCESS)
+    {
+      g_lcd_glyph_slots[slot].id = LCD_GLYPH_ID_EMPTY;
+      return (LCD_GLYPH_NONE);
+    } /* if */
+
+    g_lcd_glyph_slots[slot].id = id;
+  } /* else */
+
+  g_lcd_glyph_slots[slot].last_used = g_lcd_glyph_clock;
+  g_lcd_glyph_slots[slot].frame     = g_lcd_glyph_frame;
+
+  return ((char)(LCD_GLYPH_CHAR_BASE + slot));
+
+} /* lcd_glyph_get */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function returns true if a glyph is loaded in a CGRAM slot. It
+//    does not count as a use of the glyph.
+//
+// INPUT PARAMETERS:
+//    id - id of the glyph
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    true if the glyph is loaded, false otherwise
+// -----------------------------------------------------------------------------
+bool lcd_glyph_is_loaded(uint16_t id)
+{
+  return (lcd_glyph_find(id) >= 0);
+} /* lcd_glyph_is_loaded */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    These functions read and clear the glyph cache statistics.
+//
+// INPUT PARAMETERS:
+//    none
+//
+// OUTPUT PARAMETERS:
+//    stats - copy of the statistics (lcd_glyph_get_stats)
+//
+// RETURN:
+//    none
+// -----------------------------------------------------------------------------
+void lcd_glyph_get_stats(lcd_glyph_stats_t *stats)
+{
+  *stats = g_lcd_glyph_stats;
+} /* lcd_glyph_get_stats */
+
+void lcd_glyph_clear_stats(void)
+{
+  memset(&g_lcd_glyph_stats, 0, sizeof(g_lcd_glyph_stats));
+} /* lcd_glyph_clear_stats */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function looks for the slot that holds a glyph.
+//
+// INPUT PARAMETERS:
+//    id - id of the glyph
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    slot number, or -1 if the glyph is not loaded
+// -----------------------------------------------------------------------------
+static int8_t lcd_glyph_find(uint16_t id)
+{
+  for (int8_t slot = 0; slot < LCD_CGRAM_SLOTS; slot++)
+  {
+    if (g_lcd_glyph_slots[slot].id == id)
+    {
+      return (slot);
+    } /* if */
+  } /* for */
+
+  return (-1);
+
+} /* lcd_glyph_find */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function picks the slot to load a new glyph into: an empty slot
+//    if there is one, otherwise the least recently used slot that is not
+//    locked by the current frame. A slot whose character code is still in
+//    the frame buffer, or on the display, is never picked even if it was
+//    not requested in this frame, so a glyph cell that is left alone keeps
+//    its pattern.
+//
+// INPUT PARAMETERS:
+//    none
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    slot number, or -1 if every slot is locked
+// -----------------------------------------------------------------------------
+static int8_t lcd_glyph_victim(void)
+{
+  uint8_t in_use = lcd_fb_cgram_in_use();
+  int8_t  victim = -1;
+
+  for (int8_t slot = 0; slot < LCD_CGRAM_SLOTS; slot++)
+  {
+    if ((in_use & (1U << slot)) != 0)
+    {
+      continue;
+    } /* if */
+
+    if (g_lcd_glyph_slots[slot].id == LCD_GLYPH_ID_EMPTY)
+    {
+      return (slot);
+    } /* if */
+
+    if ((g_lcd_glyph_slots[slot].frame != g_lcd_glyph_frame) &&
+        ((victim < 0) || (g_lcd_glyph_slots[slot].last_used <
+                          g_lcd_glyph_slots[victim].last_used)))
+    {
+      victim = slot;
+    } /* if */
+  } /* for */
+
+  return (victim);
+
+} /* lcd_glyph_victim */
@@ -0,0 +1,104 @@
+// *****************************************************************************
+// ***************************    C Source Code     ****************************
+// *****************************************************************************
+//   DESIGNER NAME:  Bruce Link
+//
+//         VERSION:  1.0
+//
+//       FILE NAME:  lcd_glyph.h
+//
+//-----------------------------------------------------------------------------
+// DESCRIPTION
+//    This module manages the 8 user defined characters (CGRAM slots) of the
+//    LCD1602. The application can use any number of logical glyphs, each
+//    known by a 16-bit id and an 8 row pattern. lcd_glyph_get() returns the
+//    character code to put in the frame buffer:
+//      - if the glyph is already in a slot (hit) nothing is sent
+//      - otherwise (miss) the least recently used slot is reloaded, which
+//        costs one I2C burst of 9 LCD writes
+//
+//    A slot that is showing on the display must not be reloaded, or every
+//    cell that uses it changes too. The glyphs requested since the last
+//    lcd_glyph_begin_frame() are locked in their slots, and a slot whose
+//    code is still in the frame buffer (lcd_fb) or on the display is never
+//    reloaded. Glyph cells that do not change need not be redrawn, but a
+//    glyph that is no longer wanted only frees its slot once its cells are
+//    overwritten. If no slot can be reloaded lcd_glyph_get() returns
+//    LCD_GLYPH_NONE, a blank that is safe to draw, and the caller may draw
+//    something else instead.
+//
+//    Slot n is returned as character code 8 + n (the HD44780 maps codes 8-15
+//    onto the same CGRAM as 0-7) so glyphs can be used in C strings.
+//
+//    NOTE: Glyphs are loaded with blocking LCD writes. The background LCD
+//          service (lcd_service) locks these writes while it runs, so a
+//          glyph that is not loaded before the service starts is returned
+//          as LCD_GLYPH_NONE.
+//
+//-----------------------------------------------------------------------------
+// DISCLAIMER
+//    This code was developed for educational purposes as part of the CSC202
+//    course at Monroe Community Collage and is provided "as is" without
+//    warranties of any kind, whether express, implied, or statutory.
+//
+//    The author and organization do not warrant the accuracy, completeness, or
+//    reliability of the code. The author and organization shall not be liable
+//    for any direct, indirect, incidental, special, exemplary, or consequential
+//    damages arising out of the use of or inability to use the code, even if
+//    advised of the possibility of such damages.
+//
+//    Use of this code is at your own risk, and it is recommended to validate
+//    and adapt the code for your specific application and hardware
+//    requirements.
+//
+// Copyright (c) 2026 by Bruce Link
+//    You may use, edit, run or distribute this file as long as the above
+//    copyright notice remains
+// *****************************************************************************
+//******************************************************************************
+
+#ifndef __LCD_GLYPH_H__
+#define __LCD_GLYPH_H__
+
+//-----------------------------------------------------------------------------
+// Load standard C include files
+//-----------------------------------------------------------------------------
+#include <stdint.h>
+#include <stdbool.h>
+
+//-----------------------------------------------------------------------------
+// Define symbolic constants used by the module
+//-----------------------------------------------------------------------------
+
+// Character code of CGRAM slot 0
+#define LCD_GLYPH_CHAR_BASE                                                  (8)
+
+// Code returned when no slot is free. Codes 0-15 are all CGRAM, so this is
+// a blank ROM character that can be drawn as is.
+#define LCD_GLYPH_NONE                                                     (' ')
+
+// Glyph ids from LCD_GLYPH_ID_RESERVED up are used by the bar renderer
+#define LCD_GLYPH_ID_RESERVED                                           (0xFF00)
+#define LCD_GLYPH_ID_EMPTY                                              (0xFFFF)
+
+// Define a structure to hold the glyph cache statistics
+typedef struct
+{
+  uint32_t hits;              // glyph was already loaded
+  uint32_t misses;            // glyph had to be loaded
+  uint32_t evictions;         // a loaded glyph was replaced
+  uint32_t full;              // no unlocked slot, LCD_GLYPH_NONE returned
+} lcd_glyph_stats_t;
+
+
+// ----------------------------------------------------------------------------
+// Prototype for support functions
+// ----------------------------------------------------------------------------
+void lcd_glyph_init(void);
+void lcd_glyph_begin_frame(void);
+char lcd_glyph_get(uint16_t id, const uint8_t rows[]);
+bool lcd_glyph_is_loaded(uint16_t id);
+void lcd_glyph_get_stats(lcd_glyph_stats_t *stats);
+void lcd_glyph_clear_stats(void);
+
+#endif /* __LCD_GLYPH_H__ */
@@ -0,0 +1,349 @@
+// *****************************************************************************
+// ***************************    C Source Code     ****************************
+// *****************************************************************************
+//   DESIGNER NAME:  Bruce Link
+//
+//         VERSION:  1.0
+//
+//       FILE NAME:  lcd_marquee.c
+//
+//-----------------------------------------------------------------------------
+// DESCRIPTION
+//    This file contains the display shift marquee. See lcd_marquee.h for
+//    how it is used.
+//
+//-----------------------------------------------------------------------------
+// DISCLAIMER
+//    This code was developed for educational purposes as part of the CSC202
+//    course at Monroe Community Collage and is provided "as is" without
+//    warranties of any kind, whether express, implied, or statutory.
+//
+//    The author and organization do not warrant the accuracy, completeness, or
+//    reliability of the code. The author and organization shall not be liable
+//    for any direct, indirect, incidental, special, exemplary, or consequential
+//    damages arising out of the use of or inability to use the code, even if
+//    advised of the possibility of such damages.
+//
+//    Use of this code is at your own risk, and it is recommended to validate
+//    and adapt the code for your specific application and hardware
+//    requirements.
+//
+// Copyright (c) 2026 by Bruce Link
+//    You may use, edit, run or distribute this file as long as the above
+//    copyright notice remains
+// *****************************************************************************
+//******************************************************************************
+
+//-----------------------------------------------------------------------------
+// Load standard C include files
+//-----------------------------------------------------------------------------
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+//-----------------------------------------------------------------------------
+// Loads MSP launchpad board support macros and definitions
+//-----------------------------------------------------------------------------
+#include "LaunchPad.h"
+#include "i2c_sched.h"
+#include "lcd1602.h"
+#include "lcd_fb.h"
+#include "lcd_marquee.h"
+
+
+//-----------------------------------------------------------------------------
+// Define global variables and structures here.
+// NOTE: when possible avoid using global variables
+//-----------------------------------------------------------------------------
+static uint8_t           g_marquee_client   = I2C_SCHED_INVALID_CLIENT;
+static volatile bool     g_marquee_running  = false;
+static volatile uint8_t  g_marquee_offset   = 0;
+static uint8_t           g_marquee_step     = 1;
+static uint8_t           g_marquee_command  = LCD_CURSOR_SHIFT_CMD;
+static uint16_t          g_marquee_period   = 1;
+static uint16_t          g_marquee_ticks    = 0;
+static volatile uint32_t g_marquee_overruns = 0;
+
+// The shift instruction is encoded for each step, so it carries the
+// backlight bit the port has when the step is queued
+static pcf8574_seq_struct g_marquee_seq;
+static i2c_sched_xfer_t   g_marquee_xfer;
+
+
+//-----------------------------------------------------------------------------
+// Define function prototypes used by the module
+//-----------------------------------------------------------------------------
+static void lcd_marquee_xfer_done(i2c_sched_xfer_t *xfer);
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function registers the marquee as a client of the I2C bus
+//    scheduler.
+//
+// INPUT PARAMETERS:
+//    none
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    true if the marquee is ready, false if no scheduler client was free
+// -----------------------------------------------------------------------------
+bool lcd_marquee_init(void)
+{
+  if (g_marquee_client == I2C_SCHED_INVALID_CLIENT)
+  {
+    g_marquee_client = I2C_sched_register(LCD_MARQUEE_I2C_PRIORITY,
+                                          LCD_MARQUEE_I2C_SHARE);
+  } /* if */
+
+  memset(&g_marquee_xfer, 0, sizeof(g_marquee_xfer));
+  g_marquee_xfer.callback = lcd_marquee_xfer_done;
+
+  return (g_marquee_client != I2C_SCHED_INVALID_CLIENT);
+
+} /* lcd_marquee_init */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function writes the two lines of the marquee to the DDRAM. Each
+//    line is padded with spaces to the full 40 character DDRAM line, longer
+//    lines are cut. The display is returned to its home position, showing
+//    the first 16 characters. This function blocks, call it with the
+//    marquee stopped.
+//
+// INPUT PARAMETERS:
+//    line1 - NULL terminated text of line 1 (up to 40 characters)
+//    line2 - NULL terminated text of line 2, or NULL for a blank line
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    none
+// -----------------------------------------------------------------------------
+void lcd_marquee_load(const char *line1, const char *line2)
+{
+  char   buffer[LCD_DDRAM_LINE_LENGTH];
+  size_t length;
+
+  memset(buffer, ' ', sizeof(buffer));
+  length = strlen(line1);
+  memcpy(buffer, line1, (length < sizeof(buffer)) ? length : sizeof(buffer));
+  (void)lcd_write_at(LCD_LINE1_ADDR, buffer, sizeof(buffer));
+
+  memset(buffer, ' ', sizeof(buffer));
+  if (line2 != NULL)
+  {
+    length = strlen(line2);
+    memcpy(buffer, line2, (length < sizeof(buffer)) ? length : sizeof(buffer));
+  } /* if */
+  (void)lcd_write_at(LCD_LINE2_ADDR, buffer, sizeof(buffer));
+
+  (void)lcd1602_write(LCD_IIC_ADDRESS, LCD_RETURN_HOME_CMD, LCD_INSTR_REG);
+  g_marquee_offset = 0;
+
+  // The frame buffer no longer knows what is on the display
+  lcd_fb_invalidate();
+
+} /* lcd_marquee_load */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function starts scrolling. One step is taken every ticks_per_step
+//    calls of lcd_marquee_tick(). A step that is still on the bus is
+//    allowed to finish first, so it is counted in the old direction.
+//
+// INPUT PARAMETERS:
+//    ticks_per_step - number of ticks between steps (at least 1)
+//    direction      - LCD_MARQUEE_LEFT or LCD_MARQUEE_RIGHT
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    none
+// -----------------------------------------------------------------------------
+void lcd_marquee_start(uint16_t ticks_per_step, uint8_t direction)
+{
+  uint8_t command = LCD_CURSOR_SHIFT_CMD | LCD_DISPLAY_MOVE;
+
+  g_marquee_running = false;
+
+  if (g_marquee_xfer.state != I2C_SCHED_XFER_DONE)
+  {
+    (void)I2C_sched_wait(&g_marquee_xfer);
+  } /* if */
+
+  // Text moving left means the display window moves right along the DDRAM
+  if (direction == LCD_MARQUEE_RIGHT)
+  {
+    command |= LCD_MOVE_RIGHT;
+    g_marquee_step = LCD_DDRAM_LINE_LENGTH - 1;
+  }
+  else
+  {
+    command |= LCD_MOVE_LEFT;
+    g_marquee_step = 1;
+  } /* if */
+
+  g_marquee_command = command;
+  g_marquee_period  = (ticks_per_step > 0) ? ticks_per_step : 1;
+  g_marquee_ticks   = 0;
+  g_marquee_running = true;
+
+} /* lcd_marquee_start */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function stops scrolling and returns the display to its home
+//    position. It waits for a step that is on the bus to finish.
+//
+// INPUT PARAMETERS:
+//    none
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    none
+// -----------------------------------------------------------------------------
+void lcd_marquee_stop(void)
+{
+  g_marquee_running = false;
+
+  if (g_marquee_xfer.state != I2C_SCHED_XFER_DONE)
+  {
+    (void)I2C_sched_wait(&g_marquee_xfer);
+  } /* if */
+
+  (void)lcd1602_write(LCD_IIC_ADDRESS, LCD_RETURN_HOME_CMD, LCD_INSTR_REG);
+  g_marquee_offset = 0;
+  lcd_fb_forget_address();
+
+} /* lcd_marquee_stop */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function is the time base of the marquee. Call it from a periodic
+//    interrupt. Every ticks_per_step calls it queues one display shift. If
+//    the previous shift is still waiting for the bus the step is skipped
+//    and counted as an overrun. Each call also lets the I2C bus scheduler
+//    end a transaction that is stuck on the bus.
+//
+// INPUT PARAMETERS:
+//    none
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    none
+// -----------------------------------------------------------------------------
+void lcd_marquee_tick(void)
+{
+  I2C_sched_tick();
+
+  if (!g_marquee_running || (++g_marquee_ticks < g_marquee_period))
+  {
+    return;
+  } /* if */
+
+  g_marquee_ticks = 0;
+
+  if (g_marquee_xfer.state != I2C_SCHED_XFER_DONE)
+  {
+    g_marquee_overruns++;
+    return;
+  } /* if */
+
+  lcd1602_encode_cmd(&g_marquee_seq, g_marquee_command);
+  if (I2C_sched_write(g_marquee_client, &g_marquee_xfer, LCD_IIC_ADDRESS,
+                      g_marquee_seq.data, g_marquee_seq.length) != I2C_SUCCESS)
+  {
+    g_marquee_overruns++;
+  } /* if */
+
+} /* lcd_marquee_tick */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function returns the position in the 40 character DDRAM line of
+//    the first visible character.
+//
+// INPUT PARAMETERS:
+//    none
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    offset of the display window (0 to 39)
+// -----------------------------------------------------------------------------
+uint8_t lcd_marquee_get_offset(void)
+{
+  return (g_marquee_offset);
+} /* lcd_marquee_get_offset */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function returns the number of steps that were skipped because
+//    the bus was too busy to send the previous step in time.
+//
+// INPUT PARAMETERS:
+//    none
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    number of skipped steps
+// -----------------------------------------------------------------------------
+uint32_t lcd_marquee_get_overrun_count(void)
+{
+  return (g_marquee_overruns);
+} /* lcd_marquee_get_overrun_count */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function is called by the I2C bus scheduler when a shift has been
+//    sent. It records the new position of the display window.
+//
+// INPUT PARAMETERS:
+//    xfer - pointer to the transaction that is done
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    none
+// -----------------------------------------------------------------------------
+static void lcd_marquee_xfer_done(i2c_sched_xfer_t *xfer)
+{
+  uint8_t offset;
+
+  if (xfer->status == I2C_SUCCESS)
+  {
+    pcf8574_seq_complete(&g_marquee_seq);
+
+    offset = g_marquee_offset + g_marquee_step;
+    if (offset >= LCD_DDRAM_LINE_LENGTH)
+    {
+      offset -= LCD_DDRAM_LINE_LENGTH;
+    } /* if */
+    g_marquee_offset = offset;
+  }
+  else
+  {
+    g_marquee_overruns++;
+  } /* if */
+
+} /* lcd_marquee_xfer_done */
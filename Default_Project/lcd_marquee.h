@@ -0,0 +1,96 @@
+// *****************************************************************************
+// ***************************    C Source Code     ****************************
+// *****************************************************************************
+//   DESIGNER NAME:  Bruce Link
+//
+//         VERSION:  1.0
+//
+//       FILE NAME:  lcd_marquee.h
+//
+//-----------------------------------------------------------------------------
+// DESCRIPTION
+//    This module scrolls long messages on the LCD1602 with the display
+//    shift of the HD44780. Each DDRAM line holds 40 characters and the
+//    display shows a 16 character window of them. lcd_marquee_load() writes
+//    both 40 character lines once, after that each scroll step is a single
+//    display shift instruction (5 I2C bytes) instead of 16 characters.
+//    The shift wraps around at 40 characters, so a message loops by itself.
+//
+//    Steps are timed by lcd_marquee_tick(), called from a periodic
+//    interrupt, for example:
+//
+//      sys_tick_init(get_bus_clock_freq() / 100);       // 10ms tick
+//      lcd_marquee_start(25, LCD_MARQUEE_LEFT);         // step every 250ms
+//
+//      void SysTick_Handler(void)
+//      {
+//        lcd_marquee_tick();
+//      }
+//
+//    The shift instruction is queued on the I2C bus scheduler, so the tick
+//    never waits on the bus.
+//
+//    NOTE: The HD44780 shifts both lines together. While a marquee runs,
+//          do not use the frame buffer (lcd_fb) or the LCD service, they
+//          assume the display is not shifted. lcd_marquee_stop() returns
+//          the display to its home position.
+//          I2C_dma_init() and I2C_sched_init() must be called before
+//          lcd_marquee_init().
+//
+//-----------------------------------------------------------------------------
+// DISCLAIMER
+//    This code was developed for educational purposes as part of the CSC202
+//    course at Monroe Community Collage and is provided "as is" without
+//    warranties of any kind, whether express, implied, or statutory.
+//
+//    The author and organization do not warrant the accuracy, completeness, or
+//    reliability of the code. The author and organization shall not be liable
+//    for any direct, indirect, incidental, special, exemplary, or consequential
+//    damages arising out of the use of or inability to use the code, even if
+//    advised of the possibility of such damages.
+//
+//    Use of this code is at your own risk, and it is recommended to validate
+//    and adapt the code for your specific application and hardware
+//    requirements.
+//
+// Copyright (c) 2026 by Bruce Link
+//    You may use, edit, run or distribute this file as long as the above
+//    copyright notice remains
+// *****************************************************************************
+//******************************************************************************
+
+#ifndef __LCD_MARQUEE_H__
+#define __LCD_MARQUEE_H__
+
+//-----------------------------------------------------------------------------
+// Load standard C include files
+//-----------------------------------------------------------------------------
+#include <stdint.h>
+#include <stdbool.h>
+
+//-----------------------------------------------------------------------------
+// Define symbolic constants used by the module
+//-----------------------------------------------------------------------------
+
+// Scroll direction of the text
+#define LCD_MARQUEE_LEFT                                                     (0)
+#define LCD_MARQUEE_RIGHT                                                    (1)
+
+// Bus scheduler client settings: a late step is visible, so above the
+// background LCD service
+#define LCD_MARQUEE_I2C_PRIORITY                                             (2)
+#define LCD_MARQUEE_I2C_SHARE                                                (1)
+
+
+// ----------------------------------------------------------------------------
+// Prototype for support functions
+// ----------------------------------------------------------------------------
+bool lcd_marquee_init(void);
+void lcd_marquee_load(const char *line1, const char *line2);
+void lcd_marquee_start(uint16_t ticks_per_step, uint8_t direction);
+void lcd_marquee_stop(void);
+void lcd_marquee_tick(void);
+uint8_t lcd_marquee_get_offset(void);
+uint32_t lcd_marquee_get_overrun_count(void);
+
+#endif /* __LCD_MARQUEE_H__ */
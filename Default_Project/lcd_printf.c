@@ -0,0 +1,456 @@
+// *****************************************************************************
+// ***************************    C Source Code     ****************************
+// *****************************************************************************
+//   DESIGNER NAME:  Bruce Link
+//
+//         VERSION:  1.0
+//
+//       FILE NAME:  lcd_printf.c
+//
+//-----------------------------------------------------------------------------
+// DESCRIPTION
+//    This file contains the frame buffer printf. See lcd_printf.h for the
+//    supported format.
+//
+//-----------------------------------------------------------------------------
+// DISCLAIMER
+//    This code was developed for educational purposes as part of the CSC202
+//    course at Monroe Community Collage and is provided "as is" without
+//    warranties of any kind, whether express, implied, or statutory.
+//
+//    The author and organization do not warrant the accuracy, completeness, or
+//    reliability of the code. The author and organization shall not be liable
+//    for any direct, indirect, incidental, special, exemplary, or consequential
+//    damages arising out of the use of or inability to use the code, even if
+//    advised of the possibility of such damages.
+//
+//    Use of this code is at your own risk, and it is recommended to validate
+//    and adapt the code for your specific application and hardware
+//    requirements.
+//
+// Copyright (c) 2026 by Bruce Link
+//    You may use, edit, run or distribute this file as long as the above
+//    copyright notice remains
+// *****************************************************************************
+//******************************************************************************
+
+//-----------------------------------------------------------------------------
+// Load standard C include files
+//-----------------------------------------------------------------------------
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdarg.h>
+#include <string.h>
+
+//-----------------------------------------------------------------------------
+// Loads MSP launchpad board support macros and definitions
+//-----------------------------------------------------------------------------
+#include "lcd1602.h"
+#include "lcd_fb.h"
+#include "num_ascii.h"
+#include "lcd_printf.h"
+
+
+//-----------------------------------------------------------------------------
+// Define symbolic constants used by the module
+//-----------------------------------------------------------------------------
+#define LCD_PRINTF_NO_PRECISION                                           (0xFF)
+#define LCD_PRINTF_HEX_DIGITS                                                (8)
+
+
+//-----------------------------------------------------------------------------
+// Define global variables and structures here.
+// NOTE: when possible avoid using global variables
+//-----------------------------------------------------------------------------
+
+// Define a structure to hold the output position of one lcd_printf call
+typedef struct
+{
+  uint8_t row;
+  uint8_t col;
+  uint8_t count;              // characters that landed on the display
+} lcd_printf_cursor_t;
+
+// Define a structure to hold one parsed conversion specification
+typedef struct
+{
+  bool    left;               // '-' flag
+  bool    zero;               // '0' flag
+  uint8_t width;
+  uint8_t precision;          // LCD_PRINTF_NO_PRECISION if not given
+} lcd_printf_spec_t;
+
+
+//-----------------------------------------------------------------------------
+// Define function prototypes used by the module
+//-----------------------------------------------------------------------------
+static void lcd_printf_putc(lcd_printf_cursor_t *cursor, char character);
+static void lcd_printf_field(lcd_printf_cursor_t *cursor,
+            const lcd_printf_spec_t *spec, const char *text, uint8_t length,
+            bool numeric);
+static const char *lcd_printf_parse(const char *format,
+                   lcd_printf_spec_t *spec);
+static uint8_t lcd_printf_hex(uint32_t value, bool upper, char *text);
+static const char *lcd_printf_trim(const char *text);
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function formats text into the frame buffer starting at the given
+//    position. Characters past the end of the line are dropped, the output
+//    does not wrap to the next line.
+//
+// INPUT PARAMETERS:
+//    row    - line number (LCD_LINE_NUM_1 or LCD_LINE_NUM_2)
+//    col    - character position of the first character
+//    format - format string, see lcd_printf.h
+//    ...    - values to format
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    number of characters written into the frame buffer
+// -----------------------------------------------------------------------------
+uint8_t lcd_printf(uint8_t row, uint8_t col, const char *format, ...)
+{
+  va_list args;
+  uint8_t count;
+
+  va_start(args, format);
+  count = lcd_vprintf(row, col, format, args);
+  va_end(args);
+
+  return (count);
+
+} /* lcd_printf */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function is the va_list version of lcd_printf.
+//
+// INPUT PARAMETERS:
+//    row    - line number (LCD_LINE_NUM_1 or LCD_LINE_NUM_2)
+//    col    - character position of the first character
+//    format - format string, see lcd_printf.h
+//    args   - values to format
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    number of characters written into the frame buffer
+// -----------------------------------------------------------------------------
+uint8_t lcd_vprintf(uint8_t row, uint8_t col, const char *format,
+        va_list args)
+{
+  lcd_printf_cursor_t cursor = {row, col, 0};
+  lcd_printf_spec_t   spec;
+  char                number[LCD_PRINTF_NUMBER_SIZE + 1];
+  const char         *text;
+  uint8_t             length;
+  int32_t             value;
+  uint8_t             frac_digits;
+
+  while (*format != '\0')
+  {
+    if (*format != '%')
+    {
+      lcd_printf_putc(&cursor, *format++);
+      continue;
+    } /* if */
+
+    format = lcd_printf_parse(format + 1, &spec);
+
+    switch (*format)
+    {
+      case 'd':
+      case 'i':
+        s32_to_ascii((int32_t)va_arg(args, int), number);
+        text = lcd_printf_trim(number);
+        lcd_printf_field(&cursor, &spec, text, strlen(text), true);
+        break;
+
+      case 'u':
+        u32_to_ascii((uint32_t)va_arg(args, unsigned int), number);
+        text = lcd_printf_trim(number);
+        lcd_printf_field(&cursor, &spec, text, strlen(text), true);
+        break;
+
+      case 'x':
+      case 'X':
+        length = lcd_printf_hex((uint32_t)va_arg(args, unsigned int),
+                                (*format == 'X'), number);
+        lcd_printf_field(&cursor, &spec, number, length, true);
+        break;
+
+      case 'q':
+        value = (int32_t)va_arg(args, int);
+        frac_digits = (spec.precision != LCD_PRINTF_NO_PRECISION) ?
+                      spec.precision : 0;
+        (void)fixed_to_ascii(value, frac_digits, LCD_PRINTF_NUMBER_SIZE,
+                             number);
+        text = lcd_printf_trim(number);
+        lcd_printf_field(&cursor, &spec, text, strlen(text), true);
+        break;
+
+      case 'c':
+        number[0] = (char)va_arg(args, int);
+        lcd_printf_field(&cursor, &spec, number, 1, false);
+        break;
+
+      case 's':
+        text = va_arg(args, const char *);
+        length = 0;
+        while ((text[length] != '\0') &&
+               ((spec.precision == LCD_PRINTF_NO_PRECISION) ||
+                (length < spec.precision)))
+        {
+          length++;
+        } /* while */
+        lcd_printf_field(&cursor, &spec, text, length, false);
+        break;
+
+      case '\0':
+        // Format ends in the middle of a conversion
+        return (cursor.count);
+
+      default:
+        // '%%' and unknown conversions print the character itself
+        lcd_printf_putc(&cursor, *format);
+        break;
+    } /* switch */
+
+    format++;
+  } /* while */
+
+  return (cursor.count);
+
+} /* lcd_vprintf */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function writes one character at the cursor and moves the cursor
+//    right. Characters outside of the display are dropped.
+//
+// INPUT PARAMETERS:
+//    cursor    - output position
+//    character - character to write
+//
+// OUTPUT PARAMETERS:
+//    cursor    - moved one position right
+//
+// RETURN:
+//    none
+// -----------------------------------------------------------------------------
+static void lcd_printf_putc(lcd_printf_cursor_t *cursor, char character)
+{
+  if ((cursor->row < LINES_PER_LCD) &&
+      (cursor->col < CHARACTERS_PER_LCD_LINE))
+  {
+    lcd_fb_put_char(cursor->row, cursor->col, character);
+    cursor->col++;
+    cursor->count++;
+  } /* if */
+
+} /* lcd_printf_putc */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function writes a converted value padded to the field width. Zero
+//    padding is only used for numbers and goes after a leading '-'.
+//
+// INPUT PARAMETERS:
+//    cursor  - output position
+//    spec    - field specification
+//    text    - converted value
+//    length  - number of characters in text
+//    numeric - true if text is a number
+//
+// OUTPUT PARAMETERS:
+//    cursor  - moved past the field
+//
+// RETURN:
+//    none
+// -----------------------------------------------------------------------------
+static void lcd_printf_field(lcd_printf_cursor_t *cursor,
+            const lcd_printf_spec_t *spec, const char *text, uint8_t length,
+            bool numeric)
+{
+  uint8_t pad = (spec->width > length) ? (spec->width - length) : 0;
+
+  if (spec->left)
+  {
+    for (uint8_t idx = 0; idx < length; idx++)
+    {
+      lcd_printf_putc(cursor, text[idx]);
+    } /* for */
+    while (pad-- > 0)
+    {
+      lcd_printf_putc(cursor, ' ');
+    } /* while */
+  }
+  else if (spec->zero && numeric)
+  {
+    if (*text == '-')
+    {
+      lcd_printf_putc(cursor, *text++);
+      length--;
+    } /* if */
+    while (pad-- > 0)
+    {
+      lcd_printf_putc(cursor, '0');
+    } /* while */
+    for (uint8_t idx = 0; idx < length; idx++)
+    {
+      lcd_printf_putc(cursor, text[idx]);
+    } /* for */
+  }
+  else
+  {
+    while (pad-- > 0)
+    {
+      lcd_printf_putc(cursor, ' ');
+    } /* while */
+    for (uint8_t idx = 0; idx < length; idx++)
+    {
+      lcd_printf_putc(cursor, text[idx]);
+    } /* for */
+  } /* if */
+
+} /* lcd_printf_field */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function reads the flags, width, precision and length modifier of
+//    a conversion specification.
+//
+// INPUT PARAMETERS:
+//    format - pointer to the character after the '%'
+//
+// OUTPUT PARAMETERS:
+//    spec   - the parsed specification
+//
+// RETURN:
+//    pointer to the conversion character
+// -----------------------------------------------------------------------------
+static const char *lcd_printf_parse(const char *format,
+                   lcd_printf_spec_t *spec)
+{
+  spec->left      = false;
+  spec->zero      = false;
+  spec->width     = 0;
+  spec->precision = LCD_PRINTF_NO_PRECISION;
+
+  while ((*format == '-') || (*format == '0'))
+  {
+    if (*format++ == '-')
+    {
+      spec->left = true;
+    }
+    else
+    {
+      spec->zero = true;
+    } /* if */
+  } /* while */
+
+  // Fields wider than the display are of no use, so the width is capped
+  while ((*format >= '0') && (*format <= '9'))
+  {
+    spec->width = (spec->width * BASE_TEN) + (*format++ - '0');
+    if (spec->width > CHARACTERS_PER_LCD_LINE)
+    {
+      spec->width = CHARACTERS_PER_LCD_LINE;
+    } /* if */
+  } /* while */
+
+  if (*format == '.')
+  {
+    format++;
+    spec->precision = 0;
+    while ((*format >= '0') && (*format <= '9'))
+    {
+      spec->precision = (spec->precision * BASE_TEN) + (*format++ - '0');
+      if (spec->precision > CHARACTERS_PER_LCD_LINE)
+      {
+        spec->precision = CHARACTERS_PER_LCD_LINE;
+      } /* if */
+    } /* while */
+  } /* if */
+
+  if (*format == 'l')
+  {
+    format++;
+  } /* if */
+
+  return (format);
+
+} /* lcd_printf_parse */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function converts a value to hexadecimal without leading zeros.
+//
+// INPUT PARAMETERS:
+//    value - the number to convert
+//    upper - true for 'A'-'F', false for 'a'-'f'
+//
+// OUTPUT PARAMETERS:
+//    text  - the hexadecimal digits (not NULL terminated)
+//
+// RETURN:
+//    number of digits
+// -----------------------------------------------------------------------------
+static uint8_t lcd_printf_hex(uint32_t value, bool upper, char *text)
+{
+  uint8_t length = 0;
+  uint8_t nibble;
+  int8_t  shift;
+
+  for (shift = (LCD_PRINTF_HEX_DIGITS - 1) * NIBBLE_SHIFT; shift >= 0;
+       shift -= NIBBLE_SHIFT)
+  {
+    nibble = (value >> shift) & LOWER_NIBBLE_MASK;
+    if ((nibble != 0) || (length != 0) || (shift == 0))
+    {
+      text[length++] = (char)hex_to_ascii(nibble);
+      if (!upper && (nibble > 9))
+      {
+        text[length - 1] += ('a' - 'A');
+      } /* if */
+    } /* if */
+  } /* for */
+
+  return (length);
+
+} /* lcd_printf_hex */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function skips the leading spaces of a right-justified number.
+//
+// INPUT PARAMETERS:
+//    text - space padded number
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    pointer to the first character that is not a space
+// -----------------------------------------------------------------------------
+static const char *lcd_printf_trim(const char *text)
+{
+  while (*text == ' ')
+  {
+    text++;
+  } /* while */
+
+  return (text);
+
+} /* lcd_printf_trim */
@@ -0,0 +1,87 @@
+// *****************************************************************************
+// ***************************    C Source Code     ****************************
+// *****************************************************************************
+//   DESIGNER NAME:  Bruce Link
+//
+//         VERSION:  1.0
+//
+//       FILE NAME:  lcd_printf.h
+//
+//-----------------------------------------------------------------------------
+// DESCRIPTION
+//    This module provides a small printf for the LCD1602 that renders into
+//    the frame buffer (lcd_fb). A whole screen of labels and values is
+//    composed in RAM and then sent by one lcd_fb_flush() (or committed to
+//    the LCD service). Output that falls outside of the 16x2 display is
+//    clipped.
+//
+//    Conversions are done with the divide free routines of num_ascii, the
+//    C library printf is not used.
+//
+//    Format: %[flags][width][.precision]conversion
+//      flags      -   left align in the field (default is right align)
+//                 0   pad numbers with leading zeros instead of spaces
+//      width      minimum number of characters of the field
+//      precision  %s: maximum number of characters
+//                 %q: number of digits after the decimal point
+//      conversion d i  signed integer
+//                 u    unsigned integer
+//                 x X  unsigned hexadecimal, lower or upper case
+//                 q    fixed-point: int32_t scaled by 10^precision
+//                 c    character
+//                 s    string
+//                 %    a '%' character
+//      An 'l' before the conversion is accepted (int and long are both
+//      32 bits on the Cortex-M0+).
+//
+//    Example:
+//      lcd_printf(LCD_LINE_NUM_1, 0, "T=%5.1qC", temp_x10);    "T= 23.5C"
+//      lcd_printf(LCD_LINE_NUM_2, 0, "%-6s%04u", "RPM", rpm);  "RPM   0950"
+//
+//-----------------------------------------------------------------------------
+// DISCLAIMER
+//    This code was developed for educational purposes as part of the CSC202
+//    course at Monroe Community Collage and is provided "as is" without
+//    warranties of any kind, whether express, implied, or statutory.
+//
+//    The author and organization do not warrant the accuracy, completeness, or
+//    reliability of the code. The author and organization shall not be liable
+//    for any direct, indirect, incidental, special, exemplary, or consequential
+//    damages arising out of the use of or inability to use the code, even if
+//    advised of the possibility of such damages.
+//
+//    Use of this code is at your own risk, and it is recommended to validate
+//    and adapt the code for your specific application and hardware
+//    requirements.
+//
+// Copyright (c) 2026 by Bruce Link
+//    You may use, edit, run or distribute this file as long as the above
+//    copyright notice remains
+// *****************************************************************************
+//******************************************************************************
+
+#ifndef __LCD_PRINTF_H__
+#define __LCD_PRINTF_H__
+
+//-----------------------------------------------------------------------------
+// Load standard C include files
+//-----------------------------------------------------------------------------
+#include <stdint.h>
+#include <stdarg.h>
+
+//-----------------------------------------------------------------------------
+// Define symbolic constants used by the module
+//-----------------------------------------------------------------------------
+
+// Longest converted number: sign, 10 digits and a decimal point
+#define LCD_PRINTF_NUMBER_SIZE                                              (12)
+
+
+// ----------------------------------------------------------------------------
+// Prototype for support functions
+// ----------------------------------------------------------------------------
+uint8_t lcd_printf(uint8_t row, uint8_t col, const char *format, ...);
+uint8_t lcd_vprintf(uint8_t row, uint8_t col, const char *format,
+        va_list args);
+
+#endif /* __LCD_PRINTF_H__ */
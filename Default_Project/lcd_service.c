@@ -0,0 +1,484 @@
+// *****************************************************************************
+// ***************************    C Source Code     ****************************
+// *****************************************************************************
+//   DESIGNER NAME:  Bruce Link
+//
+//         VERSION:  1.0
+//
+//       FILE NAME:  lcd_service.c
+//
+//-----------------------------------------------------------------------------
+// DESCRIPTION
+//    This file contains the background LCD refresh service. It is a small
+//    state machine driven by two interrupts:
+//      - TIMA1 zero event  (refresh tick) starts a new frame if one has been
+//        committed and the previous frame is finished.
+//      - I2C transfer done (scheduler callback) records the run that was
+//        sent and starts the next run of the frame.
+//
+//    Three copies of the display are kept:
+//      - g_lcd_svc_commit what the application committed last
+//      - g_lcd_svc_frame  the frame being sent
+//      - g_lcd_svc_glass  what is known to be on the display
+//
+//-----------------------------------------------------------------------------
+// DISCLAIMER
+//    This code was developed for educational purposes as part of the CSC202
+//    course at Monroe Community Collage and is provided "as is" without
+//    warranties of any kind, whether express, implied, or statutory.
+//
+//    The author and organization do not warrant the accuracy, completeness, or
+//    reliability of the code. The author and organization shall not be liable
+//    for any direct, indirect, incidental, special, exemplary, or consequential
+//    damages arising out of the use of or inability to use the code, even if
+//    advised of the possibility of such damages.
+//
+//    Use of this code is at your own risk, and it is recommended to validate
+//    and adapt the code for your specific application and hardware
+//    requirements.
+//
+// Copyright (c) 2026 by Bruce Link
+//    You may use, edit, run or distribute this file as long as the above
+//    copyright notice remains
+// *****************************************************************************
+//******************************************************************************
+
+//-----------------------------------------------------------------------------
+// Load standard C include files
+//-----------------------------------------------------------------------------
+#include <stdint.h>
+#include <string.h>
+
+//-----------------------------------------------------------------------------
+// Loads MSP launchpad board support macros and definitions
+//-----------------------------------------------------------------------------
+#include <ti/devices/msp/msp.h>
+#include "LaunchPad.h"
+#include "clock.h"
+#include "i2c_sched.h"
+#include "lcd1602.h"
+#include "lcd_fb.h"
+#include "lcd_service.h"
+
+
+//-----------------------------------------------------------------------------
+// Define symbolic constants used by the module
+//-----------------------------------------------------------------------------
+#define LCD_SVC_ADDR_UNKNOWN                                              (0xFF)
+
+// Largest LOAD value of the 16-bit TIMA1 counter
+#define LCD_SVC_MAX_LOAD                                                (0xFFFF)
+
+// States of the refresh state machine
+#define LCD_SVC_STATE_IDLE                                                   (0)
+#define LCD_SVC_STATE_SENDING                                                (1)
+
+
+//-----------------------------------------------------------------------------
+// Define global variables and structures here.
+// NOTE: when possible avoid using global variables
+//-----------------------------------------------------------------------------
+static char g_lcd_svc_commit[LINES_PER_LCD][CHARACTERS_PER_LCD_LINE];
+static char g_lcd_svc_frame[LINES_PER_LCD][CHARACTERS_PER_LCD_LINE];
+static char g_lcd_svc_glass[LINES_PER_LCD][CHARACTERS_PER_LCD_LINE];
+
+static volatile uint8_t  g_lcd_svc_state       = LCD_SVC_STATE_IDLE;
+static volatile bool     g_lcd_svc_committed   = false;
+static volatile uint32_t g_lcd_svc_frame_count = 0;
+static volatile uint32_t g_lcd_svc_error_count = 0;
+static uint8_t           g_lcd_svc_client      = I2C_SCHED_INVALID_CLIENT;
+static uint8_t           g_lcd_svc_addr        = LCD_SVC_ADDR_UNKNOWN;
+
+// Position of the scan and the run that is on the bus
+static uint8_t g_lcd_svc_row       = 0;
+static uint8_t g_lcd_svc_col       = 0;
+static uint8_t g_lcd_svc_run_start = 0;
+static uint8_t g_lcd_svc_run_len   = 0;
+
+static pcf8574_seq_struct g_lcd_svc_seq;
+static i2c_sched_xfer_t   g_lcd_svc_xfer;
+
+static const uint8_t g_lcd_svc_line_addr[LINES_PER_LCD] = {
+        LCD_LINE1_ADDR, LCD_LINE2_ADDR
+};
+
+
+//-----------------------------------------------------------------------------
+// Define function prototypes used by the module
+//-----------------------------------------------------------------------------
+static void lcd_service_next_run(void);
+static void lcd_service_xfer_done(i2c_sched_xfer_t *xfer);
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function starts the LCD service. The display is cleared, the
+//    service registers as a low priority client of the I2C bus scheduler
+//    and TIMA1 is started to generate the refresh tick.
+//
+// INPUT PARAMETERS:
+//    max_refresh_hz - maximum number of frames per second
+//                     (LCD_SERVICE_MIN_REFRESH_HZ to
+//                      LCD_SERVICE_MAX_REFRESH_HZ)
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    true if the service started, false if no scheduler client was free
+// -----------------------------------------------------------------------------
+bool lcd_service_init(uint8_t max_refresh_hz)
+{
+  g_lcd_svc_client = I2C_sched_register(LCD_SERVICE_I2C_PRIORITY,
+                                        LCD_SERVICE_I2C_SHARE);
+  if (g_lcd_svc_client == I2C_SCHED_INVALID_CLIENT)
+  {
+    return false;
+  } /* if */
+
+  // Start from a known blank display, then keep the blocking writes off
+  // the bus while the service owns it
+  lcd_clear();
+  lcd1602_set_locked(true);
+  memset(g_lcd_svc_commit, ' ', sizeof(g_lcd_svc_commit));
+  memset(g_lcd_svc_frame, ' ', sizeof(g_lcd_svc_frame));
+  memset(g_lcd_svc_glass, ' ', sizeof(g_lcd_svc_glass));
+  g_lcd_svc_addr        = LCD_LINE1_ADDR;
+  g_lcd_svc_state       = LCD_SVC_STATE_IDLE;
+  g_lcd_svc_committed   = false;
+  g_lcd_svc_frame_count = 0;
+  g_lcd_svc_error_count = 0;
+
+  memset(&g_lcd_svc_xfer, 0, sizeof(g_lcd_svc_xfer));
+  g_lcd_svc_xfer.callback = lcd_service_xfer_done;
+
+  // Reset the timer
+  LCD_SERVICE_TIMER_INST->GPRCM.RSTCTL = (GPTIMER_RSTCTL_KEY_UNLOCK_W |
+        GPTIMER_RSTCTL_RESETSTKYCLR_CLR | GPTIMER_RSTCTL_RESETASSERT_ASSERT);
+
+  // Enable power to the timer
+  LCD_SERVICE_TIMER_INST->GPRCM.PWREN = (GPTIMER_PWREN_KEY_UNLOCK_W |
+        GPTIMER_PWREN_ENABLE_ENABLE);
+
+  clock_delay(PERIPHERAL_PWR_UP_DELAY);
+
+  // Timer clock = BUSCLK / 8 / LCD_SERVICE_TIMER_PRESCALE
+  LCD_SERVICE_TIMER_INST->CLKSEL = (GPTIMER_CLKSEL_BUSCLK_SEL_ENABLE |
+        GPTIMER_CLKSEL_MFCLK_SEL_DISABLE | GPTIMER_CLKSEL_LFCLK_SEL_DISABLE);
+  LCD_SERVICE_TIMER_INST->CLKDIV = GPTIMER_CLKDIV_RATIO_DIV_BY_8;
+  LCD_SERVICE_TIMER_INST->COMMONREGS.CPS = GPTIMER_CPS_PCNT_MASK &
+        (LCD_SERVICE_TIMER_PRESCALE - 1);
+
+  // Count down from LOAD and reload, one zero event per refresh tick
+  LCD_SERVICE_TIMER_INST->COUNTERREGS.CTRCTL = (GPTIMER_CTRCTL_CVAE_LDVAL |
+        GPTIMER_CTRCTL_CM_DOWN | GPTIMER_CTRCTL_REPEAT_REPEAT_1);
+  lcd_service_set_rate(max_refresh_hz);
+
+  LCD_SERVICE_TIMER_INST->CPU_INT.ICLR = GPTIMER_CPU_INT_ICLR_Z_CLR;
+  LCD_SERVICE_TIMER_INST->CPU_INT.IMASK = GPTIMER_CPU_INT_IMASK_Z_SET;
+
+  NVIC_ClearPendingIRQ(LCD_SERVICE_TIMER_INT_IRQN);
+  NVIC_EnableIRQ(LCD_SERVICE_TIMER_INT_IRQN);
+
+  // Enable the clock and start counting
+  LCD_SERVICE_TIMER_INST->COMMONREGS.CCLKCTL = GPTIMER_CCLKCTL_CLKEN_ENABLED;
+  LCD_SERVICE_TIMER_INST->COUNTERREGS.CTRCTL |= GPTIMER_CTRCTL_EN_ENABLED;
+
+  return true;
+
+} /* lcd_service_init */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function sets the maximum refresh rate. The value is clamped to
+//    LCD_SERVICE_MIN_REFRESH_HZ .. LCD_SERVICE_MAX_REFRESH_HZ, and raised
+//    if the tick period at the current bus clock would not fit in the
+//    16-bit timer. A frame with many changes can take longer than one
+//    tick, in which case the next frame starts on the first tick after it
+//    is finished.
+//
+// INPUT PARAMETERS:
+//    max_refresh_hz - maximum number of frames per second
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    none
+// -----------------------------------------------------------------------------
+void lcd_service_set_rate(uint8_t max_refresh_hz)
+{
+  uint32_t timer_clock = get_bus_clock_freq() / 8 / LCD_SERVICE_TIMER_PRESCALE;
+  uint32_t load;
+
+  if (max_refresh_hz < LCD_SERVICE_MIN_REFRESH_HZ)
+  {
+    max_refresh_hz = LCD_SERVICE_MIN_REFRESH_HZ;
+  }
+  else if (max_refresh_hz > LCD_SERVICE_MAX_REFRESH_HZ)
+  {
+    max_refresh_hz = LCD_SERVICE_MAX_REFRESH_HZ;
+  } /* if */
+
+  load = (timer_clock / max_refresh_hz) - 1;
+  if (load > LCD_SVC_MAX_LOAD)
+  {
+    load = LCD_SVC_MAX_LOAD;
+  } /* if */
+
+  LCD_SERVICE_TIMER_INST->COUNTERREGS.LOAD = load;
+
+} /* lcd_service_set_rate */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function commits the frame buffer (lcd_fb_put_*) as the next frame
+//    to show. It only copies 32 characters and returns immediately.
+//
+// INPUT PARAMETERS:
+//    none
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    none
+// -----------------------------------------------------------------------------
+void lcd_service_commit(void)
+{
+  uint32_t primask;
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+
+  lcd_fb_copy(&g_lcd_svc_commit[0][0]);
+  g_lcd_svc_committed = true;
+
+  __set_PRIMASK(primask);
+
+} /* lcd_service_commit */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function returns true while a frame is being sent or a committed
+//    frame is waiting for the next tick.
+//
+// INPUT PARAMETERS:
+//    none
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    true if the service has work to do, false if the display is up to date
+// -----------------------------------------------------------------------------
+bool lcd_service_busy(void)
+{
+  return (g_lcd_svc_committed || (g_lcd_svc_state != LCD_SVC_STATE_IDLE));
+} /* lcd_service_busy */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    These functions return the number of frames sent to the display and
+//    the number of runs that failed. A failed run makes the service rewrite
+//    the whole display with the next frame.
+//
+// INPUT PARAMETERS:
+//    none
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    number of frames or errors
+// -----------------------------------------------------------------------------
+uint32_t lcd_service_get_frame_count(void)
+{
+  return (g_lcd_svc_frame_count);
+} /* lcd_service_get_frame_count */
+
+uint32_t lcd_service_get_error_count(void)
+{
+  return (g_lcd_svc_error_count);
+} /* lcd_service_get_error_count */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function finds the next run of changed characters in the frame,
+//    starting at the current scan position, and queues it on the I2C bus.
+//    Runs are extended over single unchanged characters like lcd_fb_flush.
+//    When no changed characters are left the frame is finished and the
+//    state machine goes back to idle.
+//
+// INPUT PARAMETERS:
+//    none
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    none
+// -----------------------------------------------------------------------------
+static void lcd_service_next_run(void)
+{
+  uint8_t  row;
+  uint8_t  col;
+  uint8_t  end;
+  uint8_t  gap;
+  uint8_t  addr;
+  uint32_t status;
+
+  for (row = g_lcd_svc_row; row < LINES_PER_LCD; row++)
+  {
+    col = (row == g_lcd_svc_row) ? g_lcd_svc_col : 0;
+
+    // Find the first changed character on this line
+    while ((col < CHARACTERS_PER_LCD_LINE) &&
+           (g_lcd_svc_frame[row][col] == g_lcd_svc_glass[row][col]))
+    {
+      col++;
+    } /* while */
+
+    if (col >= CHARACTERS_PER_LCD_LINE)
+    {
+      continue;
+    } /* if */
+
+    // Extend the run while the gaps are cheaper to rewrite than to skip
+    g_lcd_svc_run_start = col;
+    end = col;
+    gap = 0;
+    for (col = col + 1; col < CHARACTERS_PER_LCD_LINE; col++)
+    {
+      if (g_lcd_svc_frame[row][col] != g_lcd_svc_glass[row][col])
+      {
+        end = col;
+        gap = 0;
+      }
+      else if (++gap > LCD_FB_MAX_REWRITE_GAP)
+      {
+        break;
+      } /* if */
+    } /* for */
+
+    g_lcd_svc_row     = row;
+    g_lcd_svc_col     = end + 1;
+    g_lcd_svc_run_len = end - g_lcd_svc_run_start + 1;
+
+    addr = g_lcd_svc_line_addr[row] + g_lcd_svc_run_start;
+    lcd1602_encode_run(&g_lcd_svc_seq,
+                       (g_lcd_svc_addr == addr) ? LCD_NO_ADDRESS : addr,
+                       &g_lcd_svc_frame[row][g_lcd_svc_run_start],
+                       g_lcd_svc_run_len);
+
+    g_lcd_svc_state = LCD_SVC_STATE_SENDING;
+    status = I2C_sched_write(g_lcd_svc_client, &g_lcd_svc_xfer,
+                             LCD_IIC_ADDRESS, g_lcd_svc_seq.data,
+                             g_lcd_svc_seq.length);
+    if (status != I2C_SUCCESS)
+    {
+      // Not queued, give up on this frame and rewrite it next time
+      g_lcd_svc_error_count++;
+      memset(g_lcd_svc_glass, 0, sizeof(g_lcd_svc_glass));
+      g_lcd_svc_addr  = LCD_SVC_ADDR_UNKNOWN;
+      g_lcd_svc_committed = true;
+      g_lcd_svc_state = LCD_SVC_STATE_IDLE;
+    } /* if */
+
+    return;
+  } /* for */
+
+  // Nothing left to send, the frame is on the display
+  g_lcd_svc_frame_count++;
+  g_lcd_svc_state = LCD_SVC_STATE_IDLE;
+
+} /* lcd_service_next_run */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function is called by the I2C bus scheduler, from interrupt
+//    context, when a run has been sent. On success the run is recorded as
+//    being on the display and the next run is started. On failure the
+//    display contents are unknown, so the glass copy is cleared to a value
+//    that forces a full rewrite and the frame is ended. The last committed
+//    frame is sent again from the first row on the next tick.
+//
+// INPUT PARAMETERS:
+//    xfer - pointer to the transaction that is done
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    none
+// -----------------------------------------------------------------------------
+static void lcd_service_xfer_done(i2c_sched_xfer_t *xfer)
+{
+  uint8_t row   = g_lcd_svc_row;
+  uint8_t start = g_lcd_svc_run_start;
+
+  if (xfer->status == I2C_SUCCESS)
+  {
+    pcf8574_seq_complete(&g_lcd_svc_seq);
+    memcpy(&g_lcd_svc_glass[row][start], &g_lcd_svc_frame[row][start],
+           g_lcd_svc_run_len);
+    g_lcd_svc_addr = g_lcd_svc_line_addr[row] + start + g_lcd_svc_run_len;
+  }
+  else
+  {
+    // Give up on this frame and rewrite the whole display next time
+    g_lcd_svc_error_count++;
+    memset(g_lcd_svc_glass, 0, sizeof(g_lcd_svc_glass));
+    g_lcd_svc_addr      = LCD_SVC_ADDR_UNKNOWN;
+    g_lcd_svc_committed = true;
+    g_lcd_svc_state     = LCD_SVC_STATE_IDLE;
+    return;
+  } /* if */
+
+  lcd_service_next_run();
+
+} /* lcd_service_xfer_done */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    Refresh tick interrupt service routine. It first lets the I2C bus
+//    scheduler end a run that is stuck on the bus. If the previous frame is
+//    done and a new frame has been committed, the committed frame is copied
+//    and sending starts with its first changed run.
+//
+// INPUT PARAMETERS:
+//    none
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    none
+// -----------------------------------------------------------------------------
+void LCD_SERVICE_TIMER_IRQHandler(void)
+{
+  if (LCD_SERVICE_TIMER_INST->CPU_INT.IIDX != GPTIMER_CPU_INT_IIDX_STAT_Z)
+  {
+    return;
+  } /* if */
+
+  I2C_sched_tick();
+
+  if ((g_lcd_svc_state == LCD_SVC_STATE_IDLE) && g_lcd_svc_committed)
+  {
+    memcpy(g_lcd_svc_frame, g_lcd_svc_commit, sizeof(g_lcd_svc_frame));
+    g_lcd_svc_committed = false;
+    g_lcd_svc_row = 0;
+    g_lcd_svc_col = 0;
+
+    lcd_service_next_run();
+  } /* if */
+
+} /* LCD_SERVICE_TIMER_IRQHandler */
@@ -0,0 +1,96 @@
+// *****************************************************************************
+// ***************************    C Source Code     ****************************
+// *****************************************************************************
+//   DESIGNER NAME:  Bruce Link
+//
+//         VERSION:  1.0
+//
+//       FILE NAME:  lcd_service.h
+//
+//-----------------------------------------------------------------------------
+// DESCRIPTION
+//    This module is a background refresh service for the LCD1602 display.
+//    Once it is started the service owns the display and the main loop
+//    never waits on it:
+//      - The application draws into the frame buffer (lcd_fb_put_*) at any
+//        time and calls lcd_service_commit() when a frame is complete.
+//      - A timer tick, at most max_refresh_hz times a second, picks up the
+//        last committed frame.
+//      - The changed characters are sent one run at a time as scheduled
+//        I2C DMA transfers. The completion of each transfer starts the next
+//        run, so the CPU only runs a few short interrupts per frame.
+//
+//    Only committed frames are shown, so a half drawn frame never reaches
+//    the display (no tearing). Frames committed faster than the refresh
+//    rate are merged, only the last one is shown.
+//
+//    NOTE: lcd1602_init(), I2C_dma_init() and I2C_sched_init() must be
+//          called first. Once the service is running it locks the blocking
+//          lcd_* writes with lcd1602_set_locked(): they return I2C_ERR_BUSY
+//          and the backlight functions do nothing. This covers
+//          lcd_fb_flush() and the CGRAM loads of lcd_glyph and lcd_bar, so
+//          glyphs have to be loaded before the service is started.
+//
+//-----------------------------------------------------------------------------
+// DISCLAIMER
+//    This code was developed for educational purposes as part of the CSC202
+//    course at Monroe Community Collage and is provided "as is" without
+//    warranties of any kind, whether express, implied, or statutory.
+//
+//    The author and organization do not warrant the accuracy, completeness, or
+//    reliability of the code. The author and organization shall not be liable
+//    for any direct, indirect, incidental, special, exemplary, or consequential
+//    damages arising out of the use of or inability to use the code, even if
+//    advised of the possibility of such damages.
+//
+//    Use of this code is at your own risk, and it is recommended to validate
+//    and adapt the code for your specific application and hardware
+//    requirements.
+//
+// Copyright (c) 2026 by Bruce Link
+//    You may use, edit, run or distribute this file as long as the above
+//    copyright notice remains
+// *****************************************************************************
+//******************************************************************************
+
+#ifndef __LCD_SERVICE_H__
+#define __LCD_SERVICE_H__
+
+//-----------------------------------------------------------------------------
+// Load standard C include files
+//-----------------------------------------------------------------------------
+#include <stdint.h>
+#include <stdbool.h>
+
+//-----------------------------------------------------------------------------
+// Define symbolic constants used by the module
+//-----------------------------------------------------------------------------
+#define LCD_SERVICE_TIMER_INST                                             TIMA1
+#define LCD_SERVICE_TIMER_IRQHandler                            TIMA1_IRQHandler
+#define LCD_SERVICE_TIMER_INT_IRQN                                TIMA1_INT_IRQn
+
+// Timer clock is BUSCLK / 8 / LCD_SERVICE_TIMER_PRESCALE (20kHz at 40MHz)
+#define LCD_SERVICE_TIMER_PRESCALE                                         (250)
+
+// Refresh rate limits in frames per second. The 16-bit TIMA1 counter also
+// limits the lowest rate to BUSCLK / 8 / LCD_SERVICE_TIMER_PRESCALE / 65536,
+// which is below 1Hz up to a 130MHz bus clock.
+#define LCD_SERVICE_MIN_REFRESH_HZ                                           (1)
+#define LCD_SERVICE_MAX_REFRESH_HZ                                         (100)
+
+// Bus scheduler client settings: low priority, background traffic
+#define LCD_SERVICE_I2C_PRIORITY                                             (3)
+#define LCD_SERVICE_I2C_SHARE                                                (1)
+
+
+// ----------------------------------------------------------------------------
+// Prototype for support functions
+// ----------------------------------------------------------------------------
+bool lcd_service_init(uint8_t max_refresh_hz);
+void lcd_service_set_rate(uint8_t max_refresh_hz);
+void lcd_service_commit(void);
+bool lcd_service_busy(void);
+uint32_t lcd_service_get_frame_count(void);
+uint32_t lcd_service_get_error_count(void);
+
+#endif /* __LCD_SERVICE_H__ */
@@ -0,0 +1,502 @@
+// *****************************************************************************
+// ***************************    C Source Code     ****************************
+// *****************************************************************************
+//   DESIGNER NAME:  Bruce Link
+//
+//         VERSION:  1.0
+//
+//       FILE NAME:  led_anim.c
+//
+//-----------------------------------------------------------------------------
+// DESCRIPTION
+//    This file contains the LED animation sequencer. See led_anim.h for the
+//    script format, the targets and how to drive the tick.
+//
+//
+//-----------------------------------------------------------------------------
+// DISCLAIMER
+//    This code was developed for educational purposes as part of the CSC202
+//    course at Monroe Community Collage and is provided "as is" without
+//    warranties of any kind, whether express, implied, or statutory.
+//
+//    The author and organization do not warrant the accuracy, completeness, or
+//    reliability of the code. The author and organization shall not be liable
+//    for any direct, indirect, incidental, special, exemplary, or consequential
+//    damages arising out of the use of or inability to use the code, even if
+//    advised of the possibility of such damages.
+//
+//    Use of this code is at your own risk, and it is recommended to validate
+//    and adapt the code for your specific application and hardware
+//    requirements.
+//
+// Copyright (c) 2026 by Bruce Link
+//    You may use, edit, run or distribute this file as long as the above
+//    copyright notice remains
+// *****************************************************************************
+//******************************************************************************
+
+//-----------------------------------------------------------------------------
+// Load standard C include files
+//-----------------------------------------------------------------------------
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+//-----------------------------------------------------------------------------
+// Loads MSP launchpad board support macros and definitions
+//-----------------------------------------------------------------------------
+#include <ti/devices/msp/msp.h>
+#include "LaunchPad.h"
+#include "led_anim.h"
+#include "seg7_service.h"
+
+
+//-----------------------------------------------------------------------------
+// Define symbolic constants used by the module
+//-----------------------------------------------------------------------------
+// Steps without a frame run in one tick before a script is taken as
+// looping on itself and is stopped
+#define LED_ANIM_MAX_OPS_PER_TICK                                            (8)
+
+// Colors of the RGB LED, from LP_RGB_RED_LED_IDX
+#define LED_ANIM_RGB_COLORS                                                  (3)
+
+
+//-----------------------------------------------------------------------------
+// Define function prototypes used by the module
+//-----------------------------------------------------------------------------
+static void led_anim_run(uint8_t target);
+static bool led_anim_loop(uint8_t target, uint8_t count);
+static void led_anim_next(uint8_t target);
+static void led_anim_show(uint8_t target, uint8_t frame);
+
+
+//-----------------------------------------------------------------------------
+// Define global variables and structures here.
+// NOTE: when possible avoid using global variables
+//-----------------------------------------------------------------------------
+
+// Define a structure to hold a counted loop that is running
+typedef struct
+{
+  uint8_t step;               // step of the LED_ANIM_LOOP
+  uint8_t loops;              // repeats done so far
+} led_anim_loop_t;
+
+// Define a structure to hold the state of the animation of a target
+typedef struct
+{
+  const led_anim_step_t *script;      // steps of the animation
+  uint8_t                step;        // step being shown
+  uint8_t                ticks_left;  // ticks until the next frame
+  uint8_t                level;       // LEDs lit by the current ramp
+  uint8_t                depth;       // counted loops running
+  led_anim_loop_t        loop[LED_ANIM_MAX_LOOP_DEPTH];
+  volatile bool          running;     // animation is playing
+} led_anim_chan_t;
+
+static led_anim_chan_t g_led_anim_chans[LED_ANIM_NUM_TARGETS];
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function starts the animation service with no animations
+//    playing. The animations move on each time led_anim_tick() is called.
+//
+// INPUT PARAMETERS:
+//    none
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    none
+// -----------------------------------------------------------------------------
+void led_anim_init(void)
+{
+  for (uint8_t target = 0; target < LED_ANIM_NUM_TARGETS; target++)
+  {
+    g_led_anim_chans[target].running = false;
+  } /* for */
+
+} /* led_anim_init */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function stops every animation. The LEDs are left as they are.
+//
+// INPUT PARAMETERS:
+//    none
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    none
+// -----------------------------------------------------------------------------
+void led_anim_deinit(void)
+{
+  for (uint8_t target = 0; target < LED_ANIM_NUM_TARGETS; target++)
+  {
+    g_led_anim_chans[target].running = false;
+  } /* for */
+
+} /* led_anim_deinit */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function starts an animation on a target, replacing the one that
+//    is playing. The first frame is shown before it returns. The script is
+//    not copied, it must stay in memory (const data in flash) while it
+//    plays.
+//
+// INPUT PARAMETERS:
+//    target - LED_ANIM_LED_BAR, LED_ANIM_SEG7_LEDS, LED_ANIM_LP_LED or
+//             LED_ANIM_LP_RGB
+//    script - steps of the animation
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    true if the animation was started, false if a parameter is not valid
+// -----------------------------------------------------------------------------
+bool led_anim_start(uint8_t target, const led_anim_step_t script[])
+{
+  led_anim_chan_t *chan;
+  uint32_t         primask;
+
+  if ((target >= LED_ANIM_NUM_TARGETS) || (script == NULL))
+  {
+    return (false);
+  } /* if */
+
+  chan    = &g_led_anim_chans[target];
+  primask = __get_PRIMASK();
+  __disable_irq();
+
+  chan->script  = script;
+  chan->step    = 0;
+  chan->depth   = 0;
+  chan->running = true;
+  led_anim_run(target);
+
+  __set_PRIMASK(primask);
+
+  return (true);
+
+} /* led_anim_start */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function stops the animation of a target.
+//
+// INPUT PARAMETERS:
+//    target - LED_ANIM_x target
+//    clear  - true to turn the LEDs of the target off, false to leave the
+//             last frame shown
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    none
+// -----------------------------------------------------------------------------
+void led_anim_stop(uint8_t target, bool clear)
+{
+  uint32_t primask;
+
+  if (target >= LED_ANIM_NUM_TARGETS)
+  {
+    return;
+  } /* if */
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+
+  g_led_anim_chans[target].running = false;
+  if (clear)
+  {
+    led_anim_show(target, 0);
+  } /* if */
+
+  __set_PRIMASK(primask);
+
+} /* led_anim_stop */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function tells if the animation of a target is still playing. An
+//    animation stops at its LED_ANIM_END() step.
+//
+// INPUT PARAMETERS:
+//    target - LED_ANIM_x target
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    true if the animation is playing
+// -----------------------------------------------------------------------------
+bool led_anim_running(uint8_t target)
+{
+  return ((target < LED_ANIM_NUM_TARGETS) &&
+          g_led_anim_chans[target].running);
+} /* led_anim_running */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function runs the steps of an animation from the current step
+//    until one shows a frame or the script ends. A script that runs
+//    LED_ANIM_MAX_OPS_PER_TICK steps without a frame (a loop with no frame
+//    in it) is stopped.
+//
+// INPUT PARAMETERS:
+//    target - LED_ANIM_x target
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    none
+// -----------------------------------------------------------------------------
+static void led_anim_run(uint8_t target)
+{
+  led_anim_chan_t       *chan = &g_led_anim_chans[target];
+  const led_anim_step_t *step;
+
+  for (uint8_t ops = 0; ops < LED_ANIM_MAX_OPS_PER_TICK; ops++)
+  {
+    step = &chan->script[chan->step];
+
+    switch (step->op)
+    {
+      case LED_ANIM_OP_FRAME:
+        led_anim_show(target, step->arg1);
+        chan->ticks_left = (step->ticks != 0) ? step->ticks : 1;
+        return;
+
+      case LED_ANIM_OP_RAMP:
+        chan->level = step->arg1;
+        led_anim_show(target, (uint8_t)((1U << chan->level) - 1));
+        chan->ticks_left = (step->ticks != 0) ? step->ticks : 1;
+        return;
+
+      case LED_ANIM_OP_LOOP:
+        if (step->arg2 == 0)
+        {
+          chan->step = step->arg1;
+        }
+        else if (led_anim_loop(target, step->arg2))
+        {
+          chan->step = step->arg1;
+        }
+        else if (chan->running)
+        {
+          chan->step++;
+        }
+        else
+        {
+          return;
+        } /* if */
+        break;
+
+      default:
+        chan->running = false;
+        return;
+    } /* switch */
+  } /* for */
+
+  chan->running = false;
+
+} /* led_anim_run */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function counts a pass through the counted LED_ANIM_LOOP at the
+//    current step. The first pass starts a count for the loop, on top of
+//    the ones of the loops around it, and the count is dropped when the
+//    loop is done so the loop starts over the next time an outer loop
+//    reaches it. Counts above the loop (inner loops left by a jump) are
+//    dropped too. A loop nested deeper than LED_ANIM_MAX_LOOP_DEPTH stops
+//    the animation.
+//
+// INPUT PARAMETERS:
+//    target - LED_ANIM_x target
+//    count  - number of times the loop repeats
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    true to go back to the start of the loop, false when it is done (or
+//    the animation was stopped)
+// -----------------------------------------------------------------------------
+static bool led_anim_loop(uint8_t target, uint8_t count)
+{
+  led_anim_chan_t *chan  = &g_led_anim_chans[target];
+  uint8_t          level = chan->depth;
+
+  while ((level > 0) && (chan->loop[level - 1].step != chan->step))
+  {
+    level--;
+  } /* while */
+
+  if (level == 0)
+  {
+    if (chan->depth >= LED_ANIM_MAX_LOOP_DEPTH)
+    {
+      chan->running = false;
+      return (false);
+    } /* if */
+
+    chan->loop[chan->depth].step  = chan->step;
+    chan->loop[chan->depth].loops = 1;
+    chan->depth++;
+    return (true);
+  } /* if */
+
+  chan->depth = level;
+  if (chan->loop[level - 1].loops < count)
+  {
+    chan->loop[level - 1].loops++;
+    return (true);
+  } /* if */
+
+  chan->depth = level - 1;
+  return (false);
+
+} /* led_anim_loop */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function moves an animation on when the time of its frame is
+//    up. A ramp that has not reached its last level lights one more (or
+//    one less) LED, otherwise the next step is run.
+//
+// INPUT PARAMETERS:
+//    target - LED_ANIM_x target
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    none
+// -----------------------------------------------------------------------------
+static void led_anim_next(uint8_t target)
+{
+  led_anim_chan_t       *chan = &g_led_anim_chans[target];
+  const led_anim_step_t *step = &chan->script[chan->step];
+
+  if ((step->op == LED_ANIM_OP_RAMP) && (chan->level != step->arg2))
+  {
+    if (chan->level < step->arg2)
+    {
+      chan->level++;
+    }
+    else
+    {
+      chan->level--;
+    } /* if */
+
+    led_anim_show(target, (uint8_t)((1U << chan->level) - 1));
+    chan->ticks_left = (step->ticks != 0) ? step->ticks : 1;
+    return;
+  } /* if */
+
+  chan->step++;
+  led_anim_run(target);
+
+} /* led_anim_next */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function writes a frame to the LEDs of a target.
+//
+// INPUT PARAMETERS:
+//    target - LED_ANIM_x target
+//    frame  - bit n turns LED n of the target on
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    none
+// -----------------------------------------------------------------------------
+static void led_anim_show(uint8_t target, uint8_t frame)
+{
+  switch (target)
+  {
+    case LED_ANIM_LED_BAR:
+      leds_on(frame);
+      break;
+
+    case LED_ANIM_SEG7_LEDS:
+      seg7_service_set_leds(frame);
+      break;
+
+    case LED_ANIM_LP_LED:
+      if ((frame & 0x01) != 0)
+      {
+        lp_leds_on(LP_RED_LED1_IDX);
+      }
+      else
+      {
+        lp_leds_off(LP_RED_LED1_IDX);
+      } /* if */
+      break;
+
+    default:
+      for (uint8_t color = 0; color < LED_ANIM_RGB_COLORS; color++)
+      {
+        if ((frame & (1U << color)) != 0)
+        {
+          lp_leds_on(LP_RGB_RED_LED_IDX + color);
+        }
+        else
+        {
+          lp_leds_off(LP_RGB_RED_LED_IDX + color);
+        } /* if */
+      } /* for */
+      break;
+  } /* switch */
+
+} /* led_anim_show */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function is the animation tick, to be called every
+//    LED_ANIM_TICK_MSEC from a periodic interrupt (SysTick_Handler() for
+//    example). The frame time of each playing animation is counted down,
+//    and it is moved on when the time is up.
+//
+// INPUT PARAMETERS:
+//    none
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    none
+// -----------------------------------------------------------------------------
+void led_anim_tick(void)
+{
+  for (uint8_t target = 0; target < LED_ANIM_NUM_TARGETS; target++)
+  {
+    if (g_led_anim_chans[target].running &&
+        (--g_led_anim_chans[target].ticks_left == 0))
+    {
+      led_anim_next(target);
+    } /* if */
+  } /* for */
+
+} /* led_anim_tick */
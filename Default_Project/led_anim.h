@@ -0,0 +1,154 @@
+// *****************************************************************************
+// ***************************    C Source Code     ****************************
+// *****************************************************************************
+//   DESIGNER NAME:  Bruce Link
+//
+//         VERSION:  1.0
+//
+//       FILE NAME:  led_anim.h
+//
+//-----------------------------------------------------------------------------
+// DESCRIPTION
+//    This module plays LED animations (chasers, blink patterns, bar graph
+//    meters) from a periodic interrupt, so the application starts or stops
+//    them and returns at once instead of calling msec_delay() between
+//    LED writes. The module has no timer of its own: the application calls
+//    led_anim_tick() every LED_ANIM_TICK_MSEC from an interrupt it already
+//    has, such as SysTick_Handler() set up with sys_tick_init().
+//
+//    An animation is a script of 4-byte steps, kept in flash:
+//
+//      LED_ANIM_FRAME(mask, msec)     show the LEDs set in mask for msec
+//      LED_ANIM_RAMP(from, to, msec)  show a bar graph of from LEDs, then
+//                                     one more (or less) every msec until
+//                                     it shows to LEDs
+//      LED_ANIM_LOOP(step, count)     go back to step, count more times
+//                                     (0 repeats forever)
+//      LED_ANIM_END()                 stop, leaving the last frame shown
+//
+//    Times are rounded up to LED_ANIM_TICK_MSEC and are at most
+//    LED_ANIM_MAX_MSEC. Counted loops can be nested up to
+//    LED_ANIM_MAX_LOOP_DEPTH deep, each keeps its own count. A script that
+//    nests them deeper is stopped.
+//
+//    Each target has its own animation, and they all run at once:
+//
+//      LED_ANIM_LED_BAR    the 8 LEDs of the LED bar, written with leds_on()
+//      LED_ANIM_SEG7_LEDS  the LED bar, written with seg7_service_set_leds()
+//                          for when the seven-segment service is running
+//      LED_ANIM_LP_LED     the red LED of the LaunchPad, bit 0
+//      LED_ANIM_LP_RGB     the LaunchPad RGB LED, bit 0 red, 1 green, 2 blue
+//
+//    Example, a chaser that bounces 3 times then fills the bar:
+//
+//      static const led_anim_step_t chase[] = {
+//        LED_ANIM_FRAME(0x01, 50), LED_ANIM_FRAME(0x02, 50),
+//        ...
+//        LED_ANIM_FRAME(0x02, 50), LED_ANIM_LOOP(0, 3),
+//        LED_ANIM_RAMP(0, 8, 100), LED_ANIM_END()
+//      };
+//
+//      void SysTick_Handler(void)
+//      {
+//        led_anim_tick();
+//      }
+//
+//      led_anim_init();
+//      sys_tick_init((get_bus_clock_freq() / MSEC_PER_SECOND) *
+//                    LED_ANIM_TICK_MSEC);
+//      led_anim_start(LED_ANIM_LED_BAR, chase);
+//
+//    NOTE: The pins of a target must be set up by the application
+//          (leds_init() and leds_enable(), lp_leds_init() or
+//          seg7_service_init()) before its animation is started.
+//
+//-----------------------------------------------------------------------------
+// DISCLAIMER
+//    This code was developed for educational purposes as part of the CSC202
+//    course at Monroe Community Collage and is provided "as is" without
+//    warranties of any kind, whether express, implied, or statutory.
+//
+//    The author and organization do not warrant the accuracy, completeness, or
+//    reliability of the code. The author and organization shall not be liable
+//    for any direct, indirect, incidental, special, exemplary, or consequential
+//    damages arising out of the use of or inability to use the code, even if
+//    advised of the possibility of such damages.
+//
+//    Use of this code is at your own risk, and it is recommended to validate
+//    and adapt the code for your specific application and hardware
+//    requirements.
+//
+// Copyright (c) 2026 by Bruce Link
+//    You may use, edit, run or distribute this file as long as the above
+//    copyright notice remains
+// *****************************************************************************
+//******************************************************************************
+
+#ifndef __LED_ANIM_H__
+#define __LED_ANIM_H__
+
+//-----------------------------------------------------------------------------
+// Load standard C include files
+//-----------------------------------------------------------------------------
+#include <stdint.h>
+#include <stdbool.h>
+
+//-----------------------------------------------------------------------------
+// Define symbolic constants used by the module
+//-----------------------------------------------------------------------------
+// Time between animation updates (led_anim_tick() calls), and the longest
+// time of a step
+#define LED_ANIM_TICK_MSEC                                                  (10)
+#define LED_ANIM_MAX_MSEC                             (LED_ANIM_TICK_MSEC * 255)
+
+// Counted loops that can be running at once in a script
+#define LED_ANIM_MAX_LOOP_DEPTH                                              (4)
+
+// Animation targets
+#define LED_ANIM_LED_BAR                                                     (0)
+#define LED_ANIM_SEG7_LEDS                                                   (1)
+#define LED_ANIM_LP_LED                                                      (2)
+#define LED_ANIM_LP_RGB                                                      (3)
+#define LED_ANIM_NUM_TARGETS                                                 (4)
+
+// Step op codes
+#define LED_ANIM_OP_END                                                      (0)
+#define LED_ANIM_OP_FRAME                                                    (1)
+#define LED_ANIM_OP_RAMP                                                     (2)
+#define LED_ANIM_OP_LOOP                                                     (3)
+
+// Convert a time in ms to ticks, rounded up
+#define LED_ANIM_TICKS(msec)                                                  \
+        ((uint8_t)(((msec) + LED_ANIM_TICK_MSEC - 1) / LED_ANIM_TICK_MSEC))
+
+// Build the steps of a script
+#define LED_ANIM_FRAME(mask, msec)                                            \
+        {LED_ANIM_OP_FRAME, (mask), 0, LED_ANIM_TICKS(msec)}
+#define LED_ANIM_RAMP(from, to, msec)                                         \
+        {LED_ANIM_OP_RAMP, (from), (to), LED_ANIM_TICKS(msec)}
+#define LED_ANIM_LOOP(step, count)                                            \
+        {LED_ANIM_OP_LOOP, (step), (count), 0}
+#define LED_ANIM_END()                                                        \
+        {LED_ANIM_OP_END, 0, 0, 0}
+
+// Define a structure to hold one step of a script
+typedef struct
+{
+  uint8_t op;                 // LED_ANIM_OP_x
+  uint8_t arg1;               // frame mask, ramp start or loop step
+  uint8_t arg2;               // ramp end or loop count
+  uint8_t ticks;              // time of the frame or of each ramp level
+} led_anim_step_t;
+
+
+// ----------------------------------------------------------------------------
+// Prototype for support functions
+// ----------------------------------------------------------------------------
+void led_anim_init(void);
+void led_anim_deinit(void);
+void led_anim_tick(void);
+bool led_anim_start(uint8_t target, const led_anim_step_t script[]);
+void led_anim_stop(uint8_t target, bool clear);
+bool led_anim_running(uint8_t target);
+
+#endif /* __LED_ANIM_H__ */
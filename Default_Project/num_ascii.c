@@ -0,0 +1,328 @@
+// *****************************************************************************
+// ***************************    C Source Code     ****************************
+// *****************************************************************************
+//   DESIGNER NAME:  Bruce Link
+//
+//         VERSION:  1.0
+//
+//       FILE NAME:  num_ascii.c
+//
+//-----------------------------------------------------------------------------
+// DESCRIPTION
+//    This file contains the divide free number to ASCII conversions. See
+//    num_ascii.h for the output format.
+//
+//-----------------------------------------------------------------------------
+// DISCLAIMER
+//    This code was developed for educational purposes as part of the CSC202
+//    course at Monroe Community Collage and is provided "as is" without
+//    warranties of any kind, whether express, implied, or statutory.
+//
+//    The author and organization do not warrant the accuracy, completeness, or
+//    reliability of the code. The author and organization shall not be liable
+//    for any direct, indirect, incidental, special, exemplary, or consequential
+//    damages arising out of the use of or inability to use the code, even if
+//    advised of the possibility of such damages.
+//
+//    Use of this code is at your own risk, and it is recommended to validate
+//    and adapt the code for your specific application and hardware
+//    requirements.
+//
+// Copyright (c) 2026 by Bruce Link
+//    You may use, edit, run or distribute this file as long as the above
+//    copyright notice remains
+// *****************************************************************************
+//******************************************************************************
+
+//-----------------------------------------------------------------------------
+// Load standard C include files
+//-----------------------------------------------------------------------------
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+//-----------------------------------------------------------------------------
+// Loads MSP launchpad board support macros and definitions
+//-----------------------------------------------------------------------------
+#include "num_ascii.h"
+
+
+//-----------------------------------------------------------------------------
+// Define global variables and structures here.
+// NOTE: when possible avoid using global variables
+//-----------------------------------------------------------------------------
+
+// ASCII digit pairs "00" to "99", entry n is at offset 2 * n
+static const char g_digit_pairs[200] =
+        "00010203040506070809" "10111213141516171819"
+        "20212223242526272829" "30313233343536373839"
+        "40414243444546474849" "50515253545556575859"
+        "60616263646566676869" "70717273747576777879"
+        "80818283848586878889" "90919293949596979899";
+
+
+//-----------------------------------------------------------------------------
+// Define function prototypes used by the module
+//-----------------------------------------------------------------------------
+static uint32_t num_ascii_div100(uint32_t value);
+static char *num_ascii_digits(uint32_t value, char *end);
+static void num_ascii_unsigned(uint32_t value, uint8_t width, char *string);
+static void num_ascii_signed(int32_t value, uint8_t width, char *string);
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    These functions convert an unsigned or signed 8, 16 or 32-bit value to
+//    a right-justified, space padded, NULL terminated string. The string
+//    must have room for NUM_ASCII_xx_WIDTH characters plus the terminator.
+//
+// INPUT PARAMETERS:
+//    value  - the number to convert
+//
+// OUTPUT PARAMETERS:
+//    string - the converted number
+//
+// RETURN:
+//    none
+// -----------------------------------------------------------------------------
+void u8_to_ascii(uint8_t value, char *string)
+{
+  num_ascii_unsigned(value, NUM_ASCII_U8_WIDTH, string);
+} /* u8_to_ascii */
+
+void u16_to_ascii(uint16_t value, char *string)
+{
+  num_ascii_unsigned(value, NUM_ASCII_U16_WIDTH, string);
+} /* u16_to_ascii */
+
+void u32_to_ascii(uint32_t value, char *string)
+{
+  num_ascii_unsigned(value, NUM_ASCII_U32_WIDTH, string);
+} /* u32_to_ascii */
+
+void s8_to_ascii(int8_t value, char *string)
+{
+  num_ascii_signed(value, NUM_ASCII_S8_WIDTH, string);
+} /* s8_to_ascii */
+
+void s16_to_ascii(int16_t value, char *string)
+{
+  num_ascii_signed(value, NUM_ASCII_S16_WIDTH, string);
+} /* s16_to_ascii */
+
+void s32_to_ascii(int32_t value, char *string)
+{
+  num_ascii_signed(value, NUM_ASCII_S32_WIDTH, string);
+} /* s32_to_ascii */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function converts a fixed-point decimal to a right-justified,
+//    space padded, NULL terminated string. The value is an integer scaled
+//    by 10^frac_digits, for example 2537 with 2 fraction digits is 25.37.
+//    Values below 1 get a leading zero ("0.05"). If the number does not fit
+//    in the field, the field is filled with '*'.
+//
+// INPUT PARAMETERS:
+//    value       - the scaled number to convert
+//    frac_digits - digits after the decimal point (0 for none,
+//                  up to NUM_ASCII_MAX_FRAC_DIGITS)
+//    width       - size of the field in characters
+//
+// OUTPUT PARAMETERS:
+//    string      - the converted number, width characters plus terminator
+//
+// RETURN:
+//    true if the number fits in the field, false otherwise
+// -----------------------------------------------------------------------------
+bool fixed_to_ascii(int32_t value, uint8_t frac_digits, uint8_t width,
+     char *string)
+{
+  char     digits[NUM_ASCII_U32_WIDTH];
+  char    *end = &digits[NUM_ASCII_U32_WIDTH];
+  char    *first = end;
+  char    *out;
+  uint32_t magnitude;
+  uint16_t length;
+  bool     negative = (value < 0);
+
+  magnitude = negative ? (0u - (uint32_t)value) : (uint32_t)value;
+
+  if (frac_digits > NUM_ASCII_MAX_FRAC_DIGITS)
+  {
+    length = width + 1;
+  }
+  else
+  {
+    // Zero fill so there is at least one digit before the point
+    first = num_ascii_digits(magnitude, end);
+    while ((end - first) <= frac_digits)
+    {
+      *--first = '0';
+    } /* while */
+
+    length = (end - first) + negative + (frac_digits != 0);
+  } /* else */
+
+  string[width] = '\0';
+  if (length > width)
+  {
+    memset(string, '*', width);
+    return false;
+  } /* if */
+
+  // Fill the field from the right: fraction, point, integer part, sign
+  out = &string[width];
+  for (uint8_t digit_idx = 0; digit_idx < frac_digits; digit_idx++)
+  {
+    *--out = *--end;
+  } /* for */
+
+  if (frac_digits != 0)
+  {
+    *--out = '.';
+  } /* if */
+
+  while (end > first)
+  {
+    *--out = *--end;
+  } /* while */
+
+  if (negative)
+  {
+    *--out = '-';
+  } /* if */
+
+  memset(string, ' ', out - string);
+
+  return true;
+
+} /* fixed_to_ascii */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function divides a 32-bit value by 100 without a divide. Small
+//    values use one multiply and a shift. Larger values use the shift and
+//    add approximation of 1/100 from Hacker's Delight, followed by a one
+//    step correction. The result is exact for every 32-bit input.
+//
+// INPUT PARAMETERS:
+//    value - the dividend
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    value / 100
+// -----------------------------------------------------------------------------
+static uint32_t num_ascii_div100(uint32_t value)
+{
+  uint32_t quotient;
+
+  if (value < NUM_ASCII_MUL_LIMIT)
+  {
+    return ((value * NUM_ASCII_DIV100_MUL) >> NUM_ASCII_DIV100_SHIFT);
+  } /* if */
+
+  quotient = (value >> 1) + (value >> 3) + (value >> 6) - (value >> 10) +
+             (value >> 12) + (value >> 13) - (value >> 16);
+  quotient = quotient + (quotient >> 20);
+  quotient = quotient >> 6;
+
+  // The estimate is low by at most one
+  return (quotient + (((value - quotient * 100) + 28) >> 7));
+
+} /* num_ascii_div100 */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function writes the decimal digits of a value, without leading
+//    zeros, into the characters before end. Zero is written as "0".
+//
+// INPUT PARAMETERS:
+//    value - the number to convert
+//    end   - pointer just past the last digit
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    pointer to the first (most significant) digit
+// -----------------------------------------------------------------------------
+static char *num_ascii_digits(uint32_t value, char *end)
+{
+  uint32_t quotient;
+  uint32_t pair;
+
+  while (value >= 100)
+  {
+    quotient = num_ascii_div100(value);
+    pair     = (value - quotient * 100) << 1;
+    *--end   = g_digit_pairs[pair + 1];
+    *--end   = g_digit_pairs[pair];
+    value    = quotient;
+  } /* while */
+
+  if (value >= 10)
+  {
+    pair   = value << 1;
+    *--end = g_digit_pairs[pair + 1];
+    *--end = g_digit_pairs[pair];
+  }
+  else
+  {
+    *--end = '0' + value;
+  } /* if */
+
+  return (end);
+
+} /* num_ascii_digits */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    These functions fill a field of width characters with a right-justified
+//    number and leading spaces, and NULL terminate it. The field must be
+//    wide enough for the largest value of the type.
+//
+// INPUT PARAMETERS:
+//    value  - the number to convert
+//    width  - size of the field in characters
+//
+// OUTPUT PARAMETERS:
+//    string - the converted number
+//
+// RETURN:
+//    none
+// -----------------------------------------------------------------------------
+static void num_ascii_unsigned(uint32_t value, uint8_t width, char *string)
+{
+  char *first;
+
+  string[width] = '\0';
+  first = num_ascii_digits(value, &string[width]);
+  memset(string, ' ', first - string);
+
+} /* num_ascii_unsigned */
+
+static void num_ascii_signed(int32_t value, uint8_t width, char *string)
+{
+  char *first;
+
+  string[width] = '\0';
+  if (value < 0)
+  {
+    first = num_ascii_digits(0u - (uint32_t)value, &string[width]);
+    *--first = '-';
+  }
+  else
+  {
+    first = num_ascii_digits((uint32_t)value, &string[width]);
+  } /* if */
+
+  memset(string, ' ', first - string);
+
+} /* num_ascii_signed */
@@ -0,0 +1,99 @@
+// *****************************************************************************
+// ***************************    C Source Code     ****************************
+// *****************************************************************************
+//   DESIGNER NAME:  Bruce Link
+//
+//         VERSION:  1.0
+//
+//       FILE NAME:  num_ascii.h
+//
+//-----------------------------------------------------------------------------
+// DESCRIPTION
+//    This module converts integers and fixed-point decimals to ASCII without
+//    using the divide operator. The Cortex-M0+ has no divide instruction,
+//    so every '/' or '%' is a call to a library routine that takes tens of
+//    cycles. Here the digits are produced two at a time:
+//      - the value is divided by 100 with a multiply and a shift (values
+//        below NUM_ASCII_MUL_LIMIT) or with shifts and adds (larger values)
+//      - the remainder (0-99) indexes a table of digit pairs "00".."99"
+//    A 32-bit value takes at most 5 steps instead of 10 library divides.
+//
+//    The output format is the one used by the LCD1602 driver: the number is
+//    right-justified in a fixed width field with leading spaces and the
+//    string is NULL terminated. Signed values put the '-' just before the
+//    first digit.
+//
+//      function        field   example
+//      u8_to_ascii       3     "  7"
+//      u16_to_ascii      5     "  123"
+//      u32_to_ascii     10     "     65536"
+//      s8_to_ascii       4     "-128"
+//      s16_to_ascii      6     "   -42"
+//      s32_to_ascii     11     "-2147483648"
+//      fixed_to_ascii  width   fixed_to_ascii(-1234, 2, 7, s) = " -12.34"
+//
+//-----------------------------------------------------------------------------
+// DISCLAIMER
+//    This code was developed for educational purposes as part of the CSC202
+//    course at Monroe Community Collage and is provided "as is" without
+//    warranties of any kind, whether express, implied, or statutory.
+//
+//    The author and organization do not warrant the accuracy, completeness, or
+//    reliability of the code. The author and organization shall not be liable
+//    for any direct, indirect, incidental, special, exemplary, or consequential
+//    damages arising out of the use of or inability to use the code, even if
+//    advised of the possibility of such damages.
+//
+//    Use of this code is at your own risk, and it is recommended to validate
+//    and adapt the code for your specific application and hardware
+//    requirements.
+//
+// Copyright (c) 2026 by Bruce Link
+//    You may use, edit, run or distribute this file as long as the above
+//    copyright notice remains
+// *****************************************************************************
+//******************************************************************************
+
+#ifndef __NUM_ASCII_H__
+#define __NUM_ASCII_H__
+
+//-----------------------------------------------------------------------------
+// Load standard C include files
+//-----------------------------------------------------------------------------
+#include <stdint.h>
+#include <stdbool.h>
+
+//-----------------------------------------------------------------------------
+// Define symbolic constants used by the module
+//-----------------------------------------------------------------------------
+
+// Field widths, not counting the NULL terminator
+#define NUM_ASCII_U8_WIDTH                                                   (3)
+#define NUM_ASCII_U16_WIDTH                                                  (5)
+#define NUM_ASCII_U32_WIDTH                                                 (10)
+#define NUM_ASCII_S8_WIDTH                                                   (4)
+#define NUM_ASCII_S16_WIDTH                                                  (6)
+#define NUM_ASCII_S32_WIDTH                                                 (11)
+
+// Maximum number of digits after the decimal point for fixed_to_ascii
+#define NUM_ASCII_MAX_FRAC_DIGITS                                            (9)
+
+// Below this value (x * 5243) >> 19 is exactly x / 100
+#define NUM_ASCII_MUL_LIMIT                                              (43699)
+#define NUM_ASCII_DIV100_MUL                                              (5243)
+#define NUM_ASCII_DIV100_SHIFT                                              (19)
+
+
+// ----------------------------------------------------------------------------
+// Prototype for support functions
+// ----------------------------------------------------------------------------
+void u8_to_ascii(uint8_t value, char *string);
+void u16_to_ascii(uint16_t value, char *string);
+void u32_to_ascii(uint32_t value, char *string);
+void s8_to_ascii(int8_t value, char *string);
+void s16_to_ascii(int16_t value, char *string);
+void s32_to_ascii(int32_t value, char *string);
+bool fixed_to_ascii(int32_t value, uint8_t frac_digits, uint8_t width,
+     char *string);
+
+#endif /* __NUM_ASCII_H__ */
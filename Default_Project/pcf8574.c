@@ -0,0 +1,418 @@
+// *****************************************************************************
+// ***************************    C Source Code     ****************************
+// *****************************************************************************
+//   DESIGNER NAME:  Bruce Link
+//
+//         VERSION:  1.0
+//
+//       FILE NAME:  pcf8574.c
+//
+//-----------------------------------------------------------------------------
+// DESCRIPTION
+//    This file contains the PCF8574 I/O expander driver. See pcf8574.h for
+//    a description of the output shadow and of pin sequences.
+//
+//-----------------------------------------------------------------------------
+// DISCLAIMER
+//    This code was developed for educational purposes as part of the CSC202
+//    course at Monroe Community Collage and is provided "as is" without
+//    warranties of any kind, whether express, implied, or statutory.
+//
+//    The author and organization do not warrant the accuracy, completeness, or
+//    reliability of the code. The author and organization shall not be liable
+//    for any direct, indirect, incidental, special, exemplary, or consequential
+//    damages arising out of the use of or inability to use the code, even if
+//    advised of the possibility of such damages.
+//
+//    Use of this code is at your own risk, and it is recommended to validate
+//    and adapt the code for your specific application and hardware
+//    requirements.
+//
+// Copyright (c) 2026 by Bruce Link
+//    You may use, edit, run or distribute this file as long as the above
+//    copyright notice remains
+// *****************************************************************************
+//******************************************************************************
+
+//-----------------------------------------------------------------------------
+// Load standard C include files
+//-----------------------------------------------------------------------------
+#include <stdint.h>
+#include <stdio.h>
+
+//-----------------------------------------------------------------------------
+// Loads MSP launchpad board support macros and definitions
+//-----------------------------------------------------------------------------
+#include <ti/devices/msp/msp.h>
+#include "LaunchPad.h"
+#include "pcf8574.h"
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function sets up the state of a PCF8574 device and writes the
+//    initial value to its port.
+//
+// INPUT PARAMETERS:
+//    dev        - pointer to the structure that holds the device state
+//    iic_addr   - 7-bit I2C address of the device
+//    value      - initial value of the output port
+//    input_mask - pins that are used as inputs
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    I2C status code of the write (I2C_SUCCESS if the device answered)
+// -----------------------------------------------------------------------------
+uint32_t pcf8574_init(pcf8574_struct *dev, uint8_t iic_addr, uint8_t value,
+         uint8_t input_mask)
+{
+  dev->iic_addr   = iic_addr;
+  dev->input_mask = input_mask;
+  dev->pending    = value | input_mask;
+  dev->shadow     = dev->pending;
+
+  return (I2C_mstr_send1(dev->iic_addr, dev->shadow));
+
+} /* pcf8574_init */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    These functions change bits of the output shadow. Nothing is sent to
+//    the device until pcf8574_update() is called, so several changes are
+//    sent as one byte.
+//
+//    A scheduled sequence can finish, and call pcf8574_seq_complete(), from
+//    interrupt context at any time. Each read-modify-write of the shadow is
+//    therefore done with interrupts disabled.
+//
+// INPUT PARAMETERS:
+//    dev   - pointer to the structure that holds the device state
+//    mask  - bits to set, clear, toggle or assign
+//    value - new level of the bits in mask (pcf8574_assign_bits only)
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    none
+// -----------------------------------------------------------------------------
+void pcf8574_set_bits(pcf8574_struct *dev, uint8_t mask)
+{
+  uint32_t primask;
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  dev->pending |= mask;
+  __set_PRIMASK(primask);
+
+} /* pcf8574_set_bits */
+
+void pcf8574_clear_bits(pcf8574_struct *dev, uint8_t mask)
+{
+  uint32_t primask;
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  dev->pending &= ~(mask & ~dev->input_mask);
+  __set_PRIMASK(primask);
+
+} /* pcf8574_clear_bits */
+
+void pcf8574_toggle_bits(pcf8574_struct *dev, uint8_t mask)
+{
+  uint32_t primask;
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  dev->pending ^= (mask & ~dev->input_mask);
+  __set_PRIMASK(primask);
+
+} /* pcf8574_toggle_bits */
+
+void pcf8574_assign_bits(pcf8574_struct *dev, uint8_t mask, uint8_t value)
+{
+  uint32_t primask;
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  dev->pending = (dev->pending & ~mask) | (value & mask) | dev->input_mask;
+  __set_PRIMASK(primask);
+
+} /* pcf8574_assign_bits */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function returns the value of the output shadow, including changes
+//    that have not been sent yet.
+//
+// INPUT PARAMETERS:
+//    dev - pointer to the structure that holds the device state
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    value of the output shadow
+// -----------------------------------------------------------------------------
+uint8_t pcf8574_get_output(const pcf8574_struct *dev)
+{
+  return (dev->pending);
+} /* pcf8574_get_output */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function sends the output shadow to the device if it differs from
+//    the value last written. All bit changes made since the last update go
+//    out in a single I2C byte.
+//
+// INPUT PARAMETERS:
+//    dev - pointer to the structure that holds the device state
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    I2C_SUCCESS if nothing had to be sent, otherwise the I2C status code
+// -----------------------------------------------------------------------------
+uint32_t pcf8574_update(pcf8574_struct *dev)
+{
+  uint32_t status = I2C_SUCCESS;
+  uint32_t primask;
+  uint8_t  value;
+
+  // Send a snapshot, later changes stay pending for the next update
+  primask = __get_PRIMASK();
+  __disable_irq();
+  value = dev->pending;
+  __set_PRIMASK(primask);
+
+  if (value != dev->shadow)
+  {
+    status = I2C_mstr_send1(dev->iic_addr, value);
+    if (status == I2C_SUCCESS)
+    {
+      dev->shadow = value;
+    } /* if */
+  } /* if */
+
+  return (status);
+
+} /* pcf8574_update */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function replaces the whole output port value and sends it if it
+//    differs from the value last written.
+//
+// INPUT PARAMETERS:
+//    dev   - pointer to the structure that holds the device state
+//    value - new value of the output port
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    I2C_SUCCESS if nothing had to be sent, otherwise the I2C status code
+// -----------------------------------------------------------------------------
+uint32_t pcf8574_write(pcf8574_struct *dev, uint8_t value)
+{
+  pcf8574_assign_bits(dev, 0xFF, value);
+
+  return (pcf8574_update(dev));
+
+} /* pcf8574_write */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function reads the level of the 8 pins of the device. Only the
+//    bits in input_mask (or output pins written high) are meaningful.
+//
+// INPUT PARAMETERS:
+//    dev   - pointer to the structure that holds the device state
+//
+// OUTPUT PARAMETERS:
+//    value - level of the pins
+//
+// RETURN:
+//    I2C status code of the read
+// -----------------------------------------------------------------------------
+uint32_t pcf8574_read(pcf8574_struct *dev, uint8_t *value)
+{
+  return (I2C_mstr_read1(dev->iic_addr, value));
+} /* pcf8574_read */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function starts recording a new sequence of port states for a
+//    device. The sequence starts from the current output shadow.
+//
+// INPUT PARAMETERS:
+//    seq - pointer to the sequence
+//    dev - pointer to the structure that holds the device state
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    none
+// -----------------------------------------------------------------------------
+void pcf8574_seq_begin(pcf8574_seq_struct *seq, pcf8574_struct *dev)
+{
+  seq->dev    = dev;
+  seq->state  = dev->pending;
+  seq->owned  = 0;
+  seq->length = 0;
+} /* pcf8574_seq_begin */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    These functions add one port state to a sequence:
+//      - pcf8574_seq_put   adds a complete port value
+//      - pcf8574_seq_set   adds the last state with the bits in mask set
+//      - pcf8574_seq_clear adds the last state with the bits in mask cleared
+//
+// INPUT PARAMETERS:
+//    seq   - pointer to the sequence
+//    value - port value (pcf8574_seq_put)
+//    mask  - bits to change (pcf8574_seq_set and pcf8574_seq_clear)
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    true if the state was added, false if the sequence is full
+// -----------------------------------------------------------------------------
+bool pcf8574_seq_put(pcf8574_seq_struct *seq, uint8_t value)
+{
+  if (seq->length >= PCF8574_MAX_SEQ_LENGTH)
+  {
+    return false;
+  } /* if */
+
+  value |= seq->dev->input_mask;
+  seq->owned |= (uint8_t)(seq->state ^ value);
+  seq->state  = value;
+  seq->data[seq->length++] = value;
+
+  return true;
+
+} /* pcf8574_seq_put */
+
+bool pcf8574_seq_set(pcf8574_seq_struct *seq, uint8_t mask)
+{
+  return (pcf8574_seq_put(seq, seq->state | mask));
+} /* pcf8574_seq_set */
+
+bool pcf8574_seq_clear(pcf8574_seq_struct *seq, uint8_t mask)
+{
+  return (pcf8574_seq_put(seq, seq->state & ~mask));
+} /* pcf8574_seq_clear */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function repeats the last state of a sequence to hold the pins
+//    for longer. Each repeat adds one byte time (about 90us at 100kHz).
+//
+// INPUT PARAMETERS:
+//    seq   - pointer to the sequence
+//    count - number of extra byte times to hold the state
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    true if the states were added, false if the sequence is full
+// -----------------------------------------------------------------------------
+bool pcf8574_seq_hold(pcf8574_seq_struct *seq, uint8_t count)
+{
+  bool added = true;
+
+  while ((count-- > 0) && added)
+  {
+    added = pcf8574_seq_put(seq, seq->state);
+  } /* while */
+
+  return (added);
+
+} /* pcf8574_seq_hold */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function sends all the states of a sequence to the device in one
+//    I2C transaction. After a successful send the output shadow holds the
+//    last state of the sequence. An empty sequence is not sent.
+//
+// INPUT PARAMETERS:
+//    seq - pointer to the sequence
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    I2C status code of the burst
+// -----------------------------------------------------------------------------
+uint32_t pcf8574_seq_send(pcf8574_seq_struct *seq)
+{
+  uint32_t status = I2C_SUCCESS;
+
+  if (seq->length > 0)
+  {
+    status = I2C_mstr_send_stream(seq->dev->iic_addr, seq->data, seq->length);
+    if (status == I2C_SUCCESS)
+    {
+      pcf8574_seq_complete(seq);
+    } /* if */
+  } /* if */
+
+  seq->length = 0;
+
+  return (status);
+
+} /* pcf8574_seq_send */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function records the last state of a sequence in the output
+//    shadow of the device. pcf8574_seq_send() calls it after a successful
+//    send. Code that sends seq->data itself (for example with a DMA or
+//    scheduled I2C transfer) calls it once the transfer has succeeded.
+//
+//    The port now holds the last state of the sequence, so that is the new
+//    shadow. Only the bits the sequence changed are taken into the pending
+//    value. Changes the caller made to the other bits while the sequence
+//    was on the bus are kept, and sent by the next pcf8574_update().
+//
+// INPUT PARAMETERS:
+//    seq - pointer to the sequence that was sent
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    none
+// -----------------------------------------------------------------------------
+void pcf8574_seq_complete(pcf8574_seq_struct *seq)
+{
+  pcf8574_struct *dev = seq->dev;
+  uint32_t primask;
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  dev->shadow  = seq->state;
+  dev->pending = (uint8_t)((dev->pending & ~seq->owned) |
+                           (seq->state & seq->owned));
+  __set_PRIMASK(primask);
+
+} /* pcf8574_seq_complete */
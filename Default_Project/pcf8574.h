@@ -0,0 +1,110 @@
+// *****************************************************************************
+// ***************************    C Source Code     ****************************
+// *****************************************************************************
+//   DESIGNER NAME:  Bruce Link
+//
+//         VERSION:  1.0
+//
+//       FILE NAME:  pcf8574.h
+//
+//-----------------------------------------------------------------------------
+// DESCRIPTION
+//    This module is a driver for the PCF8574 8-bit I2C I/O expander (used
+//    on the LCD1602 backpack and on common relay and button boards). The
+//    PCF8574 has no registers: every byte written over I2C is latched on the
+//    8 pins and a read returns the level of the 8 pins.
+//
+//    The driver keeps a shadow of the output port so single pins can be
+//    set, cleared or toggled without rebuilding the whole byte:
+//      - pcf8574_set_bits() etc. only change the shadow. Any number of
+//        changes are sent as a single byte by pcf8574_update(), and no byte
+//        is sent at all if the port already has the wanted value.
+//      - A sequence (pcf8574_seq_*) records a list of port states, for
+//        example the steps of an enable strobe, and sends them as one
+//        multi-byte I2C burst. Each byte takes 9 SCL clocks (90us at
+//        100kHz) so the bus itself times the steps.
+//
+//    Pins used as inputs are listed in input_mask and are always written
+//    high (the weak pull-up state the PCF8574 needs to read a pin).
+//
+//-----------------------------------------------------------------------------
+// DISCLAIMER
+//    This code was developed for educational purposes as part of the CSC202
+//    course at Monroe Community Collage and is provided "as is" without
+//    warranties of any kind, whether express, implied, or statutory.
+//
+//    The author and organization do not warrant the accuracy, completeness, or
+//    reliability of the code. The author and organization shall not be liable
+//    for any direct, indirect, incidental, special, exemplary, or consequential
+//    damages arising out of the use of or inability to use the code, even if
+//    advised of the possibility of such damages.
+//
+//    Use of this code is at your own risk, and it is recommended to validate
+//    and adapt the code for your specific application and hardware
+//    requirements.
+//
+// Copyright (c) 2026 by Bruce Link
+//    You may use, edit, run or distribute this file as long as the above
+//    copyright notice remains
+// *****************************************************************************
+//******************************************************************************
+
+#ifndef __PCF8574_H__
+#define __PCF8574_H__
+
+//-----------------------------------------------------------------------------
+// Load standard C include files
+//-----------------------------------------------------------------------------
+#include <stdint.h>
+#include <stdbool.h>
+
+//-----------------------------------------------------------------------------
+// Define symbolic constants used by the module
+//-----------------------------------------------------------------------------
+
+// Maximum number of port states in one sequence (one I2C burst)
+#define PCF8574_MAX_SEQ_LENGTH                                              (96)
+
+// Define a structure to hold the state of one PCF8574 device
+typedef struct
+{
+  uint8_t iic_addr;           // 7-bit I2C address
+  uint8_t shadow;             // value last written to the port
+  uint8_t pending;            // value including changes not yet sent
+  uint8_t input_mask;         // pins used as inputs (always written high)
+} pcf8574_struct;
+
+// Define a structure to hold a sequence of port states
+typedef struct
+{
+  pcf8574_struct *dev;
+  uint8_t         state;      // last state added to the sequence
+  uint8_t         owned;      // bits the sequence changes from its start
+  uint16_t        length;
+  uint8_t         data[PCF8574_MAX_SEQ_LENGTH];
+} pcf8574_seq_struct;
+
+
+// ----------------------------------------------------------------------------
+// Prototype for support functions
+// ----------------------------------------------------------------------------
+uint32_t pcf8574_init(pcf8574_struct *dev, uint8_t iic_addr, uint8_t value,
+         uint8_t input_mask);
+void pcf8574_set_bits(pcf8574_struct *dev, uint8_t mask);
+void pcf8574_clear_bits(pcf8574_struct *dev, uint8_t mask);
+void pcf8574_toggle_bits(pcf8574_struct *dev, uint8_t mask);
+void pcf8574_assign_bits(pcf8574_struct *dev, uint8_t mask, uint8_t value);
+uint8_t pcf8574_get_output(const pcf8574_struct *dev);
+uint32_t pcf8574_update(pcf8574_struct *dev);
+uint32_t pcf8574_write(pcf8574_struct *dev, uint8_t value);
+uint32_t pcf8574_read(pcf8574_struct *dev, uint8_t *value);
+
+void pcf8574_seq_begin(pcf8574_seq_struct *seq, pcf8574_struct *dev);
+bool pcf8574_seq_put(pcf8574_seq_struct *seq, uint8_t value);
+bool pcf8574_seq_set(pcf8574_seq_struct *seq, uint8_t mask);
+bool pcf8574_seq_clear(pcf8574_seq_struct *seq, uint8_t mask);
+bool pcf8574_seq_hold(pcf8574_seq_struct *seq, uint8_t count);
+uint32_t pcf8574_seq_send(pcf8574_seq_struct *seq);
+void pcf8574_seq_complete(pcf8574_seq_struct *seq);
+
+#endif /* __PCF8574_H__ */
@@ -0,0 +1,663 @@
+// *****************************************************************************
+// ***************************    C Source Code     ****************************
+// *****************************************************************************
+//   DESIGNER NAME:  Bruce Link
+//
+//         VERSION:  1.0
+//
+//       FILE NAME:  rgb_pwm.c
+//
+//-----------------------------------------------------------------------------
+// DESCRIPTION
+//    This file contains the PWM color engine of the LaunchPad RGB LED. See
+//    rgb_pwm.h for how the channels are driven.
+//
+//
+//-----------------------------------------------------------------------------
+// DISCLAIMER
+//    This code was developed for educational purposes as part of the CSC202
+//    course at Monroe Community Collage and is provided "as is" without
+//    warranties of any kind, whether express, implied, or statutory.
+//
+//    The author and organization do not warrant the accuracy, completeness, or
+//    reliability of the code. The author and organization shall not be liable
+//    for any direct, indirect, incidental, special, exemplary, or consequential
+//    damages arising out of the use of or inability to use the code, even if
+//    advised of the possibility of such damages.
+//
+//    Use of this code is at your own risk, and it is recommended to validate
+//    and adapt the code for your specific application and hardware
+//    requirements.
+//
+// Copyright (c) 2026 by Bruce Link
+//    You may use, edit, run or distribute this file as long as the above
+//    copyright notice remains
+// *****************************************************************************
+//******************************************************************************
+
+//-----------------------------------------------------------------------------
+// Load standard C include files
+//-----------------------------------------------------------------------------
+#include <stdint.h>
+#include <stdbool.h>
+
+//-----------------------------------------------------------------------------
+// Loads MSP launchpad board support macros and definitions
+//-----------------------------------------------------------------------------
+#include <ti/devices/msp/msp.h>
+#include "LaunchPad.h"
+#include "clock.h"
+#include "rgb_pwm.h"
+
+
+//-----------------------------------------------------------------------------
+// Define symbolic constants used by the module
+//-----------------------------------------------------------------------------
+// Channels, red and green are also the TIMG6 capture/compare index
+#define RGB_PWM_RED                                                          (0)
+#define RGB_PWM_GRN                                                          (1)
+#define RGB_PWM_BLU                                                          (2)
+#define RGB_PWM_NUM_CHANNELS                                                 (3)
+
+// Bits of a channel in a 24-bit color, and the fraction bits of a fade
+#define RGB_PWM_CHANNEL_BITS                                                 (8)
+#define RGB_PWM_CHANNEL_MASK                                              (0xFF)
+#define RGB_PWM_FADE_FRAC_BITS                                               (8)
+#define RGB_PWM_LEVEL_MAX                                                  (255)
+
+
+//-----------------------------------------------------------------------------
+// Define function prototypes used by the module
+//-----------------------------------------------------------------------------
+static void rgb_pwm_timer_init(GPTIMER_Regs *timer, uint32_t outputs);
+static void rgb_pwm_write(uint8_t chan, uint8_t level);
+static void rgb_pwm_irq_update(void);
+static void rgb_pwm_fade_step(void);
+static uint8_t rgb_pwm_div255(uint32_t value);
+
+
+//-----------------------------------------------------------------------------
+// Define global variables and structures here.
+// NOTE: when possible avoid using global variables
+//-----------------------------------------------------------------------------
+
+// PWM duty in timer counts for each level, gamma 2.2. Level 255 is
+// RGB_PWM_PERIOD, which the counter never reaches, so the output stays on.
+static const uint16_t g_rgb_pwm_gamma[RGB_PWM_LEVEL_MAX + 1] = {
+     0,    1,    1,    1,    1,    1,    1,    2,    2,    3,    3,    4,
+     5,    6,    7,    8,    9,   11,   12,   14,   15,   17,   19,   21,
+    23,   25,   27,   29,   32,   34,   37,   40,   43,   46,   49,   52,
+    55,   59,   62,   66,   70,   73,   77,   82,   86,   90,   95,   99,
+   104,  109,  114,  119,  124,  129,  135,  140,  146,  152,  158,  164,
+   170,  176,  182,  189,  196,  202,  209,  216,  224,  231,  238,  246,
+   254,  261,  269,  277,  286,  294,  302,  311,  320,  329,  338,  347,
+   356,  365,  375,  385,  394,  404,  414,  424,  435,  445,  456,  467,
+   477,  489,  500,  511,  522,  534,  546,  557,  569,  582,  594,  606,
+   619,  631,  644,  657,  670,  684,  697,  710,  724,  738,  752,  766,
+   780,  795,  809,  824,  838,  853,  869,  884,  899,  915,  930,  946,
+   962,  978,  994, 1011, 1027, 1044, 1061, 1078, 1095, 1112, 1130, 1147,
+  1165, 1183, 1201, 1219, 1238, 1256, 1275, 1293, 1312, 1331, 1351, 1370,
+  1389, 1409, 1429, 1449, 1469, 1489, 1510, 1530, 1551, 1572, 1593, 1614,
+  1636, 1657, 1679, 1700, 1722, 1745, 1767, 1789, 1812, 1834, 1857, 1880,
+  1904, 1927, 1950, 1974, 1998, 2022, 2046, 2070, 2095, 2119, 2144, 2169,
+  2194, 2219, 2245, 2270, 2296, 2322, 2348, 2374, 2400, 2427, 2453, 2480,
+  2507, 2534, 2561, 2589, 2616, 2644, 2672, 2700, 2728, 2757, 2785, 2814,
+  2843, 2872, 2901, 2931, 2960, 2990, 3020, 3050, 3080, 3110, 3141, 3171,
+  3202, 3233, 3264, 3295, 3327, 3359, 3390, 3422, 3454, 3487, 3519, 3552,
+  3585, 3618, 3651, 3684, 3717, 3751, 3785, 3819, 3853, 3887, 3921, 3956,
+  3991, 4026, 4061, 4096
+};
+
+// LP LED index, IOMUX PINCM, timer function, timer and capture/compare
+// index of each channel
+static const uint8_t  g_rgb_pwm_led_idx[RGB_PWM_NUM_CHANNELS] = {
+        LP_RGB_RED_LED_IDX, LP_RGB_GRN_LED_IDX, LP_RGB_BLU_LED_IDX
+};
+static const uint16_t g_rgb_pwm_pin_cm[RGB_PWM_NUM_CHANNELS] = {
+        LP_RGB_RED_IOMUX, LP_RGB_GRN_IOMUX, LP_RGB_BLU_IOMUX
+};
+static const uint32_t g_rgb_pwm_func[RGB_PWM_NUM_CHANNELS] = {
+        RGB_PWM_RED_PINCM_IOMUX_FUNC, RGB_PWM_GRN_PINCM_IOMUX_FUNC,
+        RGB_PWM_BLU_PINCM_IOMUX_FUNC
+};
+static GPTIMER_Regs *const g_rgb_pwm_timer[RGB_PWM_NUM_CHANNELS] = {
+        RGB_PWM_TIMER_INST, RGB_PWM_TIMER_INST, RGB_PWM_BLU_TIMER_INST
+};
+static const uint8_t  g_rgb_pwm_cc_idx[RGB_PWM_NUM_CHANNELS] = {
+        RGB_PWM_RED, RGB_PWM_GRN, RGB_PWM_BLU_CC_IDX
+};
+
+// Level shown on each channel
+static volatile uint8_t g_rgb_pwm_level[RGB_PWM_NUM_CHANNELS];
+
+// Fade position (level with RGB_PWM_FADE_FRAC_BITS fraction bits), change
+// per update and final level of each channel, updates left, and the PWM
+// periods between updates
+static int32_t           g_rgb_pwm_fade_pos[RGB_PWM_NUM_CHANNELS];
+static int32_t           g_rgb_pwm_fade_step[RGB_PWM_NUM_CHANNELS];
+static uint8_t           g_rgb_pwm_fade_end[RGB_PWM_NUM_CHANNELS];
+static volatile uint16_t g_rgb_pwm_fade_left = 0;
+static uint16_t          g_rgb_pwm_fade_periods = 1;
+static uint16_t          g_rgb_pwm_fade_count = 0;
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function starts the RGB color engine with the LED off. The LED
+//    pins are set up with lp_leds_init(), and TIMG6 (red and green) and
+//    RGB_PWM_BLU_TIMER_INST (blue) are started to make the PWM, counting
+//    up from 0 to RGB_PWM_PERIOD - 1. Each output goes high at zero and
+//    low when the count reaches its compare value.
+//
+// INPUT PARAMETERS:
+//    none
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    none
+// -----------------------------------------------------------------------------
+void rgb_pwm_init(void)
+{
+  uint32_t periods = ((get_bus_clock_freq() / RGB_PWM_PERIOD) *
+                      RGB_PWM_FADE_STEP_MSEC) / MSEC_PER_SECOND;
+
+  lp_leds_init();
+
+  g_rgb_pwm_fade_left    = 0;
+  g_rgb_pwm_fade_count   = 0;
+  g_rgb_pwm_fade_periods = (periods != 0) ? (uint16_t)periods : 1;
+
+  rgb_pwm_timer_init(RGB_PWM_TIMER_INST, (GPTIMER_CCPD_C0CCP0_OUTPUT |
+                     GPTIMER_CCPD_C0CCP1_OUTPUT));
+  rgb_pwm_timer_init(RGB_PWM_BLU_TIMER_INST, RGB_PWM_BLU_CCPD_OUTPUT);
+
+  for (uint8_t chan = 0; chan < RGB_PWM_NUM_CHANNELS; chan++)
+  {
+    // On zero set the output high, on compare up set it low
+    g_rgb_pwm_timer[chan]->COUNTERREGS.CCACT_01[g_rgb_pwm_cc_idx[chan]] =
+          (GPTIMER_CCACT_01_FENACT_DISABLED |
+           GPTIMER_CCACT_01_CC2UACT_DISABLED |
+           GPTIMER_CCACT_01_CC2DACT_DISABLED |
+           GPTIMER_CCACT_01_CUACT_CCP_LOW | GPTIMER_CCACT_01_CDACT_DISABLED |
+           GPTIMER_CCACT_01_LACT_DISABLED | GPTIMER_CCACT_01_ZACT_CCP_HIGH);
+
+    g_rgb_pwm_timer[chan]->COUNTERREGS.CC_01[g_rgb_pwm_cc_idx[chan]] = 0;
+
+    g_rgb_pwm_timer[chan]->COUNTERREGS.OCTL_01[g_rgb_pwm_cc_idx[chan]] =
+          (GPTIMER_OCTL_01_CCPIV_LOW | GPTIMER_OCTL_01_CCPOINV_NOINV |
+           GPTIMER_OCTL_01_CCPO_FUNCVAL);
+
+    // Compare mode, a new compare value is used from the next zero so a
+    // period is never cut short
+    g_rgb_pwm_timer[chan]->COUNTERREGS.CCCTL_01[g_rgb_pwm_cc_idx[chan]] =
+          (GPTIMER_CCCTL_01_CCUPD_ZERO_EVT | GPTIMER_CCCTL_01_COC_COMPARE |
+           GPTIMER_CCCTL_01_ZCOND_CC_TRIG_NO_EFFECT |
+           GPTIMER_CCCTL_01_LCOND_CC_TRIG_NO_EFFECT |
+           GPTIMER_CCCTL_01_ACOND_TIMCLK | GPTIMER_CCCTL_01_CCOND_NOCAPTURE);
+
+    rgb_pwm_write(chan, 0);
+  } /* for */
+
+  // The period interrupt is only unmasked when a fade is running
+  RGB_PWM_TIMER_INST->CPU_INT.ICLR = GPTIMER_CPU_INT_ICLR_Z_CLR;
+  RGB_PWM_TIMER_INST->CPU_INT.IMASK = 0;
+
+  NVIC_ClearPendingIRQ(RGB_PWM_TIMER_INT_IRQN);
+  NVIC_EnableIRQ(RGB_PWM_TIMER_INT_IRQN);
+
+  // Enable the clocks and start counting
+  RGB_PWM_BLU_TIMER_INST->COMMONREGS.CCLKCTL = GPTIMER_CCLKCTL_CLKEN_ENABLED;
+  RGB_PWM_TIMER_INST->COMMONREGS.CCLKCTL = GPTIMER_CCLKCTL_CLKEN_ENABLED;
+  RGB_PWM_BLU_TIMER_INST->COUNTERREGS.CTRCTL |= GPTIMER_CTRCTL_EN_ENABLED;
+  RGB_PWM_TIMER_INST->COUNTERREGS.CTRCTL |= GPTIMER_CTRCTL_EN_ENABLED;
+
+} /* rgb_pwm_init */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function stops the timers and gives the LED pins back to the
+//    GPIO, with the LED off, so lp_leds_on() can be used again.
+//
+// INPUT PARAMETERS:
+//    none
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    none
+// -----------------------------------------------------------------------------
+void rgb_pwm_deinit(void)
+{
+  NVIC_DisableIRQ(RGB_PWM_TIMER_INT_IRQN);
+  RGB_PWM_TIMER_INST->COUNTERREGS.CTRCTL &= ~GPTIMER_CTRCTL_EN_MASK;
+  RGB_PWM_BLU_TIMER_INST->COUNTERREGS.CTRCTL &= ~GPTIMER_CTRCTL_EN_MASK;
+  RGB_PWM_TIMER_INST->CPU_INT.IMASK = 0;
+
+  g_rgb_pwm_fade_left = 0;
+  for (uint8_t chan = 0; chan < RGB_PWM_NUM_CHANNELS; chan++)
+  {
+    rgb_pwm_write(chan, 0);
+  } /* for */
+
+} /* rgb_pwm_deinit */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function shows a color at once, stopping any fade.
+//
+// INPUT PARAMETERS:
+//    color - 24-bit color, 0xRRGGBB
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    none
+// -----------------------------------------------------------------------------
+void rgb_pwm_set(uint32_t color)
+{
+  uint32_t primask = __get_PRIMASK();
+
+  __disable_irq();
+
+  g_rgb_pwm_fade_left = 0;
+  for (uint8_t chan = 0; chan < RGB_PWM_NUM_CHANNELS; chan++)
+  {
+    rgb_pwm_write(chan, (color >> ((RGB_PWM_BLU - chan) *
+                         RGB_PWM_CHANNEL_BITS)) & RGB_PWM_CHANNEL_MASK);
+  } /* for */
+  rgb_pwm_irq_update();
+
+  __set_PRIMASK(primask);
+
+} /* rgb_pwm_set */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function shows a color given as hue, saturation and value, see
+//    rgb_pwm_hsv_to_rgb().
+//
+// INPUT PARAMETERS:
+//    hue - position on the color wheel, 0 to RGB_PWM_HUE_STEPS - 1
+//    sat - saturation, 0 (white) to 255 (pure color)
+//    val - value, 0 (off) to 255 (brightest)
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    none
+// -----------------------------------------------------------------------------
+void rgb_pwm_set_hsv(uint16_t hue, uint8_t sat, uint8_t val)
+{
+  rgb_pwm_set(rgb_pwm_hsv_to_rgb(hue, sat, val));
+} /* rgb_pwm_set_hsv */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function starts a fade from the color shown to a new one, and
+//    returns at once. Each channel moves in a straight line, one update
+//    every RGB_PWM_FADE_STEP_MSEC, from the period interrupt. A fade that
+//    is running is replaced, starting from the color it had reached.
+//
+// INPUT PARAMETERS:
+//    color - 24-bit color to end on, 0xRRGGBB
+//    msec  - time of the fade in ms, 0 shows the color at once
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    none
+// -----------------------------------------------------------------------------
+void rgb_pwm_fade_to(uint32_t color, uint16_t msec)
+{
+  uint16_t steps = msec / RGB_PWM_FADE_STEP_MSEC;
+  uint32_t primask;
+  int32_t  pos;
+  uint8_t  end;
+
+  if (steps == 0)
+  {
+    rgb_pwm_set(color);
+    return;
+  } /* if */
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+
+  for (uint8_t chan = 0; chan < RGB_PWM_NUM_CHANNELS; chan++)
+  {
+    end = (color >> ((RGB_PWM_BLU - chan) * RGB_PWM_CHANNEL_BITS)) &
+          RGB_PWM_CHANNEL_MASK;
+    pos = (int32_t)g_rgb_pwm_level[chan] << RGB_PWM_FADE_FRAC_BITS;
+
+    g_rgb_pwm_fade_pos[chan]  = pos;
+    g_rgb_pwm_fade_end[chan]  = end;
+    g_rgb_pwm_fade_step[chan] =
+          (((int32_t)end << RGB_PWM_FADE_FRAC_BITS) - pos) / (int32_t)steps;
+  } /* for */
+
+  g_rgb_pwm_fade_count = 0;
+  g_rgb_pwm_fade_left  = steps;
+  rgb_pwm_irq_update();
+
+  __set_PRIMASK(primask);
+
+} /* rgb_pwm_fade_to */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function tells if a fade is running.
+//
+// INPUT PARAMETERS:
+//    none
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    true until the fade started by rgb_pwm_fade_to() has ended
+// -----------------------------------------------------------------------------
+bool rgb_pwm_fading(void)
+{
+  return (g_rgb_pwm_fade_left != 0);
+} /* rgb_pwm_fading */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function returns the color shown, which changes during a fade.
+//
+// INPUT PARAMETERS:
+//    none
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    24-bit color, 0xRRGGBB
+// -----------------------------------------------------------------------------
+uint32_t rgb_pwm_get(void)
+{
+  return (RGB_PWM_COLOR(g_rgb_pwm_level[RGB_PWM_RED],
+                        g_rgb_pwm_level[RGB_PWM_GRN],
+                        g_rgb_pwm_level[RGB_PWM_BLU]));
+} /* rgb_pwm_get */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function converts hue, saturation and value to a 24-bit color in
+//    fixed point. Hue is split into a sector of the color wheel (the top
+//    bits) and a position in it (the low 8 bits), so only multiplies and
+//    divides by 255 are needed, and they are done with shifts.
+//
+// INPUT PARAMETERS:
+//    hue - position on the color wheel, 0 to RGB_PWM_HUE_STEPS - 1 (larger
+//          values wrap around), 0 is red, 512 green and 1024 blue
+//    sat - saturation, 0 (white) to 255 (pure color)
+//    val - value, 0 (off) to 255 (brightest)
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    24-bit color, 0xRRGGBB
+// -----------------------------------------------------------------------------
+uint32_t rgb_pwm_hsv_to_rgb(uint16_t hue, uint8_t sat, uint8_t val)
+{
+  uint8_t frac;
+  uint8_t p;
+  uint8_t q;
+  uint8_t t;
+
+  if (sat == 0)
+  {
+    return (RGB_PWM_COLOR(val, val, val));
+  } /* if */
+
+  while (hue >= RGB_PWM_HUE_STEPS)
+  {
+    hue -= RGB_PWM_HUE_STEPS;
+  } /* while */
+
+  frac = hue & (RGB_PWM_HUE_SECTOR_STEPS - 1);
+  p = rgb_pwm_div255((uint32_t)val * (RGB_PWM_LEVEL_MAX - sat));
+  q = rgb_pwm_div255((uint32_t)val * (RGB_PWM_LEVEL_MAX -
+                     rgb_pwm_div255((uint32_t)sat * frac)));
+  t = rgb_pwm_div255((uint32_t)val * (RGB_PWM_LEVEL_MAX -
+                     rgb_pwm_div255((uint32_t)sat *
+                                    (RGB_PWM_LEVEL_MAX - frac))));
+
+  switch (hue / RGB_PWM_HUE_SECTOR_STEPS)
+  {
+    case 0:
+      return (RGB_PWM_COLOR(val, t, p));
+
+    case 1:
+      return (RGB_PWM_COLOR(q, val, p));
+
+    case 2:
+      return (RGB_PWM_COLOR(p, val, t));
+
+    case 3:
+      return (RGB_PWM_COLOR(p, q, val));
+
+    case 4:
+      return (RGB_PWM_COLOR(t, p, val));
+
+    default:
+      return (RGB_PWM_COLOR(val, p, q));
+  } /* switch */
+
+} /* rgb_pwm_hsv_to_rgb */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function resets and powers a PWM timer and sets it to count up
+//    from 0 to RGB_PWM_PERIOD - 1 on BUSCLK, without starting it.
+//
+// INPUT PARAMETERS:
+//    timer   - timer to set up
+//    outputs - GPTIMER_CCPD_C0CCPn_OUTPUT bits of the channels it drives
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    none
+// -----------------------------------------------------------------------------
+static void rgb_pwm_timer_init(GPTIMER_Regs *timer, uint32_t outputs)
+{
+  // Reset the timer
+  timer->GPRCM.RSTCTL = (GPTIMER_RSTCTL_KEY_UNLOCK_W |
+        GPTIMER_RSTCTL_RESETSTKYCLR_CLR | GPTIMER_RSTCTL_RESETASSERT_ASSERT);
+
+  // Enable power to the timer
+  timer->GPRCM.PWREN = (GPTIMER_PWREN_KEY_UNLOCK_W |
+        GPTIMER_PWREN_ENABLE_ENABLE);
+
+  clock_delay(PERIPHERAL_PWR_UP_DELAY);
+
+  // Timer clock = BUSCLK
+  timer->CLKSEL = (GPTIMER_CLKSEL_BUSCLK_SEL_ENABLE |
+        GPTIMER_CLKSEL_MFCLK_SEL_DISABLE | GPTIMER_CLKSEL_LFCLK_SEL_DISABLE);
+  timer->CLKDIV = GPTIMER_CLKDIV_RATIO_DIV_BY_1;
+  timer->COMMONREGS.CPS = 0;
+
+  timer->COUNTERREGS.LOAD = GPTIMER_LOAD_LD_MASK & (RGB_PWM_PERIOD - 1);
+
+  // When enabled the counter starts at 0 and counts up
+  timer->COUNTERREGS.CTRCTL = (GPTIMER_CTRCTL_CVAE_ZEROVAL |
+        GPTIMER_CTRCTL_CM_UP | GPTIMER_CTRCTL_REPEAT_REPEAT_1);
+
+  timer->COMMONREGS.CCPD = outputs;
+
+} /* rgb_pwm_timer_init */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function shows a level on a channel. The gamma corrected duty
+//    is the compare value of the channel, used from the next PWM period;
+//    at 0 the pin is switched to GPIO and driven low.
+//
+// INPUT PARAMETERS:
+//    chan  - RGB_PWM_RED, RGB_PWM_GRN or RGB_PWM_BLU
+//    level - 0 to RGB_PWM_LEVEL_MAX
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    none
+// -----------------------------------------------------------------------------
+static void rgb_pwm_write(uint8_t chan, uint8_t level)
+{
+  uint16_t duty = g_rgb_pwm_gamma[level];
+
+  g_rgb_pwm_level[chan] = level;
+
+  if (duty == 0)
+  {
+    IOMUX->SECCFG.PINCM[g_rgb_pwm_pin_cm[chan]] = (IOMUX_PINCM_PC_CONNECTED |
+          PINCM_GPIO_PIN_FUNC);
+    lp_leds_off(g_rgb_pwm_led_idx[chan]);
+  }
+  else
+  {
+    g_rgb_pwm_timer[chan]->COUNTERREGS.CC_01[g_rgb_pwm_cc_idx[chan]] = duty;
+    IOMUX->SECCFG.PINCM[g_rgb_pwm_pin_cm[chan]] = (IOMUX_PINCM_PC_CONNECTED |
+          g_rgb_pwm_func[chan]);
+  } /* if */
+
+} /* rgb_pwm_write */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function unmasks the period interrupt while a fade is running,
+//    and masks it otherwise. Call it with the interrupts off.
+//
+// INPUT PARAMETERS:
+//    none
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    none
+// -----------------------------------------------------------------------------
+static void rgb_pwm_irq_update(void)
+{
+  if (g_rgb_pwm_fade_left != 0)
+  {
+    RGB_PWM_TIMER_INST->CPU_INT.IMASK = GPTIMER_CPU_INT_IMASK_Z_SET;
+  }
+  else
+  {
+    RGB_PWM_TIMER_INST->CPU_INT.IMASK = 0;
+  } /* if */
+
+} /* rgb_pwm_irq_update */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function moves the fade on by one update. The last update shows
+//    the final color exactly, whatever the rounding of the steps.
+//
+// INPUT PARAMETERS:
+//    none
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    none
+// -----------------------------------------------------------------------------
+static void rgb_pwm_fade_step(void)
+{
+  g_rgb_pwm_fade_left--;
+
+  for (uint8_t chan = 0; chan < RGB_PWM_NUM_CHANNELS; chan++)
+  {
+    if (g_rgb_pwm_fade_left == 0)
+    {
+      rgb_pwm_write(chan, g_rgb_pwm_fade_end[chan]);
+    }
+    else
+    {
+      g_rgb_pwm_fade_pos[chan] += g_rgb_pwm_fade_step[chan];
+      rgb_pwm_write(chan, (uint8_t)(g_rgb_pwm_fade_pos[chan] >>
+                                    RGB_PWM_FADE_FRAC_BITS));
+    } /* if */
+  } /* for */
+
+  if (g_rgb_pwm_fade_left == 0)
+  {
+    rgb_pwm_irq_update();
+  } /* if */
+
+} /* rgb_pwm_fade_step */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function divides by 255, rounding down, with shifts. It is exact
+//    for values up to 255 * 255.
+//
+// INPUT PARAMETERS:
+//    value - number to divide
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    value / 255
+// -----------------------------------------------------------------------------
+static uint8_t rgb_pwm_div255(uint32_t value)
+{
+  return ((uint8_t)((value + 1 + (value >> 8)) >> 8));
+} /* rgb_pwm_div255 */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    PWM period interrupt service routine. A running fade is moved on
+//    every RGB_PWM_FADE_STEP_MSEC.
+//
+// INPUT PARAMETERS:
+//    none
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    none
+// -----------------------------------------------------------------------------
+void RGB_PWM_TIMER_IRQHandler(void)
+{
+  if (RGB_PWM_TIMER_INST->CPU_INT.IIDX != GPTIMER_CPU_INT_IIDX_STAT_Z)
+  {
+    return;
+  } /* if */
+
+  if ((g_rgb_pwm_fade_left != 0) &&
+      (++g_rgb_pwm_fade_count >= g_rgb_pwm_fade_periods))
+  {
+    g_rgb_pwm_fade_count = 0;
+    rgb_pwm_fade_step();
+  } /* if */
+
+} /* RGB_PWM_TIMER_IRQHandler */
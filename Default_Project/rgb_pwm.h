@@ -0,0 +1,124 @@
+// *****************************************************************************
+// ***************************    C Source Code     ****************************
+// *****************************************************************************
+//   DESIGNER NAME:  Bruce Link
+//
+//         VERSION:  1.0
+//
+//       FILE NAME:  rgb_pwm.h
+//
+//-----------------------------------------------------------------------------
+// DESCRIPTION
+//    This module sets the color of the LaunchPad RGB LED with PWM. Colors
+//    are 24-bit 0xRRGGBB values, or hue, saturation and value converted in
+//    fixed point. Each channel is gamma corrected, so equal steps look
+//    equally bright, and a fade moves every channel from the color shown
+//    to a new one over a given time.
+//
+//    Red (PB26) and green (PB27) are routed to the TIMG6 CCP0 and CCP1
+//    outputs and blue (PB22) to a CCP output of RGB_PWM_BLU_TIMER_INST
+//    (TIMG7, freed by driving led_anim from the application tick), so the
+//    timers make all three PWMs with no CPU time. Both timers run the same
+//    period. A channel at 0 is switched back to GPIO and driven low, so it
+//    is fully off.
+//
+//    NOTE: PB22 is PINCM50 (LP_RGB_BLU_IOMUX), and its TIMG7_CCP1 function
+//          is the blue output. The timer, its CC index and the IOMUX
+//          function are set by the RGB_PWM_BLU_x defines below; a timer
+//          used for blue must not be used by another service.
+//
+//    The TIMG6 period interrupt moves fades on, every
+//    RGB_PWM_FADE_STEP_MSEC. It is turned off when no fade is running, so
+//    a steady color costs no CPU time.
+//
+//    Hue is given in RGB_PWM_HUE_STEPS steps around the color wheel, 256
+//    for each of the 6 sectors, so the conversion needs no division.
+//    RGB_PWM_HUE_DEG() converts a constant angle in degrees.
+//
+//    NOTE: lp_leds_on() and the LED_ANIM_LP_RGB animation do not work on
+//          the RGB LED while this module is running.
+//
+//-----------------------------------------------------------------------------
+// DISCLAIMER
+//    This code was developed for educational purposes as part of the CSC202
+//    course at Monroe Community Collage and is provided "as is" without
+//    warranties of any kind, whether express, implied, or statutory.
+//
+//    The author and organization do not warrant the accuracy, completeness, or
+//    reliability of the code. The author and organization shall not be liable
+//    for any direct, indirect, incidental, special, exemplary, or consequential
+//    damages arising out of the use of or inability to use the code, even if
+//    advised of the possibility of such damages.
+//
+//    Use of this code is at your own risk, and it is recommended to validate
+//    and adapt the code for your specific application and hardware
+//    requirements.
+//
+// Copyright (c) 2026 by Bruce Link
+//    You may use, edit, run or distribute this file as long as the above
+//    copyright notice remains
+// *****************************************************************************
+//******************************************************************************
+
+#ifndef __RGB_PWM_H__
+#define __RGB_PWM_H__
+
+//-----------------------------------------------------------------------------
+// Load standard C include files
+//-----------------------------------------------------------------------------
+#include <stdint.h>
+#include <stdbool.h>
+
+//-----------------------------------------------------------------------------
+// Define symbolic constants used by the module
+//-----------------------------------------------------------------------------
+#define RGB_PWM_TIMER_INST                                                 TIMG6
+#define RGB_PWM_TIMER_IRQHandler                                TIMG6_IRQHandler
+#define RGB_PWM_TIMER_INT_IRQN                                    TIMG6_INT_IRQn
+
+// IOMUX functions that route red and green to the TIMG6 outputs
+#define RGB_PWM_RED_PINCM_IOMUX_FUNC               (IOMUX_PINCM57_PF_TIMG6_CCP0)
+#define RGB_PWM_GRN_PINCM_IOMUX_FUNC               (IOMUX_PINCM58_PF_TIMG6_CCP1)
+
+// Timer, capture/compare index and IOMUX function of blue (PB22)
+#define RGB_PWM_BLU_TIMER_INST                                             TIMG7
+#define RGB_PWM_BLU_CC_IDX                                                   (1)
+#define RGB_PWM_BLU_CCPD_OUTPUT                     (GPTIMER_CCPD_C0CCP1_OUTPUT)
+#define RGB_PWM_BLU_PINCM_IOMUX_FUNC               (IOMUX_PINCM50_PF_TIMG7_CCP1)
+
+// PWM period in BUSCLK cycles (9.8kHz at 40MHz) of both timers, a channel
+// full on uses the whole period
+#define RGB_PWM_PERIOD                                                    (4096)
+
+// Time between fade updates
+#define RGB_PWM_FADE_STEP_MSEC                                               (1)
+
+// Hue steps around the color wheel, and the steps of each sector
+#define RGB_PWM_HUE_STEPS                                                 (1536)
+#define RGB_PWM_HUE_SECTOR_STEPS                                           (256)
+
+// Convert a hue in degrees (0-359) to hue steps
+#define RGB_PWM_HUE_DEG(deg)                                                  \
+        ((uint16_t)(((uint32_t)(deg) * RGB_PWM_HUE_STEPS) / 360))
+
+// Build a 24-bit color
+#define RGB_PWM_COLOR(red, grn, blu)                                          \
+        (((uint32_t)(red) << 16) | ((uint32_t)(grn) << 8) | (uint32_t)(blu))
+
+#define RGB_PWM_BLACK                                               (0x000000U)
+#define RGB_PWM_WHITE                                               (0xFFFFFFU)
+
+
+// ----------------------------------------------------------------------------
+// Prototype for support functions
+// ----------------------------------------------------------------------------
+void rgb_pwm_init(void);
+void rgb_pwm_deinit(void);
+void rgb_pwm_set(uint32_t color);
+void rgb_pwm_set_hsv(uint16_t hue, uint8_t sat, uint8_t val);
+void rgb_pwm_fade_to(uint32_t color, uint16_t msec);
+bool rgb_pwm_fading(void);
+uint32_t rgb_pwm_get(void);
+uint32_t rgb_pwm_hsv_to_rgb(uint16_t hue, uint8_t sat, uint8_t val);
+
+#endif /* __RGB_PWM_H__ */
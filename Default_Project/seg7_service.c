@@ -0,0 +1,823 @@
+// *****************************************************************************
+// ***************************    C Source Code     ****************************
+// *****************************************************************************
+//   DESIGNER NAME:  Bruce Link
+//
+//         VERSION:  1.0
+//
+//       FILE NAME:  seg7_service.c
+//
+//-----------------------------------------------------------------------------
+// DESCRIPTION
+//    This file contains the seven-segment display service. See
+//    seg7_service.h for how the display is multiplexed.
+//
+//    The frame buffer is one 32-bit word, 8 bits (one segment pattern) per
+//    position with position 0 in the low byte. When a position changes, the
+//    port writes of its SEG7_SERVICE_BCM_BITS ticks are rebuilt into
+//    g_seg7_svc_ticks and the interrupt only copies them to the ports.
+//
+//-----------------------------------------------------------------------------
+// DISCLAIMER
+//    This code was developed for educational purposes as part of the CSC202
+//    course at Monroe Community Collage and is provided "as is" without
+//    warranties of any kind, whether express, implied, or statutory.
+//
+//    The author and organization do not warrant the accuracy, completeness, or
+//    reliability of the code. The author and organization shall not be liable
+//    for any direct, indirect, incidental, special, exemplary, or consequential
+//    damages arising out of the use of or inability to use the code, even if
+//    advised of the possibility of such damages.
+//
+//    Use of this code is at your own risk, and it is recommended to validate
+//    and adapt the code for your specific application and hardware
+//    requirements.
+//
+// Copyright (c) 2026 by Bruce Link
+//    You may use, edit, run or distribute this file as long as the above
+//    copyright notice remains
+// *****************************************************************************
+//******************************************************************************
+
+//-----------------------------------------------------------------------------
+// Load standard C include files
+//-----------------------------------------------------------------------------
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+//-----------------------------------------------------------------------------
+// Loads MSP launchpad board support macros and definitions
+//-----------------------------------------------------------------------------
+#include <ti/devices/msp/msp.h>
+#include "LaunchPad.h"
+#include "clock.h"
+#include "num_ascii.h"
+#include "seg7_service.h"
+
+
+//-----------------------------------------------------------------------------
+// Define symbolic constants used by the module
+//-----------------------------------------------------------------------------
+// Layout of the frame buffer word
+#define SEG7_SVC_POS_SHIFT                                                   (3)
+#define SEG7_SVC_PATTERN_MASK                                             (0xFF)
+#define SEG7_SVC_NIBBLE_MASK                                               (0xF)
+#define SEG7_SVC_NIBBLE_SHIFT                                                (4)
+#define SEG7_SVC_SEGMENTS                                                    (8)
+
+// Ticks in one frame, SEG7_SERVICE_BCM_BITS for each position
+#define SEG7_SVC_NUM_TICKS  (SEG7_SERVICE_NUM_POSITIONS * SEG7_SERVICE_BCM_BITS)
+
+#define SEG7_SVC_PERMILLE                                                 (1000)
+
+// Largest number of digits after the point that fits with one in front
+#define SEG7_SVC_MAX_FRAC_DIGITS                                             (3)
+
+// TIMG0 has a 16-bit counter, the tick of the top level bit must fit in
+// the LOAD so a time unit is at most 512 timer clocks
+#define SEG7_SVC_MAX_LOAD                                               (0xFFFF)
+#define SEG7_SVC_MAX_UNIT                        ((SEG7_SVC_MAX_LOAD + 1) >> \
+                                                    (SEG7_SERVICE_BCM_BITS - 1))
+
+
+//-----------------------------------------------------------------------------
+// Define global variables and structures here.
+// NOTE: when possible avoid using global variables
+//-----------------------------------------------------------------------------
+
+// Define a structure to hold the port writes of one tick
+typedef struct
+{
+  uint32_t set_pins[MAX_NUM_GPIO_PORTS];
+  uint32_t clr_pins[MAX_NUM_GPIO_PORTS];
+} seg7_svc_tick_t;
+
+// Segment pattern of each digit, position n in bits 8n+7 .. 8n
+static uint32_t g_seg7_svc_frame = 0;
+
+// LEDs of the LED bar that are on
+static uint8_t g_seg7_svc_leds = 0;
+
+// Gamma corrected level of each segment (LED) of each position
+static uint8_t g_seg7_svc_duty[SEG7_SERVICE_NUM_POSITIONS][SEG7_SVC_SEGMENTS];
+
+// Port writes of every tick of a frame, position major, and the timer
+// load of the tick for each bit
+static seg7_svc_tick_t g_seg7_svc_ticks[SEG7_SVC_NUM_TICKS];
+static uint16_t        g_seg7_svc_load[SEG7_SERVICE_BCM_BITS];
+
+// Tick shown by the next interrupt
+static volatile uint8_t g_seg7_svc_tick = 0;
+
+// Interrupt statistics and the cycle count they were cleared at
+static seg7_service_stats_t g_seg7_svc_stats;
+static uint32_t             g_seg7_svc_stats_start = 0;
+
+static const uint8_t g_seg7_svc_enable_idx[SEG7_SERVICE_NUM_POSITIONS] = {
+        SEG7_SERVICE_POS0_DIG, SEG7_SERVICE_POS1_DIG,
+        SEG7_SERVICE_POS2_DIG, SEG7_SERVICE_POS3_DIG,
+        LED_BAR_ENABLE_IDX
+};
+
+// Segment patterns of the hexadecimal digits 0-F
+static const uint8_t g_seg7_svc_hex[] = {
+        0x3F, 0x06, 0x5B, 0x4F, 0x66, 0x6D, 0x7D, 0x07,
+        0x7F, 0x6F, 0x77, 0x7C, 0x39, 0x5E, 0x79, 0x71
+};
+
+// Gamma correction (2.2) of the 0-255 brightness levels
+static const uint8_t g_seg7_svc_gamma[SEG7_SERVICE_LEVEL_MAX + 1] = {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+          1,   2,   2,   2,   2,   2,   2,   2,   3,   3,   3,   3,
+          3,   4,   4,   4,   4,   5,   5,   5,   5,   6,   6,   6,
+          6,   7,   7,   7,   8,   8,   8,   9,   9,   9,  10,  10,
+         11,  11,  11,  12,  12,  13,  13,  13,  14,  14,  15,  15,
+         16,  16,  17,  17,  18,  18,  19,  19,  20,  20,  21,  22,
+         22,  23,  23,  24,  25,  25,  26,  26,  27,  28,  28,  29,
+         30,  30,  31,  32,  33,  33,  34,  35,  35,  36,  37,  38,
+         39,  39,  40,  41,  42,  43,  43,  44,  45,  46,  47,  48,
+         49,  49,  50,  51,  52,  53,  54,  55,  56,  57,  58,  59,
+         60,  61,  62,  63,  64,  65,  66,  67,  68,  69,  70,  71,
+         73,  74,  75,  76,  77,  78,  79,  81,  82,  83,  84,  85,
+         87,  88,  89,  90,  91,  93,  94,  95,  97,  98,  99, 100,
+        102, 103, 105, 106, 107, 109, 110, 111, 113, 114, 116, 117,
+        119, 120, 121, 123, 124, 126, 127, 129, 130, 132, 133, 135,
+        137, 138, 140, 141, 143, 145, 146, 148, 149, 151, 153, 154,
+        156, 158, 159, 161, 163, 165, 166, 168, 170, 172, 173, 175,
+        177, 179, 181, 182, 184, 186, 188, 190, 192, 194, 196, 197,
+        199, 201, 203, 205, 207, 209, 211, 213, 215, 217, 219, 221,
+        223, 225, 227, 229, 231, 234, 236, 238, 240, 242, 244, 246,
+        248, 251, 253, 255
+};
+
+
+//-----------------------------------------------------------------------------
+// Define function prototypes used by the module
+//-----------------------------------------------------------------------------
+static uint32_t seg7_service_place(uint32_t frame, uint8_t position,
+                uint8_t pattern);
+static void seg7_service_set_frame(uint32_t frame);
+static void seg7_service_build(uint8_t position);
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function starts the display service. The LED bar and digit pins
+//    are set up, the display and the LED bar are blanked, every level is
+//    set to SEG7_SERVICE_LEVEL_MAX and TIMG0 is started to generate the
+//    scan tick. The cycle counter is started for the statistics.
+//
+// INPUT PARAMETERS:
+//    refresh_hz - number of times per second each digit is lit
+//                 (SEG7_SERVICE_MIN_REFRESH_HZ to
+//                  SEG7_SERVICE_MAX_REFRESH_HZ)
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    none
+// -----------------------------------------------------------------------------
+void seg7_service_init(uint16_t refresh_hz)
+{
+  leds_init();
+  seg7_init();
+
+  g_seg7_svc_frame = 0;
+  g_seg7_svc_leds  = 0;
+  g_seg7_svc_tick  = 0;
+  memset(g_seg7_svc_duty, SEG7_SERVICE_LEVEL_MAX, sizeof(g_seg7_svc_duty));
+
+  for (uint8_t position = 0; position < SEG7_SERVICE_NUM_POSITIONS;
+       position++)
+  {
+    seg7_service_build(position);
+  } /* for */
+
+  cycle_counter_init();
+  seg7_service_clear_stats();
+
+  // Reset the timer
+  SEG7_SERVICE_TIMER_INST->GPRCM.RSTCTL = (GPTIMER_RSTCTL_KEY_UNLOCK_W |
+        GPTIMER_RSTCTL_RESETSTKYCLR_CLR | GPTIMER_RSTCTL_RESETASSERT_ASSERT);
+
+  // Enable power to the timer
+  SEG7_SERVICE_TIMER_INST->GPRCM.PWREN = (GPTIMER_PWREN_KEY_UNLOCK_W |
+        GPTIMER_PWREN_ENABLE_ENABLE);
+
+  clock_delay(PERIPHERAL_PWR_UP_DELAY);
+
+  // Timer clock = BUSCLK / SEG7_SERVICE_TIMER_PRESCALE
+  SEG7_SERVICE_TIMER_INST->CLKSEL = (GPTIMER_CLKSEL_BUSCLK_SEL_ENABLE |
+        GPTIMER_CLKSEL_MFCLK_SEL_DISABLE | GPTIMER_CLKSEL_LFCLK_SEL_DISABLE);
+  SEG7_SERVICE_TIMER_INST->CLKDIV = GPTIMER_CLKDIV_RATIO_DIV_BY_1;
+
+  // Count down from LOAD and reload, one zero event per tick. The rate
+  // sets the prescale (CPS) and the LOAD of each tick.
+  SEG7_SERVICE_TIMER_INST->COUNTERREGS.CTRCTL = (GPTIMER_CTRCTL_CVAE_LDVAL |
+        GPTIMER_CTRCTL_CM_DOWN | GPTIMER_CTRCTL_REPEAT_REPEAT_1);
+  seg7_service_set_rate(refresh_hz);
+  SEG7_SERVICE_TIMER_INST->COUNTERREGS.LOAD = g_seg7_svc_load[0];
+
+  SEG7_SERVICE_TIMER_INST->CPU_INT.ICLR = GPTIMER_CPU_INT_ICLR_Z_CLR;
+  SEG7_SERVICE_TIMER_INST->CPU_INT.IMASK = GPTIMER_CPU_INT_IMASK_Z_SET;
+
+  NVIC_ClearPendingIRQ(SEG7_SERVICE_TIMER_INT_IRQN);
+  NVIC_EnableIRQ(SEG7_SERVICE_TIMER_INT_IRQN);
+
+  // Enable the clock and start counting
+  SEG7_SERVICE_TIMER_INST->COMMONREGS.CCLKCTL = GPTIMER_CCLKCTL_CLKEN_ENABLED;
+  SEG7_SERVICE_TIMER_INST->COUNTERREGS.CTRCTL |= GPTIMER_CTRCTL_EN_ENABLED;
+
+} /* seg7_service_init */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function sets the refresh rate. The value is clamped to
+//    SEG7_SERVICE_MIN_REFRESH_HZ .. SEG7_SERVICE_MAX_REFRESH_HZ. A frame
+//    is SEG7_SERVICE_NUM_POSITIONS * SEG7_SERVICE_LEVEL_MAX time units and
+//    the tick for bit n of the levels lasts 2^n units. The timer prescale
+//    starts at SEG7_SERVICE_TIMER_PRESCALE and is raised when the tick of
+//    the top bit would not fit in the 16-bit LOAD. The new rate is used
+//    from the next tick. The timer must be powered (seg7_service_init()).
+//
+// INPUT PARAMETERS:
+//    refresh_hz - number of times per second each digit is lit
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    none
+// -----------------------------------------------------------------------------
+void seg7_service_set_rate(uint16_t refresh_hz)
+{
+  uint32_t frame_units;
+  uint32_t prescale;
+  uint32_t unit;
+
+  if (refresh_hz < SEG7_SERVICE_MIN_REFRESH_HZ)
+  {
+    refresh_hz = SEG7_SERVICE_MIN_REFRESH_HZ;
+  }
+  else if (refresh_hz > SEG7_SERVICE_MAX_REFRESH_HZ)
+  {
+    refresh_hz = SEG7_SERVICE_MAX_REFRESH_HZ;
+  } /* if */
+
+  frame_units = (uint32_t)refresh_hz * SEG7_SERVICE_NUM_POSITIONS *
+                SEG7_SERVICE_LEVEL_MAX;
+
+  // Smallest prescale that keeps the unit at or below SEG7_SVC_MAX_UNIT
+  prescale = (get_bus_clock_freq() + frame_units * SEG7_SVC_MAX_UNIT - 1) /
+             (frame_units * SEG7_SVC_MAX_UNIT);
+  if (prescale < SEG7_SERVICE_TIMER_PRESCALE)
+  {
+    prescale = SEG7_SERVICE_TIMER_PRESCALE;
+  }
+  else if (prescale > SEG7_SERVICE_MAX_PRESCALE)
+  {
+    prescale = SEG7_SERVICE_MAX_PRESCALE;
+  } /* if */
+
+  unit = get_bus_clock_freq() / (prescale * frame_units);
+  if (unit > SEG7_SVC_MAX_UNIT)
+  {
+    unit = SEG7_SVC_MAX_UNIT;
+  } /* if */
+
+  SEG7_SERVICE_TIMER_INST->COMMONREGS.CPS = GPTIMER_CPS_PCNT_MASK &
+        (prescale - 1);
+
+  for (uint8_t bit = 0; bit < SEG7_SERVICE_BCM_BITS; bit++)
+  {
+    g_seg7_svc_load[bit] = GPTIMER_LOAD_LD_MASK & ((unit << bit) - 1);
+  } /* for */
+
+} /* seg7_service_set_rate */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function stops the scan and turns all the digits and the LED bar
+//    off. Call seg7_service_init() to start it again.
+//
+// INPUT PARAMETERS:
+//    none
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    none
+// -----------------------------------------------------------------------------
+void seg7_service_stop(void)
+{
+  NVIC_DisableIRQ(SEG7_SERVICE_TIMER_INT_IRQN);
+  SEG7_SERVICE_TIMER_INST->COUNTERREGS.CTRCTL &= ~GPTIMER_CTRCTL_EN_MASK;
+  SEG7_SERVICE_TIMER_INST->CPU_INT.IMASK = 0;
+
+  seg7_off();
+  leds_disable();
+
+} /* seg7_service_stop */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function blanks all the digits.
+//
+// INPUT PARAMETERS:
+//    none
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    none
+// -----------------------------------------------------------------------------
+void seg7_service_clear(void)
+{
+  seg7_service_set_frame(0);
+} /* seg7_service_clear */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function sets the raw segment pattern of one position, including
+//    the decimal point. SEG7_PATTERN_BLANK turns the digit off.
+//
+// INPUT PARAMETERS:
+//    position - digit position, 0 (left) to SEG7_SERVICE_NUM_DIGITS - 1
+//    pattern  - segments to light, bit n is segment SEG7_SEG_x_IDX n
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    none
+// -----------------------------------------------------------------------------
+void seg7_service_set_pattern(uint8_t position, uint8_t pattern)
+{
+  if (position < SEG7_SERVICE_NUM_DIGITS)
+  {
+    seg7_service_set_frame(seg7_service_place(g_seg7_svc_frame, position,
+                                              pattern));
+  } /* if */
+} /* seg7_service_set_pattern */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function turns the decimal point of one position on or off
+//    without changing the rest of its segments.
+//
+// INPUT PARAMETERS:
+//    position - digit position, 0 (left) to SEG7_SERVICE_NUM_DIGITS - 1
+//    on       - true to light the point
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    none
+// -----------------------------------------------------------------------------
+void seg7_service_set_dp(uint8_t position, bool on)
+{
+  uint32_t dp_mask;
+
+  if (position < SEG7_SERVICE_NUM_DIGITS)
+  {
+    dp_mask = (uint32_t)SEG7_PATTERN_DP << (position << SEG7_SVC_POS_SHIFT);
+    seg7_service_set_frame(on ? (g_seg7_svc_frame | dp_mask) :
+                                (g_seg7_svc_frame & ~dp_mask));
+  } /* if */
+} /* seg7_service_set_dp */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function shows a 16-bit value as 4 hexadecimal digits with
+//    leading zeros. The decimal points are turned off.
+//
+// INPUT PARAMETERS:
+//    value - the number to show
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    none
+// -----------------------------------------------------------------------------
+void seg7_service_show_hex(uint16_t value)
+{
+  uint32_t frame = 0;
+
+  for (int8_t position = SEG7_SERVICE_NUM_DIGITS - 1; position >= 0;
+       position--)
+  {
+    frame = seg7_service_place(frame, (uint8_t)position,
+                               g_seg7_svc_hex[value & SEG7_SVC_NIBBLE_MASK]);
+    value >>= SEG7_SVC_NIBBLE_SHIFT;
+  } /* for */
+
+  seg7_service_set_frame(frame);
+
+} /* seg7_service_show_hex */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function shows a signed decimal number, right-justified with
+//    leading blanks. Values outside -999 to 9999 show "----".
+//
+// INPUT PARAMETERS:
+//    value - the number to show
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    true if the number fits, false otherwise
+// -----------------------------------------------------------------------------
+bool seg7_service_show_dec(int16_t value)
+{
+  return (seg7_service_show_fixed(value, 0));
+} /* seg7_service_show_dec */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function shows a fixed-point decimal number, right-justified with
+//    leading blanks. The value is an integer scaled by 10^frac_digits, for
+//    example 1234 with 2 fraction digits shows "12.34". The decimal point
+//    uses the DP segment of the digit before it, so it does not take a
+//    position. If the number does not fit the display shows "----".
+//
+// INPUT PARAMETERS:
+//    value       - the scaled number to show
+//    frac_digits - digits after the decimal point (0 to 3)
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    true if the number fits, false otherwise
+// -----------------------------------------------------------------------------
+bool seg7_service_show_fixed(int16_t value, uint8_t frac_digits)
+{
+  char     string[SEG7_SERVICE_NUM_DIGITS + 2];
+  uint32_t frame = 0;
+  uint8_t  position = 0;
+  uint8_t  pattern;
+  bool     fits = false;
+
+  if (frac_digits <= SEG7_SVC_MAX_FRAC_DIGITS)
+  {
+    // The point needs a character in the string but not on the display
+    fits = fixed_to_ascii(value, frac_digits,
+                          SEG7_SERVICE_NUM_DIGITS + (frac_digits != 0),
+                          string);
+  } /* if */
+
+  if (!fits)
+  {
+    for (position = 0; position < SEG7_SERVICE_NUM_DIGITS; position++)
+    {
+      frame = seg7_service_place(frame, position, SEG7_PATTERN_MINUS);
+    } /* for */
+
+    seg7_service_set_frame(frame);
+    return false;
+  } /* if */
+
+  for (char *next = string; *next != '\0'; next++)
+  {
+    if (*next == '.')
+    {
+      // Light the point of the digit just placed
+      frame |= (uint32_t)SEG7_PATTERN_DP <<
+               ((position - 1) << SEG7_SVC_POS_SHIFT);
+      continue;
+    } /* if */
+
+    if ((*next >= '0') && (*next <= '9'))
+    {
+      pattern = g_seg7_svc_hex[*next - '0'];
+    }
+    else if (*next == '-')
+    {
+      pattern = SEG7_PATTERN_MINUS;
+    }
+    else
+    {
+      pattern = SEG7_PATTERN_BLANK;
+    } /* if */
+
+    frame = seg7_service_place(frame, position++, pattern);
+  } /* for */
+
+  seg7_service_set_frame(frame);
+
+  return true;
+
+} /* seg7_service_show_fixed */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function sets the LEDs of the LED bar that are on. Each LED is
+//    lit at its own level, see seg7_service_set_led_level().
+//
+// INPUT PARAMETERS:
+//    value - bit n turns LED n on
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    none
+// -----------------------------------------------------------------------------
+void seg7_service_set_leds(uint8_t value)
+{
+  g_seg7_svc_leds = value;
+  seg7_service_build(SEG7_SERVICE_LED_BAR);
+} /* seg7_service_set_leds */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function sets the brightness of a digit, or of every LED of the
+//    LED bar. The level is gamma corrected, so 128 looks about half as
+//    bright as 255.
+//
+// INPUT PARAMETERS:
+//    position - digit position, or SEG7_SERVICE_LED_BAR
+//    level    - SEG7_SERVICE_LEVEL_OFF to SEG7_SERVICE_LEVEL_MAX
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    none
+// -----------------------------------------------------------------------------
+void seg7_service_set_level(uint8_t position, uint8_t level)
+{
+  if (position < SEG7_SERVICE_NUM_POSITIONS)
+  {
+    memset(g_seg7_svc_duty[position], g_seg7_svc_gamma[level],
+           SEG7_SVC_SEGMENTS);
+    seg7_service_build(position);
+  } /* if */
+} /* seg7_service_set_level */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function sets the brightness of one LED of the LED bar. The level
+//    is gamma corrected.
+//
+// INPUT PARAMETERS:
+//    led_idx - LED of the LED bar, 0 to MAX_NUM_LEDS - 1
+//    level   - SEG7_SERVICE_LEVEL_OFF to SEG7_SERVICE_LEVEL_MAX
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    none
+// -----------------------------------------------------------------------------
+void seg7_service_set_led_level(uint8_t led_idx, uint8_t level)
+{
+  if (led_idx < MAX_NUM_LEDS)
+  {
+    g_seg7_svc_duty[SEG7_SERVICE_LED_BAR][led_idx] = g_seg7_svc_gamma[level];
+    seg7_service_build(SEG7_SERVICE_LED_BAR);
+  } /* if */
+} /* seg7_service_set_led_level */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    These functions read and clear the interrupt statistics. The time in
+//    the interrupt is measured with the cycle counter from the first to
+//    the last line of the handler, so it leaves out the 30 or so cycles the
+//    core takes to enter and leave an interrupt. The load is the share of
+//    the time since the last clear spent in the interrupt. The cycle
+//    counter wraps after 2^32 bus clocks, clear the statistics more often.
+//
+// INPUT PARAMETERS:
+//    none
+//
+// OUTPUT PARAMETERS:
+//    stats - copy of the statistics (seg7_service_get_stats)
+//
+// RETURN:
+//    none
+// -----------------------------------------------------------------------------
+void seg7_service_get_stats(seg7_service_stats_t *stats)
+{
+  uint32_t primask = __get_PRIMASK();
+
+  __disable_irq();
+  *stats = g_seg7_svc_stats;
+  stats->elapsed_cycles = cycle_counter_get() - g_seg7_svc_stats_start;
+  __set_PRIMASK(primask);
+
+  stats->load_permille = 0;
+  if (stats->elapsed_cycles != 0)
+  {
+    stats->load_permille = (uint16_t)(((uint64_t)stats->isr_cycles *
+                           SEG7_SVC_PERMILLE) / stats->elapsed_cycles);
+  } /* if */
+
+} /* seg7_service_get_stats */
+
+void seg7_service_clear_stats(void)
+{
+  uint32_t primask = __get_PRIMASK();
+
+  __disable_irq();
+  memset(&g_seg7_svc_stats, 0, sizeof(g_seg7_svc_stats));
+  g_seg7_svc_stats_start = cycle_counter_get();
+  __set_PRIMASK(primask);
+
+} /* seg7_service_clear_stats */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function returns a frame with the pattern of one position
+//    replaced.
+//
+// INPUT PARAMETERS:
+//    frame    - the frame to change
+//    position - digit position
+//    pattern  - new segment pattern of the position
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    the new frame
+// -----------------------------------------------------------------------------
+static uint32_t seg7_service_place(uint32_t frame, uint8_t position,
+                uint8_t pattern)
+{
+  uint8_t shift = position << SEG7_SVC_POS_SHIFT;
+
+  return ((frame & ~((uint32_t)SEG7_SVC_PATTERN_MASK << shift)) |
+          ((uint32_t)pattern << shift));
+
+} /* seg7_service_place */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function stores a new frame and rebuilds the ticks of the digits
+//    that changed.
+//
+// INPUT PARAMETERS:
+//    frame - segment pattern of each digit
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    none
+// -----------------------------------------------------------------------------
+static void seg7_service_set_frame(uint32_t frame)
+{
+  uint32_t changed = frame ^ g_seg7_svc_frame;
+
+  g_seg7_svc_frame = frame;
+
+  for (uint8_t position = 0; position < SEG7_SERVICE_NUM_DIGITS; position++)
+  {
+    if (((changed >> (position << SEG7_SVC_POS_SHIFT)) &
+         SEG7_SVC_PATTERN_MASK) != 0)
+    {
+      seg7_service_build(position);
+    } /* if */
+  } /* for */
+
+} /* seg7_service_set_frame */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function builds the port writes of the ticks of one position.
+//    The tick for bit n lights the segments that are on and have bit n set
+//    in their level. Each tick is built first and then copied with the
+//    interrupts off, so the interrupt never sees half of one.
+//
+// INPUT PARAMETERS:
+//    position - digit position, or SEG7_SERVICE_LED_BAR
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    none
+// -----------------------------------------------------------------------------
+static void seg7_service_build(uint8_t position)
+{
+  seg7_svc_tick_t *ticks = &g_seg7_svc_ticks[position *
+                                             SEG7_SERVICE_BCM_BITS];
+  seg7_svc_tick_t  tick;
+  uint32_t         primask;
+  uint8_t          pattern;
+  uint8_t          plane;
+
+  if (position == SEG7_SERVICE_LED_BAR)
+  {
+    pattern = g_seg7_svc_leds;
+  }
+  else
+  {
+    pattern = (g_seg7_svc_frame >> (position << SEG7_SVC_POS_SHIFT)) &
+              SEG7_SVC_PATTERN_MASK;
+  } /* if */
+
+  for (uint8_t bit = 0; bit < SEG7_SERVICE_BCM_BITS; bit++)
+  {
+    plane = 0;
+    for (uint8_t segment = 0; segment < SEG7_SVC_SEGMENTS; segment++)
+    {
+      if ((g_seg7_svc_duty[position][segment] & (1U << bit)) != 0)
+      {
+        plane |= 1U << segment;
+      } /* if */
+    } /* for */
+
+    seg7_port_masks(pattern & plane, g_seg7_svc_enable_idx[position],
+                    tick.set_pins, tick.clr_pins);
+
+    primask = __get_PRIMASK();
+    __disable_irq();
+    ticks[bit] = tick;
+    __set_PRIMASK(primask);
+  } /* for */
+
+} /* seg7_service_build */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    Scan tick interrupt service routine. The port writes of the next tick
+//    are copied to the ports. The clear writes turn the lit digit off
+//    (all the enables are on port A) and light the new segments, the set
+//    writes turn the other segments off and the new digit on. The counter
+//    has already reloaded for this tick, so the load of the tick after it
+//    is set up.
+//
+// INPUT PARAMETERS:
+//    none
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    none
+// -----------------------------------------------------------------------------
+void SEG7_SERVICE_TIMER_IRQHandler(void)
+{
+  const seg7_svc_tick_t *tick;
+  uint32_t start;
+  uint32_t cycles;
+  uint8_t  index = g_seg7_svc_tick;
+
+  if (SEG7_SERVICE_TIMER_INST->CPU_INT.IIDX != GPTIMER_CPU_INT_IIDX_STAT_Z)
+  {
+    return;
+  } /* if */
+
+  start = cycle_counter_get();
+
+  tick = &g_seg7_svc_ticks[index];
+  GPIOA->DOUTCLR31_0 = tick->clr_pins[GPIO_PORTA];
+  GPIOB->DOUTCLR31_0 = tick->clr_pins[GPIO_PORTB];
+  GPIOB->DOUTSET31_0 = tick->set_pins[GPIO_PORTB];
+  GPIOA->DOUTSET31_0 = tick->set_pins[GPIO_PORTA];
+
+  if (++index == SEG7_SVC_NUM_TICKS)
+  {
+    index = 0;
+  } /* if */
+
+  SEG7_SERVICE_TIMER_INST->COUNTERREGS.LOAD =
+        g_seg7_svc_load[index & (SEG7_SERVICE_BCM_BITS - 1)];
+  g_seg7_svc_tick = index;
+
+  cycles = cycle_counter_get() - start;
+  g_seg7_svc_stats.ticks++;
+  g_seg7_svc_stats.isr_cycles += cycles;
+  if (cycles > g_seg7_svc_stats.max_isr_cycles)
+  {
+    g_seg7_svc_stats.max_isr_cycles = cycles;
+  } /* if */
+
+} /* SEG7_SERVICE_TIMER_IRQHandler */
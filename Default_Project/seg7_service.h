@@ -0,0 +1,137 @@
+// *****************************************************************************
+// ***************************    C Source Code     ****************************
+// *****************************************************************************
+//   DESIGNER NAME:  Bruce Link
+//
+//         VERSION:  1.0
+//
+//       FILE NAME:  seg7_service.h
+//
+//-----------------------------------------------------------------------------
+// DESCRIPTION
+//    This module keeps the 4-digit seven-segment display and the LED bar on
+//    the CSC202 board lit without any help from the application. The digits
+//    and the LED bar share the segment lines, so only one of them can be on
+//    at a time. A TIMG0 interrupt steps through them, fast enough that all
+//    of them look lit.
+//
+//    The application writes to a 4-digit frame buffer and the LED bar with
+//    the functions below and returns at once. The main loop can block
+//    (msec_delay, LCD writes, ...) without the display flickering.
+//
+//    Brightness uses binary code modulation. Each position is lit for
+//    SEG7_SERVICE_BCM_BITS ticks of 1, 2, 4, ... 128 time units, and a
+//    segment is on during the ticks that match the set bits of its level.
+//    The port writes of every tick are built ahead of time, when the
+//    display or a level changes, so a tick always costs the same few port
+//    writes whatever is shown. Each digit has one level, each LED of the
+//    bar has its own. Levels are 0-255 and gamma corrected, so equal steps
+//    look equally bright.
+//
+//    The time spent in the interrupt is counted, seg7_service_get_stats()
+//    gives the CPU load at the refresh rate in use.
+//
+//    Position 0 is the leftmost digit. The digit enable used for each
+//    position is set by SEG7_SERVICE_POSn_DIG, swap them if the board is
+//    wired the other way around.
+//
+//-----------------------------------------------------------------------------
+// DISCLAIMER
+//    This code was developed for educational purposes as part of the CSC202
+//    course at Monroe Community Collage and is provided "as is" without
+//    warranties of any kind, whether express, implied, or statutory.
+//
+//    The author and organization do not warrant the accuracy, completeness, or
+//    reliability of the code. The author and organization shall not be liable
+//    for any direct, indirect, incidental, special, exemplary, or consequential
+//    damages arising out of the use of or inability to use the code, even if
+//    advised of the possibility of such damages.
+//
+//    Use of this code is at your own risk, and it is recommended to validate
+//    and adapt the code for your specific application and hardware
+//    requirements.
+//
+// Copyright (c) 2026 by Bruce Link
+//    You may use, edit, run or distribute this file as long as the above
+//    copyright notice remains
+// *****************************************************************************
+//******************************************************************************
+
+#ifndef __SEG7_SERVICE_H__
+#define __SEG7_SERVICE_H__
+
+//-----------------------------------------------------------------------------
+// Load standard C include files
+//-----------------------------------------------------------------------------
+#include <stdint.h>
+#include <stdbool.h>
+
+//-----------------------------------------------------------------------------
+// Define symbolic constants used by the module
+//-----------------------------------------------------------------------------
+#define SEG7_SERVICE_TIMER_INST                                            TIMG0
+#define SEG7_SERVICE_TIMER_IRQHandler                           TIMG0_IRQHandler
+#define SEG7_SERVICE_TIMER_INT_IRQN                               TIMG0_INT_IRQn
+
+// Timer clock is BUSCLK / SEG7_SERVICE_TIMER_PRESCALE (10MHz at 40MHz).
+// seg7_service_set_rate() raises the prescale when the longest tick would
+// not fit in the 16-bit LOAD (low rates at 80MHz).
+#define SEG7_SERVICE_TIMER_PRESCALE                                          (4)
+#define SEG7_SERVICE_MAX_PRESCALE                                          (256)
+
+// Refresh rate limits in frames (all digits and the LED bar) per second.
+// At the maximum the shortest tick is about 4us.
+#define SEG7_SERVICE_MIN_REFRESH_HZ                                         (30)
+#define SEG7_SERVICE_MAX_REFRESH_HZ                                        (200)
+
+// Brightness levels, SEG7_SERVICE_BCM_BITS ticks per position
+#define SEG7_SERVICE_BCM_BITS                                                (8)
+#define SEG7_SERVICE_LEVEL_OFF                                               (0)
+#define SEG7_SERVICE_LEVEL_MAX                                             (255)
+
+// Scan positions, the 4 digits followed by the LED bar
+#define SEG7_SERVICE_NUM_DIGITS                                              (4)
+#define SEG7_SERVICE_LED_BAR                                                 (4)
+#define SEG7_SERVICE_NUM_POSITIONS                                           (5)
+
+// Digit enable (SEG7_DIGn_ENABLE_IDX) used for each position, left to right
+#define SEG7_SERVICE_POS0_DIG                               SEG7_DIG0_ENABLE_IDX
+#define SEG7_SERVICE_POS1_DIG                               SEG7_DIG1_ENABLE_IDX
+#define SEG7_SERVICE_POS2_DIG                               SEG7_DIG2_ENABLE_IDX
+#define SEG7_SERVICE_POS3_DIG                               SEG7_DIG3_ENABLE_IDX
+
+// Segment patterns, bit n is segment SEG7_SEG_x_IDX n (H is the point)
+#define SEG7_PATTERN_BLANK                                                (0x00)
+#define SEG7_PATTERN_MINUS                                                (0x40)
+#define SEG7_PATTERN_DP                                                   (0x80)
+
+// Define a structure to hold the interrupt statistics
+typedef struct
+{
+  uint32_t ticks;             // interrupts serviced
+  uint32_t isr_cycles;        // bus clock cycles spent in the interrupt
+  uint32_t max_isr_cycles;    // bus clock cycles of the longest interrupt
+  uint32_t elapsed_cycles;    // bus clock cycles since the last clear
+  uint16_t load_permille;     // isr_cycles / elapsed_cycles in 0.1%
+} seg7_service_stats_t;
+
+
+// ----------------------------------------------------------------------------
+// Prototype for support functions
+// ----------------------------------------------------------------------------
+void seg7_service_init(uint16_t refresh_hz);
+void seg7_service_set_rate(uint16_t refresh_hz);
+void seg7_service_stop(void);
+void seg7_service_clear(void);
+void seg7_service_set_pattern(uint8_t position, uint8_t pattern);
+void seg7_service_set_dp(uint8_t position, bool on);
+void seg7_service_show_hex(uint16_t value);
+bool seg7_service_show_dec(int16_t value);
+bool seg7_service_show_fixed(int16_t value, uint8_t frac_digits);
+void seg7_service_set_leds(uint8_t value);
+void seg7_service_set_level(uint8_t position, uint8_t level);
+void seg7_service_set_led_level(uint8_t led_idx, uint8_t level);
+void seg7_service_get_stats(seg7_service_stats_t *stats);
+void seg7_service_clear_stats(void);
+
+#endif /* __SEG7_SERVICE_H__ */
@@ -0,0 +1,74 @@
+// *****************************************************************************
+// ***************************    C Source Code     ****************************
+// *****************************************************************************
+//   DESIGNER NAME:  Bruce Link
+//
+//         VERSION:  1.0
+//
+//       FILE NAME:  msp.h
+//
+//-----------------------------------------------------------------------------
+// DESCRIPTION
+//    Host (Linux) stand-in for the TI device header. The LCD sources only
+//    need the CMSIS interrupt mask functions from it, there are no
+//    interrupts on the host so they do nothing.
+//
+//-----------------------------------------------------------------------------
+// DISCLAIMER
+//    This code was developed for educational purposes as part of the CSC202
+//    course at Monroe Community Collage and is provided "as is" without
+//    warranties of any kind, whether express, implied, or statutory.
+//
+//    The author and organization do not warrant the accuracy, completeness, or
+//    reliability of the code. The author and organization shall not be liable
+//    for any direct, indirect, incidental, special, exemplary, or consequential
+//    damages arising out of the use of or inability to use the code, even if
+//    advised of the possibility of such damages.
+//
+//    Use of this code is at your own risk, and it is recommended to validate
+//    and adapt the code for your specific application and hardware
+//    requirements.
+//
+// Copyright (c) 2026 by Bruce Link
+//    You may use, edit, run or distribute this file as long as the above
+//    copyright notice remains
+// *****************************************************************************
+//******************************************************************************
+
+#ifndef __HOST_MSP_H__
+#define __HOST_MSP_H__
+
+//-----------------------------------------------------------------------------
+// Load standard C include files
+//-----------------------------------------------------------------------------
+#include <stdint.h>
+
+
+// ----------------------------------------------------------------------------
+// Peripheral register types named in LaunchPad.h, never used on the host
+// ----------------------------------------------------------------------------
+typedef struct host_gpio_regs GPIO_Regs;
+
+
+// ----------------------------------------------------------------------------
+// Interrupt mask functions, nothing to mask on the host
+// ----------------------------------------------------------------------------
+static inline uint32_t __get_PRIMASK(void)
+{
+  return (0);
+} /* __get_PRIMASK */
+
+static inline void __set_PRIMASK(uint32_t primask)
+{
+  (void)primask;
+} /* __set_PRIMASK */
+
+static inline void __disable_irq(void)
+{
+} /* __disable_irq */
+
+static inline void __enable_irq(void)
+{
+} /* __enable_irq */
+
+#endif /* __HOST_MSP_H__ */
@@ -0,0 +1,650 @@
+// *****************************************************************************
+// ***************************    C Source Code     ****************************
+// *****************************************************************************
+//   DESIGNER NAME:  Bruce Link
+//
+//         VERSION:  1.0
+//
+//       FILE NAME:  lcd_sim.c
+//
+//-----------------------------------------------------------------------------
+// DESCRIPTION
+//    This file contains the LCD1602 (HD44780 and PCF8574) model used to run
+//    the LCD code on a Linux host. See lcd_sim.h for a description.
+//
+//-----------------------------------------------------------------------------
+// DISCLAIMER
+//    This code was developed for educational purposes as part of the CSC202
+//    course at Monroe Community Collage and is provided "as is" without
+//    warranties of any kind, whether express, implied, or statutory.
+//
+//    The author and organization do not warrant the accuracy, completeness, or
+//    reliability of the code. The author and organization shall not be liable
+//    for any direct, indirect, incidental, special, exemplary, or consequential
+//    damages arising out of the use of or inability to use the code, even if
+//    advised of the possibility of such damages.
+//
+//    Use of this code is at your own risk, and it is recommended to validate
+//    and adapt the code for your specific application and hardware
+//    requirements.
+//
+// Copyright (c) 2026 by Bruce Link
+//    You may use, edit, run or distribute this file as long as the above
+//    copyright notice remains
+// *****************************************************************************
+//******************************************************************************
+
+//-----------------------------------------------------------------------------
+// Load standard C include files
+//-----------------------------------------------------------------------------
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+//-----------------------------------------------------------------------------
+// Loads LCD definitions and the model
+//-----------------------------------------------------------------------------
+#include "lcd1602.h"
+#include "lcd_sim.h"
+
+
+//-----------------------------------------------------------------------------
+// Define symbolic constants used by the module
+//-----------------------------------------------------------------------------
+#define LCD_SIM_CYCLES_PER_USEC              (LCD_SIM_BUS_CLOCK_HZ / 1000000)
+
+// Instruction bits, the highest set bit selects the instruction
+#define LCD_SIM_SET_DDRAM                                                 (0x80)
+#define LCD_SIM_SET_CGRAM                                                 (0x40)
+#define LCD_SIM_FUNCTION_SET                                              (0x20)
+#define LCD_SIM_SHIFT                                                     (0x10)
+#define LCD_SIM_DISPLAY_CNTRL                                             (0x08)
+#define LCD_SIM_ENTRY_MODE                                                (0x04)
+#define LCD_SIM_RETURN_HOME                                               (0x02)
+#define LCD_SIM_CLEAR                                                     (0x01)
+
+// Instruction option bits
+#define LCD_SIM_DDRAM_ADDR_MASK                                           (0x7F)
+#define LCD_SIM_CGRAM_ADDR_MASK                                           (0x3F)
+#define LCD_SIM_8BIT_BIT                                                  (0x10)
+#define LCD_SIM_DISPLAY_SHIFT_BIT                                         (0x08)
+#define LCD_SIM_RIGHT_BIT                                                 (0x04)
+#define LCD_SIM_DISPLAY_ON_BIT                                            (0x04)
+#define LCD_SIM_INCREMENT_BIT                                             (0x02)
+#define LCD_SIM_ENTRY_SHIFT_BIT                                           (0x01)
+
+// Each line is 40 characters of DDRAM, line 2 starts at 0x40
+#define LCD_SIM_LINE_LENGTH                                                 (40)
+#define LCD_SIM_BUSY_FLAG                                                 (0x80)
+
+
+//-----------------------------------------------------------------------------
+// Define function prototypes used by the module
+//-----------------------------------------------------------------------------
+static void lcd_sim_latch(bool reg_select, uint8_t nibble);
+static void lcd_sim_execute(bool reg_select, uint8_t data);
+static void lcd_sim_instruction(uint8_t command);
+static void lcd_sim_move_address(bool increment);
+static bool lcd_sim_busy(void);
+static uint32_t lcd_sim_init(void);
+static uint32_t lcd_sim_write_nibble(uint8_t nibble);
+static uint32_t lcd_sim_write(uint8_t command, const char *data,
+                uint8_t length);
+static void lcd_sim_wait_ready(bool slow_cmd);
+static void lcd_sim_set_backlight(bool on);
+
+
+//-----------------------------------------------------------------------------
+// Define global variables and structures here.
+// NOTE: when possible avoid using global variables
+//-----------------------------------------------------------------------------
+
+// Define a structure to hold the state of the HD44780 controller
+typedef struct
+{
+  uint8_t  ddram[LCD_SIM_DDRAM_SIZE];
+  uint8_t  cgram[LCD_SIM_CGRAM_SIZE];
+  uint8_t  address;           // address counter
+  bool     cgram_selected;    // address counter points into the CGRAM
+  bool     four_bit;          // 4-bit interface, two nibbles per byte
+  bool     have_upper;        // upper nibble of a 4-bit byte received
+  uint8_t  upper;             // the upper nibble
+  bool     increment;         // entry mode: address counter increments
+  bool     entry_shift;       // entry mode: display shifts on data write
+  bool     display_on;
+  uint8_t  shift;             // display shift, 0 to 39 characters
+  uint8_t  read_nibble;       // nibble driven on D7-D4 during a read
+  bool     read_lower;        // the next read returns the lower nibble
+  uint64_t busy_until;        // cycle count at which the busy flag clears
+} lcd_sim_hd44780_t;
+
+static lcd_sim_hd44780_t g_lcd_sim;
+static uint8_t           g_lcd_sim_port       = 0;
+static uint64_t          g_lcd_sim_cycles     = 0;
+static uint32_t          g_lcd_sim_violations = 0;
+
+static const lcd1602_transport_t g_lcd_sim_transport =
+{
+  "sim",
+  lcd_sim_init,
+  lcd_sim_write_nibble,
+  lcd_sim_write,
+  lcd_sim_wait_ready,
+  lcd_sim_set_backlight
+};
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function puts the model in its power on state: 8-bit interface,
+//    display off, DDRAM filled with spaces, backpack pins low. The
+//    simulated time and the violation count are cleared.
+//
+// INPUT PARAMETERS:
+//    none
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    none
+// -----------------------------------------------------------------------------
+void lcd_sim_reset(void)
+{
+  memset(&g_lcd_sim, 0, sizeof(g_lcd_sim));
+  memset(g_lcd_sim.ddram, ' ', sizeof(g_lcd_sim.ddram));
+  g_lcd_sim.increment = true;
+
+  g_lcd_sim_port       = 0;
+  g_lcd_sim_cycles     = 0;
+  g_lcd_sim_violations = 0;
+
+} /* lcd_sim_reset */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function applies a byte written to the PCF8574 to its pins. A
+//    rising edge of E with R/W set starts a read cycle, a falling edge of E
+//    with R/W clear latches D7-D4 into the HD44780.
+//
+// INPUT PARAMETERS:
+//    port - value written to the PCF8574
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    none
+// -----------------------------------------------------------------------------
+void lcd_sim_port_write(uint8_t port)
+{
+  bool enable_rise = ((g_lcd_sim_port & LCD_EN_BIT_MASK) == 0) &&
+                     ((port & LCD_EN_BIT_MASK) != 0);
+  bool enable_fall = ((g_lcd_sim_port & LCD_EN_BIT_MASK) != 0) &&
+                     ((port & LCD_EN_BIT_MASK) == 0);
+  uint8_t status;
+
+  if (((port & LCD_RW_BIT_MASK) != 0) && enable_rise)
+  {
+    // Busy flag and address counter, upper nibble first
+    status = g_lcd_sim.address | (lcd_sim_busy() ? LCD_SIM_BUSY_FLAG : 0);
+    g_lcd_sim.read_nibble = g_lcd_sim.read_lower ?
+                            (status & LOWER_NIBBLE_MASK) :
+                            (status >> NIBBLE_SHIFT);
+    g_lcd_sim.read_lower = !g_lcd_sim.read_lower;
+  }
+  else if (((port & LCD_RW_BIT_MASK) == 0) && enable_fall)
+  {
+    lcd_sim_latch((port & LCD_RS_BIT_MASK) != 0, port >> NIBBLE_SHIFT);
+  } /* if */
+
+  g_lcd_sim_port = port;
+
+} /* lcd_sim_port_write */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function returns the level of the PCF8574 pins. A pin written
+//    low reads low. D7-D4 written high read the nibble the HD44780 drives
+//    while E is high in a read cycle.
+//
+// INPUT PARAMETERS:
+//    none
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    level of the 8 pins
+// -----------------------------------------------------------------------------
+uint8_t lcd_sim_port_read(void)
+{
+  uint8_t pins = g_lcd_sim_port;
+
+  if (((g_lcd_sim_port & LCD_RW_BIT_MASK) != 0) &&
+      ((g_lcd_sim_port & LCD_EN_BIT_MASK) != 0))
+  {
+    pins = (g_lcd_sim_port & LOWER_NIBBLE_MASK) |
+           ((g_lcd_sim.read_nibble << NIBBLE_SHIFT) & g_lcd_sim_port);
+  } /* if */
+
+  return (pins);
+
+} /* lcd_sim_port_read */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    These functions move the simulated time on and return it.
+//
+// INPUT PARAMETERS:
+//    usec   - microseconds to add
+//    cycles - bus clock cycles to add
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    lcd_sim_get_cycles - bus clock cycles since lcd_sim_reset()
+// -----------------------------------------------------------------------------
+void lcd_sim_advance_usec(uint32_t usec)
+{
+  g_lcd_sim_cycles += (uint64_t)usec * LCD_SIM_CYCLES_PER_USEC;
+} /* lcd_sim_advance_usec */
+
+void lcd_sim_advance_cycles(uint32_t cycles)
+{
+  g_lcd_sim_cycles += cycles;
+} /* lcd_sim_advance_cycles */
+
+uint64_t lcd_sim_get_cycles(void)
+{
+  return (g_lcd_sim_cycles);
+} /* lcd_sim_get_cycles */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function returns the character shown at a position of the
+//    display, taking the display shift into account. Codes 0-15 are the
+//    CGRAM characters.
+//
+// INPUT PARAMETERS:
+//    row - line number (LCD_LINE_NUM_1 or LCD_LINE_NUM_2)
+//    col - character position (0 to CHARACTERS_PER_LCD_LINE - 1)
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    character code, or 0 for a position outside of the display
+// -----------------------------------------------------------------------------
+char lcd_sim_get_char(uint8_t row, uint8_t col)
+{
+  uint8_t base = (row == LCD_LINE_NUM_1) ? LCD_LINE1_ADDR : LCD_LINE2_ADDR;
+
+  if ((row >= LINES_PER_LCD) || (col >= CHARACTERS_PER_LCD_LINE))
+  {
+    return (0);
+  } /* if */
+
+  return ((char)g_lcd_sim.ddram[base + ((col + g_lcd_sim.shift) %
+                                        LCD_SIM_LINE_LENGTH)]);
+
+} /* lcd_sim_get_char */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function returns one row of the CGRAM.
+//
+// INPUT PARAMETERS:
+//    address - CGRAM address (slot * 8 + row)
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    the row pattern
+// -----------------------------------------------------------------------------
+uint8_t lcd_sim_get_cgram(uint8_t address)
+{
+  return (g_lcd_sim.cgram[address & LCD_SIM_CGRAM_ADDR_MASK]);
+} /* lcd_sim_get_cgram */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function returns the number of instructions and data writes that
+//    reached the HD44780 while it was still busy with the previous one.
+//    Real hardware may ignore or corrupt them, so this must be 0.
+//
+// INPUT PARAMETERS:
+//    none
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    number of timing violations since lcd_sim_reset()
+// -----------------------------------------------------------------------------
+uint32_t lcd_sim_get_violations(void)
+{
+  return (g_lcd_sim_violations);
+} /* lcd_sim_get_violations */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function returns the transport that writes the HD44780 model
+//    directly, to be passed to lcd1602_set_transport().
+//
+// INPUT PARAMETERS:
+//    none
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    pointer to the transport
+// -----------------------------------------------------------------------------
+const lcd1602_transport_t *lcd_sim_transport(void)
+{
+  return (&g_lcd_sim_transport);
+} /* lcd_sim_transport */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function takes a nibble latched by E. In 8-bit mode the nibble is
+//    D7-D4 of a whole byte (D3-D0 are not wired and read as 0). In 4-bit
+//    mode two nibbles, upper first, make one byte.
+//
+// INPUT PARAMETERS:
+//    reg_select - true for the data register, false for an instruction
+//    nibble     - level of D7-D4
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    none
+// -----------------------------------------------------------------------------
+static void lcd_sim_latch(bool reg_select, uint8_t nibble)
+{
+  g_lcd_sim.read_lower = false;
+
+  if (!g_lcd_sim.four_bit)
+  {
+    lcd_sim_execute(reg_select, nibble << NIBBLE_SHIFT);
+  }
+  else if (!g_lcd_sim.have_upper)
+  {
+    g_lcd_sim.upper      = nibble;
+    g_lcd_sim.have_upper = true;
+  }
+  else
+  {
+    g_lcd_sim.have_upper = false;
+    lcd_sim_execute(reg_select, (g_lcd_sim.upper << NIBBLE_SHIFT) | nibble);
+  } /* if */
+
+} /* lcd_sim_latch */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function executes one byte received by the HD44780 and makes it
+//    busy for the execution time of the byte.
+//
+// INPUT PARAMETERS:
+//    reg_select - true for the data register, false for an instruction
+//    data       - the byte
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    none
+// -----------------------------------------------------------------------------
+static void lcd_sim_execute(bool reg_select, uint8_t data)
+{
+  uint32_t exec_usec = LCD_SIM_EXEC_USEC;
+
+  if (lcd_sim_busy())
+  {
+    g_lcd_sim_violations++;
+  } /* if */
+
+  if (!reg_select)
+  {
+    lcd_sim_instruction(data);
+    if ((data == LCD_SIM_CLEAR) || ((data & ~1U) == LCD_SIM_RETURN_HOME))
+    {
+      exec_usec = LCD_SIM_SLOW_EXEC_USEC;
+    } /* if */
+  }
+  else if (g_lcd_sim.cgram_selected)
+  {
+    g_lcd_sim.cgram[g_lcd_sim.address & LCD_SIM_CGRAM_ADDR_MASK] = data;
+    lcd_sim_move_address(g_lcd_sim.increment);
+  }
+  else
+  {
+    g_lcd_sim.ddram[g_lcd_sim.address & LCD_SIM_DDRAM_ADDR_MASK] = data;
+    lcd_sim_move_address(g_lcd_sim.increment);
+    if (g_lcd_sim.entry_shift)
+    {
+      g_lcd_sim.shift = (g_lcd_sim.shift + (g_lcd_sim.increment ? 1 :
+                         LCD_SIM_LINE_LENGTH - 1)) % LCD_SIM_LINE_LENGTH;
+    } /* if */
+  } /* if */
+
+  g_lcd_sim.busy_until = g_lcd_sim_cycles +
+                         (uint64_t)exec_usec * LCD_SIM_CYCLES_PER_USEC;
+
+} /* lcd_sim_execute */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function decodes and runs one HD44780 instruction.
+//
+// INPUT PARAMETERS:
+//    command - the instruction byte
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    none
+// -----------------------------------------------------------------------------
+static void lcd_sim_instruction(uint8_t command)
+{
+  if ((command & LCD_SIM_SET_DDRAM) != 0)
+  {
+    g_lcd_sim.address        = command & LCD_SIM_DDRAM_ADDR_MASK;
+    g_lcd_sim.cgram_selected = false;
+  }
+  else if ((command & LCD_SIM_SET_CGRAM) != 0)
+  {
+    g_lcd_sim.address        = command & LCD_SIM_CGRAM_ADDR_MASK;
+    g_lcd_sim.cgram_selected = true;
+  }
+  else if ((command & LCD_SIM_FUNCTION_SET) != 0)
+  {
+    g_lcd_sim.four_bit   = ((command & LCD_SIM_8BIT_BIT) == 0);
+    g_lcd_sim.have_upper = false;
+  }
+  else if ((command & LCD_SIM_SHIFT) != 0)
+  {
+    if ((command & LCD_SIM_DISPLAY_SHIFT_BIT) != 0)
+    {
+      g_lcd_sim.shift = (g_lcd_sim.shift +
+                         (((command & LCD_SIM_RIGHT_BIT) != 0) ?
+                          LCD_SIM_LINE_LENGTH - 1 : 1)) % LCD_SIM_LINE_LENGTH;
+    }
+    else
+    {
+      lcd_sim_move_address((command & LCD_SIM_RIGHT_BIT) != 0);
+    } /* if */
+  }
+  else if ((command & LCD_SIM_DISPLAY_CNTRL) != 0)
+  {
+    g_lcd_sim.display_on = ((command & LCD_SIM_DISPLAY_ON_BIT) != 0);
+  }
+  else if ((command & LCD_SIM_ENTRY_MODE) != 0)
+  {
+    g_lcd_sim.increment   = ((command & LCD_SIM_INCREMENT_BIT) != 0);
+    g_lcd_sim.entry_shift = ((command & LCD_SIM_ENTRY_SHIFT_BIT) != 0);
+  }
+  else if ((command & LCD_SIM_RETURN_HOME) != 0)
+  {
+    g_lcd_sim.address        = 0;
+    g_lcd_sim.cgram_selected = false;
+    g_lcd_sim.shift          = 0;
+  }
+  else if ((command & LCD_SIM_CLEAR) != 0)
+  {
+    memset(g_lcd_sim.ddram, ' ', sizeof(g_lcd_sim.ddram));
+    g_lcd_sim.address        = 0;
+    g_lcd_sim.cgram_selected = false;
+    g_lcd_sim.shift          = 0;
+    g_lcd_sim.increment      = true;
+  } /* if */
+
+} /* lcd_sim_instruction */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function moves the address counter one step. In the DDRAM of a
+//    2-line display the end of line 1 (0x27) wraps to the start of line 2
+//    (0x40) and the end of line 2 (0x67) wraps to 0x00.
+//
+// INPUT PARAMETERS:
+//    increment - true to step up, false to step down
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    none
+// -----------------------------------------------------------------------------
+static void lcd_sim_move_address(bool increment)
+{
+  uint8_t address = g_lcd_sim.address;
+  uint8_t line_end = LCD_LINE2_ADDR + LCD_SIM_LINE_LENGTH - 1;
+
+  if (g_lcd_sim.cgram_selected)
+  {
+    address = (increment ? address + 1 : address - 1) &
+              LCD_SIM_CGRAM_ADDR_MASK;
+  }
+  else if (increment)
+  {
+    address = (address == (LCD_SIM_LINE_LENGTH - 1)) ? LCD_LINE2_ADDR :
+              (address == line_end) ? LCD_LINE1_ADDR : address + 1;
+  }
+  else
+  {
+    address = (address == LCD_LINE1_ADDR) ? line_end :
+              (address == LCD_LINE2_ADDR) ? (LCD_SIM_LINE_LENGTH - 1) :
+              address - 1;
+  } /* if */
+
+  g_lcd_sim.address = address;
+
+} /* lcd_sim_move_address */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function returns true while the HD44780 is executing.
+//
+// INPUT PARAMETERS:
+//    none
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    true if the busy flag is set
+// -----------------------------------------------------------------------------
+static bool lcd_sim_busy(void)
+{
+  return (g_lcd_sim_cycles < g_lcd_sim.busy_until);
+} /* lcd_sim_busy */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    These functions are the direct transport. Each nibble is put on the
+//    model with one E pulse, a bus write takes 1us, and the transport
+//    waits for the busy flag to clear before each byte, so it is the
+//    fastest any transport can drive the HD44780.
+//
+// INPUT PARAMETERS:
+//    nibble   - bits 7-4 are sent (write_nibble)
+//    command  - instruction to send first, or LCD_NO_COMMAND (write)
+//    data     - characters to write (write)
+//    length   - number of characters (write)
+//    slow_cmd - not used, the busy flag covers every instruction
+//    on       - backlight state, not modelled
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    0, the direct transport can not fail
+// -----------------------------------------------------------------------------
+static uint32_t lcd_sim_init(void)
+{
+  return (0);
+} /* lcd_sim_init */
+
+static uint32_t lcd_sim_write_nibble(uint8_t nibble)
+{
+  lcd_sim_advance_usec(1);
+  lcd_sim_latch(false, nibble >> NIBBLE_SHIFT);
+  return (0);
+} /* lcd_sim_write_nibble */
+
+static uint32_t lcd_sim_write(uint8_t command, const char *data,
+                uint8_t length)
+{
+  if (command != LCD_NO_COMMAND)
+  {
+    lcd_sim_wait_ready(false);
+    lcd_sim_advance_usec(1);
+    lcd_sim_execute(false, command);
+  } /* if */
+
+  while (length-- > 0)
+  {
+    lcd_sim_wait_ready(false);
+    lcd_sim_advance_usec(1);
+    lcd_sim_execute(true, (uint8_t)*data++);
+  } /* while */
+
+  return (0);
+
+} /* lcd_sim_write */
+
+static void lcd_sim_wait_ready(bool slow_cmd)
+{
+  (void)slow_cmd;
+
+  if (lcd_sim_busy())
+  {
+    g_lcd_sim_cycles = g_lcd_sim.busy_until;
+  } /* if */
+
+} /* lcd_sim_wait_ready */
+
+static void lcd_sim_set_backlight(bool on)
+{
+  (void)on;
+} /* lcd_sim_set_backlight */
@@ -0,0 +1,104 @@
+// *****************************************************************************
+// ***************************    C Source Code     ****************************
+// *****************************************************************************
+//   DESIGNER NAME:  Bruce Link
+//
+//         VERSION:  1.0
+//
+//       FILE NAME:  lcd_sim.h
+//
+//-----------------------------------------------------------------------------
+// DESCRIPTION
+//    This module is a model of an LCD1602 (HD44780 controller) behind a
+//    PCF8574 I2C backpack, used to run the LCD code on a Linux host. The
+//    backpack pins are wired as on the real module:
+//      P0 = RS, P1 = R/W, P2 = E, P3 = backlight, P4-P7 = D4-D7
+//
+//    Every byte written to the PCF8574 is applied to the pins. The HD44780
+//    latches D7-D4 on the falling edge of E and runs the 8-bit reset
+//    sequence, 4-bit mode, DDRAM, CGRAM, entry mode and shift instructions.
+//    While E is high with R/W set it drives the busy flag and the address
+//    counter on D7-D4, so busy flag polling can be tested too.
+//
+//    Time is simulated. The host versions of the I2C, delay and cycle
+//    counter functions (lcd_sim_host.c) advance a bus clock counter, so a
+//    benchmark reports the time the code would take on the LaunchPad:
+//    each I2C byte costs 9 SCL clocks at 100kHz. An instruction that
+//    reaches the HD44780 before the previous one has finished executing
+//    is counted as a timing violation.
+//
+//    lcd_sim_transport() is a second transport with no backpack, an ideal
+//    4-bit bus that writes the HD44780 model directly. Comparing it with
+//    the I2C transport shows the cost of the backpack.
+//
+//
+//-----------------------------------------------------------------------------
+// DISCLAIMER
+//    This code was developed for educational purposes as part of the CSC202
+//    course at Monroe Community Collage and is provided "as is" without
+//    warranties of any kind, whether express, implied, or statutory.
+//
+//    The author and organization do not warrant the accuracy, completeness, or
+//    reliability of the code. The author and organization shall not be liable
+//    for any direct, indirect, incidental, special, exemplary, or consequential
+//    damages arising out of the use of or inability to use the code, even if
+//    advised of the possibility of such damages.
+//
+//    Use of this code is at your own risk, and it is recommended to validate
+//    and adapt the code for your specific application and hardware
+//    requirements.
+//
+// Copyright (c) 2026 by Bruce Link
+//    You may use, edit, run or distribute this file as long as the above
+//    copyright notice remains
+// *****************************************************************************
+//******************************************************************************
+
+#ifndef __LCD_SIM_H__
+#define __LCD_SIM_H__
+
+//-----------------------------------------------------------------------------
+// Load standard C include files
+//-----------------------------------------------------------------------------
+#include <stdint.h>
+#include <stdbool.h>
+
+//-----------------------------------------------------------------------------
+// Loads LCD transport definitions
+//-----------------------------------------------------------------------------
+#include "lcd1602_transport.h"
+
+//-----------------------------------------------------------------------------
+// Define symbolic constants used by the module
+//-----------------------------------------------------------------------------
+
+// Simulated bus clock and I2C bus
+#define LCD_SIM_BUS_CLOCK_HZ                                         (40000000)
+#define LCD_SIM_I2C_ADDRESS                                               (0x27)
+#define LCD_SIM_I2C_BYTE_USEC                                               (90)
+#define LCD_SIM_I2C_START_STOP_USEC                                         (10)
+
+// HD44780 execution times
+#define LCD_SIM_EXEC_USEC                                                   (37)
+#define LCD_SIM_SLOW_EXEC_USEC                                            (1520)
+
+// HD44780 memory sizes
+#define LCD_SIM_DDRAM_SIZE                                                (0x80)
+#define LCD_SIM_CGRAM_SIZE                                                  (64)
+
+
+// ----------------------------------------------------------------------------
+// Prototype for support functions
+// ----------------------------------------------------------------------------
+void lcd_sim_reset(void);
+void lcd_sim_port_write(uint8_t port);
+uint8_t lcd_sim_port_read(void);
+void lcd_sim_advance_usec(uint32_t usec);
+void lcd_sim_advance_cycles(uint32_t cycles);
+uint64_t lcd_sim_get_cycles(void);
+char lcd_sim_get_char(uint8_t row, uint8_t col);
+uint8_t lcd_sim_get_cgram(uint8_t address);
+uint32_t lcd_sim_get_violations(void);
+const lcd1602_transport_t *lcd_sim_transport(void);
+
+#endif /* __LCD_SIM_H__ */
@@ -0,0 +1,229 @@
+// *****************************************************************************
+// ***************************    C Source Code     ****************************
+// *****************************************************************************
+//   DESIGNER NAME:  Bruce Link
+//
+//         VERSION:  1.0
+//
+//       FILE NAME:  lcd_sim_host.c
+//
+//-----------------------------------------------------------------------------
+// DESCRIPTION
+//    This file stands in for the LaunchPad I2C, clock and UART functions the
+//    LCD code calls, so it can be linked on a Linux host. Every call moves
+//    the simulated time of the lcd_sim model on.
+//
+//-----------------------------------------------------------------------------
+// DISCLAIMER
+//    This code was developed for educational purposes as part of the CSC202
+//    course at Monroe Community Collage and is provided "as is" without
+//    warranties of any kind, whether express, implied, or statutory.
+//
+//    The author and organization do not warrant the accuracy, completeness, or
+//    reliability of the code. The author and organization shall not be liable
+//    for any direct, indirect, incidental, special, exemplary, or consequential
+//    damages arising out of the use of or inability to use the code, even if
+//    advised of the possibility of such damages.
+//
+//    Use of this code is at your own risk, and it is recommended to validate
+//    and adapt the code for your specific application and hardware
+//    requirements.
+//
+// Copyright (c) 2026 by Bruce Link
+//    You may use, edit, run or distribute this file as long as the above
+//    copyright notice remains
+// *****************************************************************************
+//******************************************************************************
+
+//-----------------------------------------------------------------------------
+// Load standard C include files
+//-----------------------------------------------------------------------------
+#include <stdint.h>
+#include <stdio.h>
+
+//-----------------------------------------------------------------------------
+// Loads the interfaces being stood in for and the model
+//-----------------------------------------------------------------------------
+#include "LaunchPad.h"
+#include "clock.h"
+#include "uart.h"
+#include "lcd_sim.h"
+
+
+//-----------------------------------------------------------------------------
+// Define symbolic constants used by the module
+//-----------------------------------------------------------------------------
+#define LCD_SIM_USEC_PER_SECOND                                        (1000000)
+
+
+//-----------------------------------------------------------------------------
+// Define function prototypes used by the module
+//-----------------------------------------------------------------------------
+static uint32_t lcd_sim_i2c_start(uint8_t slave, uint16_t byte_count);
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    These functions stand in for the LaunchPad I2C controller functions.
+//    Each transfer takes the time of a start, the address byte, the data
+//    bytes and a stop, and each data byte reaches the PCF8574 pins one
+//    byte time after the previous one.
+//
+// INPUT PARAMETERS:
+//    slave      - 7-bit I2C address
+//    data       - byte(s) to write, or buffer for the byte read
+//    length     - number of bytes to write
+//
+// OUTPUT PARAMETERS:
+//    data       - byte read (I2C_mstr_read1)
+//
+// RETURN:
+//    I2C_SUCCESS, or I2C_ERR_NACK if nothing answers at the address
+// -----------------------------------------------------------------------------
+uint32_t I2C_mstr_send1(uint8_t slave, uint8_t data)
+{
+  return (I2C_mstr_send_stream(slave, &data, 1));
+} /* I2C_mstr_send1 */
+
+uint32_t I2C_mstr_send_stream(uint8_t slave, const uint8_t data[],
+         uint16_t length)
+{
+  uint32_t status = lcd_sim_i2c_start(slave, length);
+  uint16_t idx;
+
+  if (status == I2C_SUCCESS)
+  {
+    for (idx = 0; idx < length; idx++)
+    {
+      lcd_sim_advance_usec(LCD_SIM_I2C_BYTE_USEC);
+      lcd_sim_port_write(data[idx]);
+    } /* for */
+  } /* if */
+
+  return (status);
+
+} /* I2C_mstr_send_stream */
+
+uint32_t I2C_mstr_read1(uint8_t slave, uint8_t data[])
+{
+  uint32_t status = lcd_sim_i2c_start(slave, 1);
+
+  if (status == I2C_SUCCESS)
+  {
+    data[0] = lcd_sim_port_read();
+    lcd_sim_advance_usec(LCD_SIM_I2C_BYTE_USEC);
+  } /* if */
+
+  return (status);
+
+} /* I2C_mstr_read1 */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    These functions stand in for the clock.c delays and cycle counter.
+//    The delays move the simulated time on, the cycle counter reads it.
+//
+// INPUT PARAMETERS:
+//    ms_delay_count - milliseconds to wait
+//    us_delay_count - microseconds to wait
+//    cycles         - bus clock cycles to wait, or to convert
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    cycle_counter_get  - low 32 bits of the simulated cycle count
+//    cycles_to_usec     - cycles converted to microseconds
+//    get_bus_clock_freq - simulated bus clock in Hz
+// -----------------------------------------------------------------------------
+void msec_delay(uint32_t ms_delay_count)
+{
+  while (ms_delay_count-- > 0)
+  {
+    lcd_sim_advance_usec(LCD_SIM_USEC_PER_SECOND / MSEC_PER_SECOND);
+  } /* while */
+} /* msec_delay */
+
+void usec_delay(uint32_t us_delay_count)
+{
+  lcd_sim_advance_usec(us_delay_count);
+} /* usec_delay */
+
+void clock_delay(uint32_t cycles)
+{
+  lcd_sim_advance_cycles(cycles);
+} /* clock_delay */
+
+void cycle_counter_init(void)
+{
+} /* cycle_counter_init */
+
+uint32_t cycle_counter_get(void)
+{
+  return ((uint32_t)lcd_sim_get_cycles());
+} /* cycle_counter_get */
+
+uint32_t cycles_to_usec(uint32_t cycles)
+{
+  return (cycles / (LCD_SIM_BUS_CLOCK_HZ / LCD_SIM_USEC_PER_SECOND));
+} /* cycles_to_usec */
+
+uint32_t get_bus_clock_freq(void)
+{
+  return (LCD_SIM_BUS_CLOCK_HZ);
+} /* get_bus_clock_freq */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function stands in for the UART and writes to stdout. Carriage
+//    returns are dropped so the output is a plain text file.
+//
+// INPUT PARAMETERS:
+//    data - character to send
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    none
+// -----------------------------------------------------------------------------
+void UART_out_char(char data)
+{
+  if (data != '\r')
+  {
+    putchar(data);
+  } /* if */
+} /* UART_out_char */
+
+
+//-----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function starts a simulated transfer: it takes the start, stop
+//    and address byte time and checks the address against the backpack.
+//
+// INPUT PARAMETERS:
+//    slave      - 7-bit I2C address
+//    byte_count - number of data bytes in the transfer
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    I2C_SUCCESS, or I2C_ERR_NACK if nothing answers at the address
+// -----------------------------------------------------------------------------
+static uint32_t lcd_sim_i2c_start(uint8_t slave, uint16_t byte_count)
+{
+  uint32_t status = I2C_SUCCESS;
+
+  lcd_sim_advance_usec(LCD_SIM_I2C_START_STOP_USEC + LCD_SIM_I2C_BYTE_USEC);
+
+  if ((slave != LCD_SIM_I2C_ADDRESS) || (byte_count == 0))
+  {
+    status = I2C_ERR_NACK;
+  } /* if */
+
+  return (status);
+
+} /* lcd_sim_i2c_start */
@@ -0,0 +1,135 @@
+// *****************************************************************************
+// ***************************    C Source Code     ****************************
+// *****************************************************************************
+//   DESIGNER NAME:  Bruce Link
+//
+//         VERSION:  1.0
+//
+//       FILE NAME:  lcd_sim_main.c
+//
+//-----------------------------------------------------------------------------
+// DESCRIPTION
+//    This file contains the host program that runs the LCD benchmark on the
+//    simulated LCD1602 and checks the display it leaves behind.
+//
+//-----------------------------------------------------------------------------
+// DISCLAIMER
+//    This code was developed for educational purposes as part of the CSC202
+//    course at Monroe Community Collage and is provided "as is" without
+//    warranties of any kind, whether express, implied, or statutory.
+//
+//    The author and organization do not warrant the accuracy, completeness, or
+//    reliability of the code. The author and organization shall not be liable
+//    for any direct, indirect, incidental, special, exemplary, or consequential
+//    damages arising out of the use of or inability to use the code, even if
+//    advised of the possibility of such damages.
+//
+//    Use of this code is at your own risk, and it is recommended to validate
+//    and adapt the code for your specific application and hardware
+//    requirements.
+//
+// Copyright (c) 2026 by Bruce Link
+//    You may use, edit, run or distribute this file as long as the above
+//    copyright notice remains
+// *****************************************************************************
+//******************************************************************************
+
+//-----------------------------------------------------------------------------
+// Load standard C include files
+//-----------------------------------------------------------------------------
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+
+//-----------------------------------------------------------------------------
+// Loads the LCD modules and the model
+//-----------------------------------------------------------------------------
+#include "lcd1602.h"
+#include "lcd1602_i2c.h"
+#include "lcd_bench.h"
+#include "lcd_fb.h"
+#include "lcd_sim.h"
+
+
+//-----------------------------------------------------------------------------
+// Define function prototypes used by the module
+//-----------------------------------------------------------------------------
+static bool run_transport(const lcd1602_transport_t *transport);
+
+
+// -----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This program runs the LCD benchmark on the simulated LCD1602, once
+//    through the I2C backpack (lcd1602_i2c.c with its PCF8574 sequences)
+//    and once through the ideal direct transport, and prints the CSV of
+//    each run. The direct run is the lower bound the I2C numbers can be
+//    compared with.
+//
+// INPUT PARAMETERS:
+//    none
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    0 if every run left the display matching the frame buffer with no
+//    timing violations, otherwise 1
+// -----------------------------------------------------------------------------
+int main(void)
+{
+  bool pass = true;
+
+  pass = run_transport(lcd1602_i2c_transport()) && pass;
+  pass = run_transport(lcd_sim_transport()) && pass;
+
+  return (pass ? 0 : 1);
+
+} /* main */
+
+
+// -----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function resets the model, runs the benchmark with a transport
+//    and checks the result. The last tests write the display through the
+//    frame buffer, so what the model shows must match lcd_fb_get_char().
+//
+// INPUT PARAMETERS:
+//    transport - LCD transport to measure
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    true if the display matched and no write arrived while busy
+// -----------------------------------------------------------------------------
+static bool run_transport(const lcd1602_transport_t *transport)
+{
+  lcd_bench_result_t results[LCD_BENCH_NUM_TESTS];
+  uint8_t count;
+  uint32_t mismatches = 0;
+  uint32_t violations;
+
+  lcd_sim_reset();
+  lcd1602_set_transport(transport);
+
+  count = lcd_bench_run(results);
+  lcd_bench_print_csv(results, count);
+
+  for (uint8_t row = 0; row < LINES_PER_LCD; row++)
+  {
+    for (uint8_t col = 0; col < CHARACTERS_PER_LCD_LINE; col++)
+    {
+      if (lcd_sim_get_char(row, col) != lcd_fb_get_char(row, col))
+      {
+        mismatches++;
+      } /* if */
+    } /* for */
+  } /* for */
+
+  violations = lcd_sim_get_violations();
+  printf("%s: %u display mismatches, %u busy violations\n", transport->name,
+         (unsigned)mismatches, (unsigned)violations);
+
+  return ((mismatches == 0) && (violations == 0));
+
+} /* run_transport */
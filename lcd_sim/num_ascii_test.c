@@ -0,0 +1,392 @@
+// *****************************************************************************
+// ***************************    C Source Code     ****************************
+// *****************************************************************************
+//   DESIGNER NAME:  Bruce Link
+//
+//         VERSION:  1.0
+//
+//       FILE NAME:  num_ascii_test.c
+//
+//-----------------------------------------------------------------------------
+// DESCRIPTION
+//    This file contains the host program that checks the num_ascii.c
+//    conversions. Every 8- and 16-bit value and the 32-bit and fixed-point
+//    edge cases are compared with what snprintf() prints for the same
+//    field width.
+//
+//
+//-----------------------------------------------------------------------------
+// DISCLAIMER
+//    This code was developed for educational purposes as part of the CSC202
+//    course at Monroe Community Collage and is provided "as is" without
+//    warranties of any kind, whether express, implied, or statutory.
+//
+//    The author and organization do not warrant the accuracy, completeness, or
+//    reliability of the code. The author and organization shall not be liable
+//    for any direct, indirect, incidental, special, exemplary, or consequential
+//    damages arising out of the use of or inability to use the code, even if
+//    advised of the possibility of such damages.
+//
+//    Use of this code is at your own risk, and it is recommended to validate
+//    and adapt the code for your specific application and hardware
+//    requirements.
+//
+// Copyright (c) 2026 by Bruce Link
+//    You may use, edit, run or distribute this file as long as the above
+//    copyright notice remains
+// *****************************************************************************
+//******************************************************************************
+
+//-----------------------------------------------------------------------------
+// Load standard C include files
+//-----------------------------------------------------------------------------
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+//-----------------------------------------------------------------------------
+// Loads the module under test
+//-----------------------------------------------------------------------------
+#include "num_ascii.h"
+
+
+//-----------------------------------------------------------------------------
+// Define symbolic constants used by the program
+//-----------------------------------------------------------------------------
+#define TEST_BUFFER_SIZE                                                    (32)
+
+// Width of the fixed-point field in the exhaustive frac_digits sweep
+#define TEST_FIXED_WIDTH                                                    (14)
+
+
+//-----------------------------------------------------------------------------
+// Define function prototypes used by the program
+//-----------------------------------------------------------------------------
+static bool check(const char *what, long long value, const char *actual,
+     const char *expected);
+static bool check_u32(uint32_t value);
+static bool check_s32(int32_t value);
+static bool check_fixed(int32_t value, uint8_t frac_digits, uint8_t width);
+static bool fixed_reference(int32_t value, uint8_t frac_digits,
+     uint8_t width, char *string);
+
+
+//-----------------------------------------------------------------------------
+// Define global variables and structures here.
+// NOTE: when possible avoid using global variables
+//-----------------------------------------------------------------------------
+
+// 32-bit values around every carry and around the multiply limit
+static const uint32_t g_u32_edges[] =
+{
+  0u, 1u, 9u, 10u, 11u, 99u, 100u, 101u, 999u, 1000u, 9999u, 10000u,
+  43698u, 43699u, 43700u, 65535u, 65536u, 99999u, 100000u, 999999u,
+  1000000u, 9999999u, 10000000u, 99999999u, 100000000u, 999999999u,
+  1000000000u, 2147483647u, 2147483648u, 4294967294u, 4294967295u
+};
+
+// Fixed-point cases: value, fraction digits and field width
+static const struct
+{
+  int32_t value;
+  uint8_t frac_digits;
+  uint8_t width;
+} g_fixed_edges[] =
+{
+  {0, 0, 1},            {0, 2, 4},            {5, 2, 4},
+  {-5, 2, 5},           {-5, 2, 4},           {-1234, 2, 7},
+  {-1234, 2, 6},        {-1234, 2, 5},        {1234, 0, 4},
+  {1234, 0, 3},         {-1234, 0, 5},        {1, 9, 11},
+  {-1, 9, 12},          {-1, 9, 11},          {INT32_MAX, 9, 12},
+  {INT32_MIN, 9, 13},   {INT32_MIN, 9, 12},   {INT32_MIN, 0, 11},
+  {INT32_MIN, 0, 10},   {100, 2, 4},          {99, 2, 4},
+  {7, 10, 20}
+};
+
+
+// -----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This program runs every check and prints a one line summary. The
+//    first few failures are printed as they are found.
+//
+// INPUT PARAMETERS:
+//    none
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    0 if every conversion matched, otherwise 1
+// -----------------------------------------------------------------------------
+int main(void)
+{
+  char     actual[TEST_BUFFER_SIZE];
+  char     expected[TEST_BUFFER_SIZE];
+  uint32_t checks = 0;
+  uint32_t failures = 0;
+
+  for (uint32_t value = 0; value <= UINT8_MAX; value++)
+  {
+    u8_to_ascii((uint8_t)value, actual);
+    snprintf(expected, sizeof(expected), "%*u", NUM_ASCII_U8_WIDTH,
+             (unsigned)value);
+    failures += !check("u8", value, actual, expected);
+
+    s8_to_ascii((int8_t)value, actual);
+    snprintf(expected, sizeof(expected), "%*d", NUM_ASCII_S8_WIDTH,
+             (int)(int8_t)value);
+    failures += !check("s8", (int8_t)value, actual, expected);
+    checks += 2;
+  } /* for */
+
+  for (uint32_t value = 0; value <= UINT16_MAX; value++)
+  {
+    u16_to_ascii((uint16_t)value, actual);
+    snprintf(expected, sizeof(expected), "%*u", NUM_ASCII_U16_WIDTH,
+             (unsigned)value);
+    failures += !check("u16", value, actual, expected);
+
+    s16_to_ascii((int16_t)value, actual);
+    snprintf(expected, sizeof(expected), "%*d", NUM_ASCII_S16_WIDTH,
+             (int)(int16_t)value);
+    failures += !check("s16", (int16_t)value, actual, expected);
+    checks += 2;
+  } /* for */
+
+  for (uint16_t idx = 0; idx < sizeof(g_u32_edges) / sizeof(g_u32_edges[0]);
+       idx++)
+  {
+    uint32_t value = g_u32_edges[idx];
+
+    failures += !check_u32(value);
+    failures += !check_s32((int32_t)value);
+    failures += !check_s32(-(int32_t)(value & INT32_MAX));
+    checks += 3;
+  } /* for */
+  failures += !check_s32(INT32_MIN);
+  failures += !check_s32(-1);
+  checks += 2;
+
+  for (uint16_t idx = 0; idx < sizeof(g_fixed_edges) /
+       sizeof(g_fixed_edges[0]); idx++)
+  {
+    failures += !check_fixed(g_fixed_edges[idx].value,
+                             g_fixed_edges[idx].frac_digits,
+                             g_fixed_edges[idx].width);
+    checks++;
+  } /* for */
+
+  // Every fraction length on a few values, each in a field that fits
+  for (uint8_t frac = 0; frac <= NUM_ASCII_MAX_FRAC_DIGITS; frac++)
+  {
+    for (uint16_t idx = 0; idx < sizeof(g_u32_edges) /
+         sizeof(g_u32_edges[0]); idx++)
+    {
+      int32_t value = (int32_t)(g_u32_edges[idx] & INT32_MAX);
+
+      failures += !check_fixed(value, frac, TEST_FIXED_WIDTH);
+      failures += !check_fixed(-value, frac, TEST_FIXED_WIDTH);
+      checks += 2;
+    } /* for */
+  } /* for */
+
+  printf("num_ascii: %u checks, %u failures\n", (unsigned)checks,
+         (unsigned)failures);
+
+  return ((failures == 0) ? 0 : 1);
+
+} /* main */
+
+
+// -----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function compares a converted string with the expected one and
+//    prints the first few mismatches.
+//
+// INPUT PARAMETERS:
+//    what     - name of the conversion for the report
+//    value    - value that was converted
+//    actual   - string the conversion produced
+//    expected - string it should have produced
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    true if the strings match
+// -----------------------------------------------------------------------------
+static bool check(const char *what, long long value, const char *actual,
+     const char *expected)
+{
+  static uint8_t reported = 0;
+  bool           match = (strcmp(actual, expected) == 0);
+
+  if (!match && (reported < 10))
+  {
+    printf("%s(%lld): got \"%s\", expected \"%s\"\n", what, value, actual,
+           expected);
+    reported++;
+  } /* if */
+
+  return (match);
+
+} /* check */
+
+
+// -----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function checks u32_to_ascii() with one value.
+//
+// INPUT PARAMETERS:
+//    value - value to convert
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    true if the conversion matched snprintf()
+// -----------------------------------------------------------------------------
+static bool check_u32(uint32_t value)
+{
+  char actual[TEST_BUFFER_SIZE];
+  char expected[TEST_BUFFER_SIZE];
+
+  u32_to_ascii(value, actual);
+  snprintf(expected, sizeof(expected), "%*lu", NUM_ASCII_U32_WIDTH,
+           (unsigned long)value);
+
+  return (check("u32", value, actual, expected));
+
+} /* check_u32 */
+
+
+// -----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function checks s32_to_ascii() with one value.
+//
+// INPUT PARAMETERS:
+//    value - value to convert
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    true if the conversion matched snprintf()
+// -----------------------------------------------------------------------------
+static bool check_s32(int32_t value)
+{
+  char actual[TEST_BUFFER_SIZE];
+  char expected[TEST_BUFFER_SIZE];
+
+  s32_to_ascii(value, actual);
+  snprintf(expected, sizeof(expected), "%*ld", NUM_ASCII_S32_WIDTH,
+           (long)value);
+
+  return (check("s32", value, actual, expected));
+
+} /* check_s32 */
+
+
+// -----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function checks fixed_to_ascii() with one value, including its
+//    return value.
+//
+// INPUT PARAMETERS:
+//    value       - scaled value to convert
+//    frac_digits - digits after the decimal point
+//    width       - field width
+//
+// OUTPUT PARAMETERS:
+//    none
+//
+// RETURN:
+//    true if the string and the return value matched the reference
+// -----------------------------------------------------------------------------
+static bool check_fixed(int32_t value, uint8_t frac_digits, uint8_t width)
+{
+  char actual[TEST_BUFFER_SIZE];
+  char expected[TEST_BUFFER_SIZE];
+  bool actual_fit;
+  bool expected_fit;
+
+  actual_fit = fixed_to_ascii(value, frac_digits, width, actual);
+  expected_fit = fixed_reference(value, frac_digits, width, expected);
+
+  if (actual_fit != expected_fit)
+  {
+    printf("fixed(%ld, %u, %u): returned %d, expected %d\n", (long)value,
+           frac_digits, width, actual_fit, expected_fit);
+    return (false);
+  } /* if */
+
+  return (check("fixed", value, actual, expected));
+
+} /* check_fixed */
+
+
+// -----------------------------------------------------------------------------
+// DESCRIPTION:
+//    This function builds the expected fixed-point string with snprintf():
+//    the integer part, a point and the zero padded fraction, right
+//    justified in the field. A field that is too short is filled with '*'.
+//    More than NUM_ASCII_MAX_FRAC_DIGITS never fits.
+//
+// INPUT PARAMETERS:
+//    value       - scaled value to convert
+//    frac_digits - digits after the decimal point
+//    width       - field width
+//
+// OUTPUT PARAMETERS:
+//    string - expected field, width characters plus the NUL
+//
+// RETURN:
+//    true if the value fit in the field
+// -----------------------------------------------------------------------------
+static bool fixed_reference(int32_t value, uint8_t frac_digits,
+     uint8_t width, char *string)
+{
+  char     number[TEST_BUFFER_SIZE];
+  uint64_t scale = 1;
+  uint64_t magnitude;
+  int      length;
+
+  magnitude = (value < 0) ? (0u - (uint64_t)(int64_t)value) : (uint64_t)value;
+
+  if (frac_digits > NUM_ASCII_MAX_FRAC_DIGITS)
+  {
+    length = width + 1;
+  }
+  else if (frac_digits == 0)
+  {
+    length = snprintf(number, sizeof(number), "%s%llu",
+                      (value < 0) ? "-" : "",
+                      (unsigned long long)magnitude);
+  }
+  else
+  {
+    for (uint8_t digit = 0; digit < frac_digits; digit++)
+    {
+      scale *= 10;
+    } /* for */
+
+    length = snprintf(number, sizeof(number), "%s%llu.%0*llu",
+                      (value < 0) ? "-" : "",
+                      (unsigned long long)(magnitude / scale),
+                      (int)frac_digits,
+                      (unsigned long long)(magnitude % scale));
+  } /* else */
+
+  if (length > width)
+  {
+    memset(string, '*', width);
+    string[width] = '\0';
+    return (false);
+  } /* if */
+
+  snprintf(string, TEST_BUFFER_SIZE, "%*s", width, number);
+
+  return (true);
+
+} /* fixed_reference */